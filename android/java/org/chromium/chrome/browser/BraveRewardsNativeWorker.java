@@ -197,6 +197,18 @@ public class BraveRewardsNativeWorker {
         }
     }
 
+    /**
+     * Returns the ledger state already cached on the native side (balance,
+     * rate, auto-contribute state, reconcile stamp) as one JSON document so
+     * UI startup reads it with a single JNI crossing.
+     */
+    public String GetCachedState() {
+        synchronized(lock) {
+            return BraveRewardsNativeWorkerJni.get().getCachedState(
+                    mNativeBraveRewardsNativeWorker);
+        }
+    }
+
     public void GetPublisherInfo(int tabId, String host) {
         synchronized(lock) {
             BraveRewardsNativeWorkerJni.get().getPublisherInfo(
@@ -624,6 +636,7 @@ public class BraveRewardsNativeWorker {
         void destroy(long nativeBraveRewardsNativeWorker);
         String getWalletBalance(long nativeBraveRewardsNativeWorker);
         double getWalletRate(long nativeBraveRewardsNativeWorker);
+        String getCachedState(long nativeBraveRewardsNativeWorker);
         void getPublisherInfo(long nativeBraveRewardsNativeWorker, int tabId, String host);
         String getPublisherURL(long nativeBraveRewardsNativeWorker, int tabId);
         String getPublisherFavIconURL(long nativeBraveRewardsNativeWorker, int tabId);
@@ -256,6 +256,16 @@ public class BravePrefServiceBridge {
         return BravePrefServiceBridgeJni.get().getWebrtcPolicy();
     }
 
+    /**
+     * Returns every no-argument pref in one JSON document, keyed by the
+     * individual getter names, so startup code can read them all with a
+     * single JNI crossing. Use the individual getters for reads that must
+     * observe changes made after the snapshot was taken.
+     */
+    public String getPrefsSnapshot() {
+        return BravePrefServiceBridgeJni.get().getPrefsSnapshot();
+    }
+
     @NativeMethods
     interface Natives {
         void setCosmeticFilteringControlType(int type);
@@ -327,5 +337,7 @@ public class BravePrefServiceBridge {
 
         void setWebrtcPolicy(int policy);
         int getWebrtcPolicy();
+
+        String getPrefsSnapshot();
     }
 }
@@ -5,7 +5,11 @@
 
 #include "brave/build/android/jni_headers/BravePrefServiceBridge_jni.h"
 
+#include <string>
+
 #include "base/android/jni_string.h"
+#include "base/json/json_writer.h"
+#include "base/values.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_perf_predictor/browser/buildflags.h"
 #include "brave/components/brave_referrals/common/pref_names.h"
@@ -555,5 +559,113 @@ jint JNI_BravePrefServiceBridge_GetENSResolveMethod(JNIEnv* env) {
 #endif
 }
 
+base::android::ScopedJavaLocalRef<jstring>
+JNI_BravePrefServiceBridge_GetPrefsSnapshot(JNIEnv* env) {
+  // Returns every no-argument pref the Java layer reads at startup as one
+  // JSON document, so a cold start pays a single JNI crossing instead of one
+  // per getter. Keys and values match the individual getters above; the Java
+  // side keeps using those for reads that must observe later changes.
+  PrefService* profile_prefs = GetOriginalProfile()->GetPrefs();
+  HostContentSettingsMap* map =
+      HostContentSettingsMapFactory::GetForProfile(GetOriginalProfile());
+
+  base::Value snapshot(base::Value::Type::DICTIONARY);
+
+  // Matches GetCosmeticFilteringControlType
+  brave_shields::ControlType cosmetic_type =
+      brave_shields::GetCosmeticFilteringControlType(map, GURL());
+  brave_shields::ControlType control_type_ad =
+      brave_shields::GetAdControlType(map, GURL());
+  ControlType effective_cosmetic_type;
+  if (cosmetic_type == ControlType::BLOCK) {
+    effective_cosmetic_type = ControlType::BLOCK;
+  } else if (control_type_ad == ControlType::BLOCK) {
+    effective_cosmetic_type = ControlType::DEFAULT;
+  } else {
+    effective_cosmetic_type = ControlType::ALLOW;
+  }
+  snapshot.SetStringKey(
+      "cosmeticFilteringControlType",
+      brave_shields::ControlTypeToString(effective_cosmetic_type));
+
+  snapshot.SetStringKey(
+      "cookiesBlockType",
+      brave_shields::ControlTypeToString(
+          brave_shields::GetCookieControlType(map, GURL())));
+  snapshot.SetStringKey(
+      "fingerprintingControlType",
+      brave_shields::ControlTypeToString(
+          brave_shields::GetFingerprintingControlType(map, GURL())));
+  snapshot.SetStringKey(
+      "noScriptControlType",
+      brave_shields::ControlTypeToString(
+          brave_shields::GetNoScriptControlType(map, GURL())));
+
+  snapshot.SetBoolKey("playYTVideoInBrowserEnabled",
+                      profile_prefs->GetBoolean(kPlayYTVideoInBrowserEnabled));
+  snapshot.SetBoolKey(
+      "backgroundVideoPlaybackEnabled",
+      profile_prefs->GetBoolean(kBackgroundVideoPlaybackEnabled));
+  snapshot.SetBoolKey("desktopModeEnabled",
+                      profile_prefs->GetBoolean(kDesktopModeEnabled));
+
+  snapshot.SetDoubleKey(
+      "trackersBlockedCount",
+      static_cast<double>(profile_prefs->GetUint64(kTrackersBlocked)));
+  snapshot.SetDoubleKey(
+      "adsBlockedCount",
+      static_cast<double>(profile_prefs->GetUint64(kAdsBlocked)));
+#if BUILDFLAG(ENABLE_BRAVE_PERF_PREDICTOR)
+  snapshot.SetDoubleKey(
+      "dataSaved", static_cast<double>(profile_prefs->GetUint64(
+                       brave_perf_predictor::prefs::kBandwidthSavedBytes)));
+#else
+  snapshot.SetDoubleKey("dataSaved", 0);
+#endif
+
+  snapshot.SetBoolKey("safetynetCheckFailed",
+                      profile_prefs->GetBoolean(kSafetynetCheckFailed));
+  snapshot.SetBoolKey("useRewardsStagingServer",
+                      profile_prefs->GetBoolean(
+                          brave_rewards::prefs::kUseRewardsStagingServer));
+
+  snapshot.SetIntKey("webrtcPolicy",
+                     static_cast<int>(GetWebRTCIPHandlingPolicy(
+                         profile_prefs->GetString(
+                             prefs::kWebRTCIPHandlingPolicy))));
+
+#if BUILDFLAG(BRAVE_P3A_ENABLED)
+  snapshot.SetBoolKey(
+      "p3aEnabled", g_browser_process->local_state()->GetBoolean(
+                        brave::kP3AEnabled));
+  snapshot.SetBoolKey("hasPathP3AEnabled",
+                      g_browser_process->local_state()->HasPrefPath(
+                          brave::kP3AEnabled));
+  snapshot.SetBoolKey("p3aNoticeAcknowledged",
+                      g_browser_process->local_state()->GetBoolean(
+                          brave::kP3ANoticeAcknowledged));
+#else
+  snapshot.SetBoolKey("p3aEnabled", false);
+  snapshot.SetBoolKey("hasPathP3AEnabled", false);
+  snapshot.SetBoolKey("p3aNoticeAcknowledged", false);
+#endif
+
+#if BUILDFLAG(DECENTRALIZED_DNS_ENABLED)
+  snapshot.SetIntKey("unstoppableDomainsResolveMethod",
+                     g_browser_process->local_state()->GetInteger(
+                         decentralized_dns::kUnstoppableDomainsResolveMethod));
+  snapshot.SetIntKey("ensResolveMethod",
+                     g_browser_process->local_state()->GetInteger(
+                         decentralized_dns::kENSResolveMethod));
+#else
+  snapshot.SetIntKey("unstoppableDomainsResolveMethod", 0);
+  snapshot.SetIntKey("ensResolveMethod", 0);
+#endif
+
+  std::string json;
+  base::JSONWriter::Write(snapshot, &json);
+  return ConvertUTF8ToJavaString(env, json);
+}
+
 }  // namespace android
 }  // namespace chrome
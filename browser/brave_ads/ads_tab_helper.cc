@@ -33,6 +33,9 @@ AdsTabHelper::AdsTabHelper(content::WebContents* web_contents)
       ads_service_(nullptr),
       is_active_(false),
       is_browser_active_(true),
+      last_reported_is_active_(false),
+      last_reported_is_browser_active_(false),
+      has_reported_tab_update_(false),
       should_process_(false),
       weak_factory_(this) {
   if (!tab_id_.is_valid()) {
@@ -69,8 +72,23 @@ void AdsTabHelper::TabUpdated() {
     return;
   }
 
-  ads_service_->OnTabUpdated(tab_id_, web_contents()->GetVisibleURL(),
-                             is_active_, is_browser_active_);
+  const GURL url = web_contents()->GetVisibleURL();
+
+  // Page loads, visibility changes and browser activation can all fire for
+  // the same tab state, so only notify the ads service when something changed
+  // to avoid needlessly waking the bat_ads service process
+  if (has_reported_tab_update_ && url == last_reported_url_ &&
+      is_active_ == last_reported_is_active_ &&
+      is_browser_active_ == last_reported_is_browser_active_) {
+    return;
+  }
+
+  has_reported_tab_update_ = true;
+  last_reported_url_ = url;
+  last_reported_is_active_ = is_active_;
+  last_reported_is_browser_active_ = is_browser_active_;
+
+  ads_service_->OnTabUpdated(tab_id_, url, is_active_, is_browser_active_);
 }
 
 void AdsTabHelper::RunIsolatedJavaScript(
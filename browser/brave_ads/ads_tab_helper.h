@@ -91,6 +91,10 @@ class AdsTabHelper : public content::WebContentsObserver,
   AdsService* ads_service_;  // NOT OWNED
   bool is_active_;
   bool is_browser_active_;
+  GURL last_reported_url_;
+  bool last_reported_is_active_;
+  bool last_reported_is_browser_active_;
+  bool has_reported_tab_update_;
   std::vector<GURL> redirect_chain_;
   bool should_process_;
 
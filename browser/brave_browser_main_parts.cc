@@ -25,6 +25,7 @@
 #if BUILDFLAG(ENABLE_TOR)
 #include <string>
 #include "base/files/file_util.h"
+#include "brave/browser/tor/tor_profile_manager.h"
 #include "brave/components/tor/tor_constants.h"
 #include "chrome/browser/browser_process_impl.h"
 #include "chrome/browser/profiles/profile_attributes_init_params.h"
@@ -99,6 +100,8 @@ void BraveBrowserMainParts::PostBrowserStart() {
           ProfileMetrics::DELETE_PROFILE_SETTINGS);
     }
   }
+
+  TorProfileManager::GetInstance().MaybePrewarmTorProcess(profile());
 #endif
 
 #if !defined(OS_ANDROID)
@@ -124,6 +124,11 @@ class BraveBrowserProcessImpl : public BraveBrowserProcess,
   // BrowserProcessImpl overrides:
   void Init() override;
 
+  // Starts the services that can wait until startup is complete. Prefer
+  // adding new services here instead of StartBraveServices unless the
+  // first navigation needs them.
+  void StartDeferredServices();
+
   void CreateProfileManager();
   void CreateNotificationPlatformBridge();
 
@@ -73,8 +73,10 @@
 #include "content/public/common/content_switches.h"
 #include "extensions/buildflags/buildflags.h"
 #include "mojo/public/cpp/bindings/pending_receiver.h"
+#include "net/base/network_isolation_key.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "net/cookies/site_for_cookies.h"
+#include "services/network/public/mojom/network_context.mojom.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_registry.h"
 #include "third_party/blink/public/common/loader/url_loader_throttle.h"
 #include "third_party/blink/public/mojom/webpreferences/web_preferences.mojom.h"
@@ -240,6 +242,17 @@ void BindBraveSearchFallbackHost(
     return;
 
   content::BrowserContext* context = render_process_host->GetBrowserContext();
+
+  // The search page binds this interface when it loads, well before a query
+  // is submitted, so warm up a connection to the backup provider now and the
+  // eventual fetch skips connection setup. Fallback requests are sent without
+  // credentials, so preconnect the same way.
+  context->GetDefaultStoragePartition()
+      ->GetNetworkContext()
+      ->PreconnectSockets(1, GURL("https://www.google.com"),
+                          false /* allow_credentials */,
+                          net::NetworkIsolationKey());
+
   mojo::MakeSelfOwnedReceiver(
       std::make_unique<brave_search::BraveSearchFallbackHost>(
           context->GetDefaultStoragePartition()
@@ -552,11 +565,20 @@ void BraveContentBrowserClient::MaybeHideReferrer(
     return;
   }
 
+  // Empty and same-origin referrers are never changed, so don't bother
+  // looking up the shields settings for them. This is the common case for
+  // subresource requests.
+  if ((*referrer)->url.is_empty() ||
+      brave_shields::IsSameOriginNavigation((*referrer)->url, request_url)) {
+    return;
+  }
+
   Profile* profile = Profile::FromBrowserContext(browser_context);
-  const bool allow_referrers = brave_shields::AllowReferrers(
-      HostContentSettingsMapFactory::GetForProfile(profile), document_url);
-  const bool shields_up = brave_shields::GetBraveShieldsEnabled(
-      HostContentSettingsMapFactory::GetForProfile(profile), document_url);
+  HostContentSettingsMap* map =
+      HostContentSettingsMapFactory::GetForProfile(profile);
+  const bool allow_referrers = brave_shields::AllowReferrers(map, document_url);
+  const bool shields_up =
+      brave_shields::GetBraveShieldsEnabled(map, document_url);
 
   content::Referrer new_referrer;
   if (brave_shields::MaybeChangeReferrer(allow_referrers, shields_up,
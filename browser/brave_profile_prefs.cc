@@ -147,6 +147,10 @@ void RegisterProfilePrefsForMigration(
       TemplateURLPrepopulateData::PREPOPULATED_ENGINE_ID_INVALID);
   // Added 05/2021
   registry->RegisterBooleanPref(kBraveTodayIntroDismissed, false);
+
+  // Added 08/2021. Sentinel that lets fully-migrated profiles skip the
+  // per-pref migration probing in MigrateObsoleteProfilePrefs.
+  registry->RegisterIntegerPref(kBraveProfilePrefsMigrationVersion, 0);
 }
 
 void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry) {
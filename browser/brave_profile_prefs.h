@@ -11,6 +11,13 @@ class PrefRegistrySyncable;
 
 namespace brave {
 
+// Schema version recorded in |kBraveProfilePrefsMigrationVersion| once every
+// Brave profile pref migration has run. Profiles already at this version skip
+// the per-pref migration probing on startup. Bump it whenever a migration is
+// added to |MigrateObsoleteProfilePrefs| so migrated profiles run the new
+// entry once.
+constexpr int kBraveProfilePrefsMigrationCurrentVersion = 1;
+
 void RegisterProfilePrefs(user_prefs::PrefRegistrySyncable* registry);
 
 }  // namespace brave
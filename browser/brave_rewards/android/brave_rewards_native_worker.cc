@@ -255,6 +255,34 @@ double BraveRewardsNativeWorker::GetWalletRate(JNIEnv* env) {
   return parameters_.rate;
 }
 
+base::android::ScopedJavaLocalRef<jstring>
+BraveRewardsNativeWorker::GetCachedState(JNIEnv* env) {
+  std::string json_state;
+  base::DictionaryValue json_root;
+
+  auto json_balance = std::make_unique<base::DictionaryValue>();
+  json_balance->SetDoubleKey("total", balance_.total);
+  auto json_wallets = std::make_unique<base::DictionaryValue>();
+  for (const auto & item : balance_.wallets) {
+    json_wallets->SetDoubleKey(item.first, item.second);
+  }
+  json_balance->SetDictionary("wallets", std::move(json_wallets));
+  json_root.SetDictionary("balance", std::move(json_balance));
+
+  json_root.SetDoubleKey("rate", parameters_.rate);
+  json_root.SetBoolKey("autoContributeEnabled",
+      auto_contrib_properties_ ?
+          auto_contrib_properties_->enabled_contribute : false);
+  json_root.SetDoubleKey("autoContributeAmount",
+      auto_contrib_properties_ ? auto_contrib_properties_->amount : 0.0);
+  json_root.SetDoubleKey("reconcileStamp",
+      auto_contrib_properties_ ?
+          auto_contrib_properties_->reconcile_stamp : 0.0);
+  base::JSONWriter::Write(json_root, &json_state);
+
+  return base::android::ConvertUTF8ToJavaString(env, json_state);
+}
+
 void BraveRewardsNativeWorker::FetchGrants(JNIEnv* env) {
   if (brave_rewards_service_) {
     brave_rewards_service_->FetchPromotions();
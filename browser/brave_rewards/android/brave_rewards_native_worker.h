@@ -49,6 +49,12 @@ class BraveRewardsNativeWorker : public brave_rewards::RewardsServiceObserver,
 
     double GetWalletRate(JNIEnv* env);
 
+    // Serializes the ledger state this worker already caches from observers
+    // (balance, rate, auto contribute state, reconcile stamp) into one JSON
+    // document so the rewards UI can populate with a single JNI crossing
+    // instead of one call per value.
+    base::android::ScopedJavaLocalRef<jstring> GetCachedState(JNIEnv* env);
+
     base::android::ScopedJavaLocalRef<jstring> GetPublisherURL(JNIEnv* env,
                                                                uint64_t tabId);
 
@@ -10,9 +10,11 @@
 #include <utility>
 
 #include "base/strings/utf_string_conversions.h"
+#include "brave/browser/brave_shields/stats_counter_service_factory.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_perf_predictor/browser/buildflags.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/brave_shields/browser/stats_counter_service.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "chrome/browser/content_settings/host_content_settings_map_factory.h"
 #include "chrome/browser/profiles/profile.h"
@@ -20,7 +22,6 @@
 #include "components/content_settings/core/browser/host_content_settings_map.h"
 #include "components/content_settings/core/common/content_settings_utils.h"
 #include "components/prefs/pref_registry_simple.h"
-#include "components/prefs/pref_service.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/navigation_handle.h"
 #include "content/public/browser/render_frame_host.h"
@@ -30,6 +31,7 @@
 #include "ipc/ipc_message_macros.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
 #include "third_party/blink/public/common/associated_interfaces/associated_interface_provider.h"
+#include "url/gurl.h"
 
 #if BUILDFLAG(ENABLE_BRAVE_PERF_PREDICTOR)
 #include "brave/components/brave_perf_predictor/browser/perf_predictor_tab_helper.h"
@@ -76,6 +78,18 @@ void UpdateContentSettingsToRendererFrames(content::WebContents* web_contents) {
   }
 }
 
+// Upper bound on the deduplicated blocked-host list kept per tab.
+constexpr size_t kMaxBlockedHostsPerTab = 500;
+
+// Upper bound on the full-URL dedup set used for stats counting. Past the
+// cap, previously unseen blocked URLs may be counted more than once; the
+// cap trades that slight overcount on extreme pages for a hard memory
+// bound on long-lived single-page apps.
+constexpr size_t kMaxBlockedUrlDedupePerTab = 2000;
+
+// Number of most-recent blocked URLs retained for panel display.
+constexpr size_t kMaxRecentlyBlockedUrls = 100;
+
 }  // namespace
 
 namespace brave_shields {
@@ -123,7 +137,41 @@ bool BraveShieldsWebContentsObserver::IsBlockedSubresource(
 
 void BraveShieldsWebContentsObserver::AddBlockedSubresource(
     const std::string& subresource) {
-  blocked_url_paths_.insert(subresource);
+  if (blocked_url_paths_.size() < kMaxBlockedUrlDedupePerTab)
+    blocked_url_paths_.insert(subresource);
+}
+
+void BraveShieldsWebContentsObserver::RecordBlockedResource(
+    const std::string& block_type,
+    const GURL& request_url) {
+  blocked_counts_[block_type]++;
+  // Intern the host. The table is capped so ad-heavy pages marshal a bounded
+  // payload when the panel queries it; counts for hosts interned before the
+  // cap keep aggregating past it.
+  const std::string host = request_url.host();
+  auto it = blocked_host_ids_.find(host);
+  if (it == blocked_host_ids_.end() &&
+      blocked_host_names_.size() < kMaxBlockedHostsPerTab) {
+    it = blocked_host_ids_
+             .emplace(host, static_cast<uint32_t>(blocked_host_names_.size()))
+             .first;
+    blocked_host_names_.push_back(host);
+    blocked_host_counts_.push_back(0);
+  }
+  if (it != blocked_host_ids_.end())
+    blocked_host_counts_[it->second]++;
+
+  if (recently_blocked_urls_.size() == kMaxRecentlyBlockedUrls)
+    recently_blocked_urls_.pop_front();
+  recently_blocked_urls_.push_back(request_url.possibly_invalid_spec());
+}
+
+void BraveShieldsWebContentsObserver::ClearBlockedResourceStats() {
+  blocked_counts_.clear();
+  blocked_host_names_.clear();
+  blocked_host_ids_.clear();
+  blocked_host_counts_.clear();
+  recently_blocked_urls_.clear();
 }
 
 // static
@@ -141,24 +189,16 @@ void BraveShieldsWebContentsObserver::DispatchBlockedEvent(
   if (web_contents) {
     BraveShieldsWebContentsObserver* observer =
         BraveShieldsWebContentsObserver::FromWebContents(web_contents);
+    if (observer)
+      observer->RecordBlockedResource(block_type, request_url);
     if (observer && !observer->IsBlockedSubresource(subresource)) {
       observer->AddBlockedSubresource(subresource);
-      PrefService* prefs =
-          Profile::FromBrowserContext(web_contents->GetBrowserContext())
-              ->GetOriginalProfile()
-              ->GetPrefs();
-
-      if (block_type == kAds) {
-        prefs->SetUint64(kAdsBlocked, prefs->GetUint64(kAdsBlocked) + 1);
-      } else if (block_type == kHTTPUpgradableResources) {
-        prefs->SetUint64(kHttpsUpgrades, prefs->GetUint64(kHttpsUpgrades) + 1);
-      } else if (block_type == kJavaScript) {
-        prefs->SetUint64(kJavascriptBlocked,
-                         prefs->GetUint64(kJavascriptBlocked) + 1);
-      } else if (block_type == kFingerprintingV2) {
-        prefs->SetUint64(kFingerprintingBlocked,
-                         prefs->GetUint64(kFingerprintingBlocked) + 1);
-      }
+      StatsCounterService* stats_counter_service =
+          StatsCounterServiceFactory::GetForBrowserContext(
+              Profile::FromBrowserContext(web_contents->GetBrowserContext())
+                  ->GetOriginalProfile());
+      if (stats_counter_service)
+        stats_counter_service->RecordBlockedEvent(block_type);
     }
   }
 #if BUILDFLAG(ENABLE_BRAVE_PERF_PREDICTOR)
@@ -201,8 +241,10 @@ void BraveShieldsWebContentsObserver::OnJavaScriptBlocked(
   if (!web_contents)
     return;
 
+  const std::string blocked_origin = base::UTF16ToUTF8(details);
+  RecordBlockedResource(brave_shields::kJavaScript, GURL(blocked_origin));
   DispatchBlockedEventForWebContents(brave_shields::kJavaScript,
-                                     base::UTF16ToUTF8(details), web_contents);
+                                     blocked_origin, web_contents);
 }
 
 // static
@@ -225,11 +267,13 @@ void BraveShieldsWebContentsObserver::ReadyToCommitNavigation(
       // For new loads, we reset the counters for both blocked scripts and URLs.
       allowed_script_origins_.clear();
       blocked_url_paths_.clear();
+      ClearBlockedResourceStats();
     } else if (reload_type == content::ReloadType::NORMAL) {
       // For normal reloads (or loads to the current URL, internally converted
       // into reloads i.e see NavigationControllerImpl::NavigateWithoutEntry),
       // we only reset the counter for blocked URLs, not the one for scripts.
       blocked_url_paths_.clear();
+      ClearBlockedResourceStats();
     }
   }
 
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/circular_deque.h"
 #include "base/containers/flat_map.h"
 #include "base/macros.h"
 #include "base/synchronization/lock.h"
@@ -49,6 +50,31 @@ class BraveShieldsWebContentsObserver
   bool IsBlockedSubresource(const std::string& subresource);
   void AddBlockedSubresource(const std::string& subresource);
 
+  // Accumulates preaggregated per-tab shields activity as blocked events are
+  // dispatched, so the panel can query totals and a bounded host list in one
+  // call instead of re-accumulating per-resource event strings.
+  void RecordBlockedResource(const std::string& block_type,
+                             const GURL& request_url);
+  // Number of blocked requests for this page load, keyed by block type.
+  const base::flat_map<std::string, uint64_t>& blocked_counts() const {
+    return blocked_counts_;
+  }
+  // Deduplicated hosts of blocked requests for this page load, capped. Each
+  // host is stored once; per-host totals live in blocked_host_counts(),
+  // indexed in parallel.
+  const std::vector<std::string>& blocked_hosts() const {
+    return blocked_host_names_;
+  }
+  // Blocked-request count per entry of blocked_hosts(). Counts keep
+  // aggregating for already-interned hosts even after the host cap is hit.
+  const std::vector<uint64_t>& blocked_host_counts() const {
+    return blocked_host_counts_;
+  }
+  // The most recently blocked request URLs, oldest first, ring-capped.
+  const base::circular_deque<std::string>& recently_blocked_urls() const {
+    return recently_blocked_urls_;
+  }
+
  protected:
   // content::WebContentsObserver overrides.
   void RenderFrameCreated(content::RenderFrameHost* host) override;
@@ -68,6 +94,10 @@ class BraveShieldsWebContentsObserver
       content::RenderFrameHost*,
       mojo::AssociatedRemote<brave_shields::mojom::BraveShields>>;
 
+  // Resets the per-page-load blocked-resource store (counts, interned
+  // hosts, recent-URL ring) when the main frame navigates away.
+  void ClearBlockedResourceStats();
+
   // Return an already bound remote for the brave_shields::mojom::BraveShields
   // mojo interface. It is an error to call this method with an invalid |rfh|.
   mojo::AssociatedRemote<brave_shields::mojom::BraveShields>&
@@ -75,8 +105,19 @@ class BraveShieldsWebContentsObserver
 
   std::vector<std::string> allowed_script_origins_;
   // We keep a set of the current page's blocked URLs in case the page
-  // continually tries to load the same blocked URLs.
+  // continually tries to load the same blocked URLs. Capped; see
+  // AddBlockedSubresource().
   std::set<std::string> blocked_url_paths_;
+  base::flat_map<std::string, uint64_t> blocked_counts_;
+  // Interned host table for blocked requests: each distinct host is stored
+  // once in |blocked_host_names_|, |blocked_host_ids_| maps it to its index
+  // there, and |blocked_host_counts_| carries the per-host total at the same
+  // index. Bounded by the host cap; repeat blocks on a host cost one counter
+  // bump, not another string.
+  std::vector<std::string> blocked_host_names_;
+  base::flat_map<std::string, uint32_t> blocked_host_ids_;
+  std::vector<uint64_t> blocked_host_counts_;
+  base::circular_deque<std::string> recently_blocked_urls_;
 
   content::WebContentsFrameReceiverSet<brave_shields::mojom::BraveShieldsHost>
       brave_shields_receivers_;
@@ -0,0 +1,40 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/brave_shields/stats_counter_service_factory.h"
+
+#include "brave/components/brave_shields/browser/stats_counter_service.h"
+#include "chrome/browser/profiles/profile.h"
+#include "components/keyed_service/content/browser_context_dependency_manager.h"
+
+namespace brave_shields {
+
+// static
+StatsCounterService* StatsCounterServiceFactory::GetForBrowserContext(
+    content::BrowserContext* context) {
+  return static_cast<StatsCounterService*>(
+      GetInstance()->GetServiceForBrowserContext(context,
+                                                 /*create_service=*/true));
+}
+
+// static
+StatsCounterServiceFactory* StatsCounterServiceFactory::GetInstance() {
+  return base::Singleton<StatsCounterServiceFactory>::get();
+}
+
+StatsCounterServiceFactory::StatsCounterServiceFactory()
+    : BrowserContextKeyedServiceFactory(
+          "StatsCounterService",
+          BrowserContextDependencyManager::GetInstance()) {}
+
+StatsCounterServiceFactory::~StatsCounterServiceFactory() {}
+
+KeyedService* StatsCounterServiceFactory::BuildServiceInstanceFor(
+    content::BrowserContext* context) const {
+  auto* profile = Profile::FromBrowserContext(context);
+  return new StatsCounterService(profile->GetPrefs());
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,38 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_BRAVE_SHIELDS_STATS_COUNTER_SERVICE_FACTORY_H_
+#define BRAVE_BROWSER_BRAVE_SHIELDS_STATS_COUNTER_SERVICE_FACTORY_H_
+
+#include "base/memory/singleton.h"
+#include "components/keyed_service/content/browser_context_keyed_service_factory.h"
+
+namespace brave_shields {
+
+class StatsCounterService;
+
+class StatsCounterServiceFactory : public BrowserContextKeyedServiceFactory {
+ public:
+  static StatsCounterService* GetForBrowserContext(
+      content::BrowserContext* context);
+
+  static StatsCounterServiceFactory* GetInstance();
+
+ private:
+  friend struct base::DefaultSingletonTraits<StatsCounterServiceFactory>;
+
+  StatsCounterServiceFactory();
+  ~StatsCounterServiceFactory() override;
+
+  // BrowserContextKeyedServiceFactory:
+  KeyedService* BuildServiceInstanceFor(
+      content::BrowserContext* context) const override;
+
+  DISALLOW_COPY_AND_ASSIGN(StatsCounterServiceFactory);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_BROWSER_BRAVE_SHIELDS_STATS_COUNTER_SERVICE_FACTORY_H_
@@ -9,6 +9,7 @@
 
 #include "base/barrier_closure.h"
 #include "base/command_line.h"
+#include "base/rand_util.h"
 #include "base/system/sys_info.h"
 #include "bat/ads/pref_names.h"
 #include "brave/browser/brave_stats/brave_stats_updater_params.h"
@@ -27,12 +28,15 @@
 #include "components/prefs/pref_change_registrar.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
+#include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/load_flags.h"
+#include "net/base/network_isolation_key.h"
 #include "net/base/url_util.h"
 #include "net/http/http_response_headers.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
 #include "services/network/public/cpp/resource_request.h"
+#include "services/network/public/mojom/network_context.mojom.h"
 #include "services/network/public/cpp/simple_url_loader.h"
 #include "services/network/public/mojom/fetch_api.mojom-shared.h"
 
@@ -54,6 +58,11 @@ BraveStatsUpdater::StatsUpdatedCallback* g_testing_stats_threshold_callback =
 // Ping the update server shortly after startup.
 static constexpr int kUpdateServerStartupPingDelaySeconds = 3;
 
+// Spread first sends over this extra window so a fleet of machines that
+// restarts at the same moment doesn't synchronize its pings. The ping is
+// deduplicated per day, so the added delay doesn't change what is reported.
+static constexpr int kUpdateServerStartupPingJitterSeconds = 57;
+
 // Every five minutes, check if we need to ping the update server for
 // today.
 static constexpr int kUpdateServerPeriodicPingFrequencySeconds = 5 * 60;
@@ -151,7 +160,12 @@ void BraveStatsUpdater::Start() {
   DCHECK(!server_ping_startup_timer_);
   server_ping_startup_timer_ = std::make_unique<base::OneShotTimer>();
 
-  QueueServerPing();
+  // Profile creation is on the critical path to the first window; queue the
+  // ping preconditions only once the UI thread has nothing better to do.
+  content::GetUIThreadTaskRunner({base::TaskPriority::BEST_EFFORT})
+      ->PostTask(FROM_HERE,
+                 base::BindOnce(&BraveStatsUpdater::QueueServerPing,
+                                weak_ptr_factory_.GetWeakPtr()));
 
   // Periodic timer.
   DCHECK(!server_ping_periodic_timer_);
@@ -163,6 +177,7 @@ void BraveStatsUpdater::Start() {
 }
 
 void BraveStatsUpdater::Stop() {
+  weak_ptr_factory_.InvalidateWeakPtrs();
   server_ping_startup_timer_.reset();
   server_ping_periodic_timer_.reset();
 }
@@ -379,9 +394,23 @@ void BraveStatsUpdater::OnDetectUncertainFuture(
 
 void BraveStatsUpdater::StartServerPingStartupTimer() {
   stats_startup_complete_ = true;
+  int delay_seconds = kUpdateServerStartupPingDelaySeconds;
+  // Keep the short fixed delay when a custom stats server is given; tests
+  // point the updater at a local server and wait for this ping.
+  if (!base::CommandLine::ForCurrentProcess()->HasSwitch(
+          switches::kBraveStatsUpdaterServer)) {
+    delay_seconds += base::RandInt(0, kUpdateServerStartupPingJitterSeconds);
+  }
+  // Warm up the connection to the stats endpoint while waiting for the
+  // timer. Even when the preconnected socket does not survive until the
+  // ping fires, this leaves the resolved host and a TLS session behind, so
+  // the ping avoids a full connection setup.
+  g_browser_process->system_network_context_manager()
+      ->GetContext()
+      ->PreconnectSockets(1, BuildStatsEndpoint(kBraveUsageStandardPath),
+                          false, net::NetworkIsolationKey());
   server_ping_startup_timer_->Start(
-      FROM_HERE,
-      base::TimeDelta::FromSeconds(kUpdateServerStartupPingDelaySeconds), this,
+      FROM_HERE, base::TimeDelta::FromSeconds(delay_seconds), this,
       &BraveStatsUpdater::OnServerPingTimerFired);
 }
 
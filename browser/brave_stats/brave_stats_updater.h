@@ -12,6 +12,7 @@
 #include "base/callback.h"
 #include "base/macros.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 #include "brave/components/brave_stats/browser/brave_stats_updater_util.h"
 #include "chrome/browser/profiles/profile_manager_observer.h"
 #include "url/gurl.h"
@@ -99,6 +100,7 @@ class BraveStatsUpdater : public ProfileManagerObserver {
   std::unique_ptr<base::RepeatingTimer> server_ping_periodic_timer_;
   std::unique_ptr<PrefChangeRegistrar> pref_change_registrar_;
   base::RepeatingClosure stats_preconditions_barrier_;
+  base::WeakPtrFactory<BraveStatsUpdater> weak_ptr_factory_{this};
 
   DISALLOW_COPY_AND_ASSIGN(BraveStatsUpdater);
 };
@@ -900,19 +900,40 @@ BraveRewardsGetAllNotificationsFunction::
 
 ExtensionFunction::ResponseAction
 BraveRewardsGetAllNotificationsFunction::Run() {
+  std::unique_ptr<brave_rewards::GetAllNotifications::Params> params(
+      brave_rewards::GetAllNotifications::Params::Create(*args_));
+  EXTENSION_FUNCTION_VALIDATE(params.get());
+
   Profile* profile = Profile::FromBrowserContext(browser_context());
   RewardsService* rewards_service =
     RewardsServiceFactory::GetForProfile(profile);
 
   base::ListValue list;
+  std::string next_cursor;
 
   if (!rewards_service) {
-    return RespondNow(OneArgument(std::move(list)));
+    return RespondNow(
+        TwoArguments(std::move(list), base::Value(next_cursor)));
   }
 
+  const std::string cursor = params->cursor ? *params->cursor : "";
+  const size_t limit =
+      params->limit ? static_cast<size_t>(*params->limit) : 0;
+
   auto notifications = rewards_service->GetAllNotifications();
 
   for (auto const& notification : notifications) {
+    // The map is ordered by id, so everything at or before the cursor has
+    // already been returned
+    if (!cursor.empty() && notification.first <= cursor) {
+      continue;
+    }
+
+    if (limit != 0 && list.GetList().size() == limit) {
+      next_cursor = list.GetList().back().FindKey("id")->GetString();
+      break;
+    }
+
     auto item = std::make_unique<base::DictionaryValue>();
     item->SetString("id", notification.second.id_);
     item->SetInteger("type", notification.second.type_);
@@ -927,7 +948,7 @@ BraveRewardsGetAllNotificationsFunction::Run() {
     list.Append(std::move(item));
   }
 
-  return RespondNow(OneArgument(std::move(list)));
+  return RespondNow(TwoArguments(std::move(list), base::Value(next_cursor)));
 }
 
 BraveRewardsGetInlineTippingPlatformEnabledFunction::
@@ -557,6 +557,155 @@ BraveShieldsGetNoScriptControlTypeFunction::Run() {
   return RespondNow(OneArgument(base::Value(ControlTypeToString(type))));
 }
 
+ExtensionFunction::ResponseAction BraveShieldsGetShieldsStateFunction::Run() {
+  std::unique_ptr<brave_shields::GetShieldsState::Params> params(
+      brave_shields::GetShieldsState::Params::Create(*args_));
+  EXTENSION_FUNCTION_VALIDATE(params.get());
+
+  const GURL url(params->url);
+  // we don't allow getting defaults from the extension
+  if (url.is_empty() || !url.is_valid()) {
+    return RespondNow(Error(kInvalidUrlError, params->url));
+  }
+
+  Profile* profile = Profile::FromBrowserContext(browser_context());
+  HostContentSettingsMap* map =
+      HostContentSettingsMapFactory::GetForProfile(profile);
+
+  base::Value state(base::Value::Type::DICTIONARY);
+  state.SetBoolKey("braveShields",
+                   ::brave_shields::GetBraveShieldsEnabled(map, url));
+  state.SetStringKey(
+      "ads", ControlTypeToString(::brave_shields::GetAdControlType(map, url)));
+  state.SetStringKey(
+      "cosmeticFiltering",
+      ControlTypeToString(
+          ::brave_shields::GetCosmeticFilteringControlType(map, url)));
+  state.SetBoolKey(
+      "firstPartyCosmeticFiltering",
+      ::brave_shields::IsFirstPartyCosmeticFilteringEnabled(map, url));
+  state.SetStringKey(
+      "cookies",
+      ControlTypeToString(::brave_shields::GetCookieControlType(map, url)));
+  state.SetStringKey(
+      "fingerprinting",
+      ControlTypeToString(
+          ::brave_shields::GetFingerprintingControlType(map, url)));
+  state.SetBoolKey("httpsEverywhere",
+                   ::brave_shields::GetHTTPSEverywhereEnabled(map, url));
+  state.SetStringKey(
+      "noScript",
+      ControlTypeToString(::brave_shields::GetNoScriptControlType(map, url)));
+
+  return RespondNow(OneArgument(std::move(state)));
+}
+
+ExtensionFunction::ResponseAction BraveShieldsSetShieldsStateFunction::Run() {
+  std::unique_ptr<brave_shields::SetShieldsState::Params> params(
+      brave_shields::SetShieldsState::Params::Create(*args_));
+  EXTENSION_FUNCTION_VALIDATE(params.get());
+
+  const GURL url(params->url);
+  // we don't allow setting defaults from the extension
+  if (url.is_empty() || !url.is_valid()) {
+    return RespondNow(Error(kInvalidUrlError, params->url));
+  }
+
+  const auto& state = params->state;
+
+  // Validate every control type up front so the call is all or nothing
+  const std::string* control_type_strings[] = {
+      state.ads.get(), state.cosmetic_filtering.get(), state.cookies.get(),
+      state.fingerprinting.get(), state.no_script.get()};
+  for (const std::string* control_type_string : control_type_strings) {
+    if (control_type_string &&
+        ControlTypeFromString(*control_type_string) == ControlType::INVALID) {
+      return RespondNow(
+          Error(kInvalidControlTypeError, *control_type_string));
+    }
+  }
+
+  Profile* profile = Profile::FromBrowserContext(browser_context());
+  HostContentSettingsMap* map =
+      HostContentSettingsMapFactory::GetForProfile(profile);
+  PrefService* local_state = g_browser_process->local_state();
+
+  if (state.brave_shields) {
+    ::brave_shields::SetBraveShieldsEnabled(map, *state.brave_shields, url,
+                                            local_state);
+  }
+  if (state.ads) {
+    ::brave_shields::SetAdControlType(map, ControlTypeFromString(*state.ads),
+                                      url, local_state);
+  }
+  if (state.cosmetic_filtering) {
+    ::brave_shields::SetCosmeticFilteringControlType(
+        map, ControlTypeFromString(*state.cosmetic_filtering), url,
+        local_state);
+  }
+  if (state.cookies) {
+    ::brave_shields::SetCookieControlType(
+        map, ControlTypeFromString(*state.cookies), url, local_state);
+  }
+  if (state.fingerprinting) {
+    ::brave_shields::SetFingerprintingControlType(
+        map, ControlTypeFromString(*state.fingerprinting), url, local_state);
+  }
+  if (state.https_everywhere) {
+    ::brave_shields::SetHTTPSEverywhereEnabled(map, *state.https_everywhere,
+                                               url, local_state);
+  }
+  if (state.no_script) {
+    ::brave_shields::SetNoScriptControlType(
+        map, ControlTypeFromString(*state.no_script), url, local_state);
+  }
+
+  return RespondNow(NoArguments());
+}
+
+ExtensionFunction::ResponseAction BraveShieldsGetShieldsStatsFunction::Run() {
+  std::unique_ptr<brave_shields::GetShieldsStats::Params> params(
+      brave_shields::GetShieldsStats::Params::Create(*args_));
+  EXTENSION_FUNCTION_VALIDATE(params.get());
+
+  // Get web contents for this tab
+  content::WebContents* contents = nullptr;
+  if (!ExtensionTabUtil::GetTabById(
+          params->tab_id, Profile::FromBrowserContext(browser_context()),
+          include_incognito_information(), nullptr, nullptr, &contents,
+          nullptr)) {
+    return RespondNow(Error(tabs_constants::kTabNotFoundError,
+                            base::NumberToString(params->tab_id)));
+  }
+
+  base::Value counts(base::Value::Type::DICTIONARY);
+  base::Value hosts(base::Value::Type::LIST);
+  base::Value host_counts(base::Value::Type::DICTIONARY);
+  base::Value recently_blocked(base::Value::Type::LIST);
+  BraveShieldsWebContentsObserver* observer =
+      BraveShieldsWebContentsObserver::FromWebContents(contents);
+  if (observer) {
+    for (const auto& entry : observer->blocked_counts())
+      counts.SetIntKey(entry.first, static_cast<int>(entry.second));
+    const auto& blocked_hosts = observer->blocked_hosts();
+    const auto& blocked_host_counts = observer->blocked_host_counts();
+    for (size_t i = 0; i < blocked_hosts.size(); ++i) {
+      hosts.Append(blocked_hosts[i]);
+      host_counts.SetIntKey(blocked_hosts[i],
+                            static_cast<int>(blocked_host_counts[i]));
+    }
+    for (const auto& url : observer->recently_blocked_urls())
+      recently_blocked.Append(url);
+  }
+
+  base::Value stats(base::Value::Type::DICTIONARY);
+  stats.SetKey("blockedCounts", std::move(counts));
+  stats.SetKey("blockedHosts", std::move(hosts));
+  stats.SetKey("blockedHostCounts", std::move(host_counts));
+  stats.SetKey("recentlyBlocked", std::move(recently_blocked));
+  return RespondNow(OneArgument(std::move(stats)));
+}
+
 ExtensionFunction::ResponseAction
 BraveShieldsOnShieldsPanelShownFunction::Run() {
   ::brave_shields::MaybeRecordShieldsUsageP3A(::brave_shields::kClicked,
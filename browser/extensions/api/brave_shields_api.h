@@ -262,6 +262,42 @@ class BraveShieldsGetNoScriptControlTypeFunction : public ExtensionFunction {
   ResponseAction Run() override;
 };
 
+// Returns every per-site shields control in one call so the panel can
+// populate with a single IPC round trip instead of one per control.
+class BraveShieldsGetShieldsStateFunction : public ExtensionFunction {
+ public:
+  DECLARE_EXTENSION_FUNCTION("braveShields.getShieldsState", UNKNOWN)
+
+ protected:
+  ~BraveShieldsGetShieldsStateFunction() override {}
+
+  ResponseAction Run() override;
+};
+
+// Applies several per-site shields controls in one call; controls absent
+// from the state object are left unchanged.
+class BraveShieldsSetShieldsStateFunction : public ExtensionFunction {
+ public:
+  DECLARE_EXTENSION_FUNCTION("braveShields.setShieldsState", UNKNOWN)
+
+ protected:
+  ~BraveShieldsSetShieldsStateFunction() override {}
+
+  ResponseAction Run() override;
+};
+
+// Returns the preaggregated per-tab blocked-resource stats in one call, so
+// the panel does not have to accumulate per-resource onBlocked events.
+class BraveShieldsGetShieldsStatsFunction : public ExtensionFunction {
+ public:
+  DECLARE_EXTENSION_FUNCTION("braveShields.getShieldsStats", UNKNOWN)
+
+ protected:
+  ~BraveShieldsGetShieldsStatsFunction() override {}
+
+  ResponseAction Run() override;
+};
+
 // Notifies the browser that the shields panel was shown to the user.
 class BraveShieldsOnShieldsPanelShownFunction : public ExtensionFunction {
  public:
@@ -5,19 +5,27 @@
 
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "base/base64url.h"
+#include "base/containers/mru_cache.h"
 #include "base/feature_list.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/stringprintf.h"
+#include "base/synchronization/lock.h"
 #include "base/strings/string_util.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/url_constants.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "brave/components/brave_shields/browser/ad_block_base_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
 #include "brave/components/brave_shields/common/features.h"
@@ -68,6 +76,116 @@ void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
                     EngineFlags previous_result,
                     absl::optional<std::string> cname);
 
+// A classification queued while a batch task is already pending on the
+// adblock task runner. Requests that arrive in a burst (e.g. the subresources
+// of a page load) are drained together and classified in a single engine
+// crossing rather than one task-post and FFI call each.
+struct PendingAdBlockRequest {
+  ResponseCallback next_callback;
+  std::shared_ptr<BraveRequestInfo> ctx;
+  bool should_check_uncloaked = false;
+  EngineFlags result;
+};
+
+base::Lock& PendingAdBlockRequestsLock() {
+  static base::NoDestructor<base::Lock> lock;
+  return *lock;
+}
+
+// A settled classification for a (profile, initiator host, request URL,
+// resource type) tuple. Verdicts are tagged with the adblock engine
+// generation they were computed against, so filter list updates invalidate
+// them implicitly; stale entries age out of the MRU cache.
+struct AdBlockVerdict {
+  uint64_t engine_generation = 0;
+  BlockedBy blocked_by = kNotBlocked;
+  std::string mock_data_url;
+};
+
+constexpr size_t kAdBlockVerdictCacheSize = 512;
+
+// UI-thread only.
+base::HashingMRUCache<std::string, AdBlockVerdict>& AdBlockVerdictCache() {
+  static base::NoDestructor<base::HashingMRUCache<std::string, AdBlockVerdict>>
+      cache(kAdBlockVerdictCacheSize);
+  return *cache;
+}
+
+// UI-thread only.
+AdBlockVerdictCacheStats& VerdictCacheStats() {
+  static base::NoDestructor<AdBlockVerdictCacheStats> stats;
+  return *stats;
+}
+
+std::string AdBlockVerdictCacheKey(const BraveRequestInfo& ctx) {
+  // The browser context distinguishes profiles (and Tor), whose uncloaking
+  // and engine behaviour can differ.
+  std::string key = base::StringPrintf("%p", ctx.browser_context);
+  key += '\n';
+  key += ctx.initiator_url.host();
+  key += '\n';
+  key += ctx.request_url.spec();
+  key += '\n';
+  key += base::NumberToString(static_cast<int>(ctx.resource_type));
+  return key;
+}
+
+// A request waiting on an identical classification that is already in
+// flight. The speculative fetch issued from the preload scanner and the
+// parser-driven fetch for the same resource often arrive back to back;
+// the second one attaches here and reuses the first one's verdict instead
+// of crossing the engine again.
+struct PendingAdBlockFollower {
+  ResponseCallback next_callback;
+  std::shared_ptr<BraveRequestInfo> ctx;
+};
+
+// UI-thread only. An entry (possibly with no followers yet) exists for every
+// classification currently in flight, keyed like the verdict cache.
+std::map<std::string, std::vector<PendingAdBlockFollower>>&
+InFlightAdBlockRequests() {
+  static base::NoDestructor<
+      std::map<std::string, std::vector<PendingAdBlockFollower>>>
+      requests;
+  return *requests;
+}
+
+void StoreAdBlockVerdict(const std::shared_ptr<BraveRequestInfo>& ctx) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  const std::string key = AdBlockVerdictCacheKey(*ctx);
+  AdBlockVerdict verdict;
+  verdict.engine_generation =
+      brave_shields::AdBlockBaseService::engine_generation();
+  verdict.blocked_by = ctx->blocked_by;
+  verdict.mock_data_url = ctx->mock_data_url;
+  AdBlockVerdictCache().Put(key, std::move(verdict));
+
+  // Settle any requests that attached to this classification while it was
+  // in flight.
+  auto in_flight = InFlightAdBlockRequests().find(key);
+  if (in_flight == InFlightAdBlockRequests().end()) {
+    return;
+  }
+  std::vector<PendingAdBlockFollower> followers =
+      std::move(in_flight->second);
+  InFlightAdBlockRequests().erase(in_flight);
+  for (PendingAdBlockFollower& follower : followers) {
+    follower.ctx->blocked_by = ctx->blocked_by;
+    follower.ctx->mock_data_url = ctx->mock_data_url;
+    if (follower.ctx->blocked_by == kAdBlocked) {
+      brave_shields::BraveShieldsWebContentsObserver::DispatchBlockedEvent(
+          follower.ctx->request_url, follower.ctx->frame_tree_node_id,
+          brave_shields::kAds);
+    }
+    follower.next_callback.Run();
+  }
+}
+
+std::vector<PendingAdBlockRequest>& PendingAdBlockRequests() {
+  static base::NoDestructor<std::vector<PendingAdBlockRequest>> requests;
+  return *requests;
+}
+
 class AdblockCnameResolveHostClient : public network::mojom::ResolveHostClient {
  private:
   mojo::Receiver<network::mojom::ResolveHostClient> receiver_{this};
@@ -192,6 +310,57 @@ EngineFlags ShouldBlockRequestOnTaskRunner(
   return previous_result;
 }
 
+// Drains all queued classifications and runs them through the adblock
+// engines as one batch.
+std::vector<PendingAdBlockRequest> ProcessAdBlockBatchOnTaskRunner() {
+  std::vector<PendingAdBlockRequest> batch;
+  {
+    base::AutoLock lock(PendingAdBlockRequestsLock());
+    batch.swap(PendingAdBlockRequests());
+  }
+
+  std::vector<adblock::MatchQuery> queries;
+  std::vector<size_t> query_indices;
+  for (size_t i = 0; i < batch.size(); i++) {
+    const auto& ctx = batch[i].ctx;
+    if (!ctx->initiator_url.is_valid()) {
+      continue;
+    }
+    adblock::MatchQuery query;
+    query.url = ctx->request_url.spec();
+    query.host = ctx->request_url.host();
+    query.tab_host = ctx->initiator_url.host();
+    query.is_third_party = ctx->request_url_etld1 != ctx->initiator_url_etld1;
+    query.resource_type = brave_shields::ResourceTypeToString(
+        ctx->resource_type);
+    queries.push_back(std::move(query));
+    query_indices.push_back(i);
+  }
+
+  std::vector<adblock::MatchResult> results(queries.size());
+  if (!queries.empty()) {
+    g_brave_browser_process->ad_block_service()->ShouldStartRequestBatch(
+        queries, &results);
+  }
+
+  for (size_t i = 0; i < queries.size(); i++) {
+    PendingAdBlockRequest& request = batch[query_indices[i]];
+    request.result.did_match_rule = results[i].did_match_rule;
+    request.result.did_match_exception = results[i].did_match_exception;
+    request.result.did_match_important = results[i].did_match_important;
+    if (!results[i].redirect.empty()) {
+      request.ctx->mock_data_url = results[i].redirect;
+    }
+    if (request.result.did_match_important ||
+        (request.result.did_match_rule &&
+         !request.result.did_match_exception)) {
+      request.ctx->blocked_by = kAdBlocked;
+    }
+  }
+
+  return batch;
+}
+
 void OnShouldBlockRequestResult(
     bool then_check_uncloaked,
     scoped_refptr<base::SequencedTaskRunner> task_runner,
@@ -200,6 +369,7 @@ void OnShouldBlockRequestResult(
     EngineFlags result) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   if (ctx->blocked_by == kAdBlocked) {
+    StoreAdBlockVerdict(ctx);
     brave_shields::BraveShieldsWebContentsObserver::DispatchBlockedEvent(
         ctx->request_url, ctx->frame_tree_node_id, brave_shields::kAds);
   } else if (then_check_uncloaked) {
@@ -207,10 +377,23 @@ void OnShouldBlockRequestResult(
     new AdblockCnameResolveHostClient(std::move(next_callback), task_runner,
                                       ctx, result);
     return;
+  } else {
+    StoreAdBlockVerdict(ctx);
   }
   next_callback.Run();
 }
 
+void OnAdBlockBatchResults(
+    scoped_refptr<base::SequencedTaskRunner> task_runner,
+    std::vector<PendingAdBlockRequest> batch) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  for (PendingAdBlockRequest& request : batch) {
+    OnShouldBlockRequestResult(request.should_check_uncloaked, task_runner,
+                               std::move(request.next_callback), request.ctx,
+                               request.result);
+  }
+}
+
 void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
                     const ResponseCallback& next_callback,
                     std::shared_ptr<BraveRequestInfo> ctx,
@@ -232,6 +415,7 @@ void UseCnameResult(scoped_refptr<base::SequencedTaskRunner> task_runner,
         base::BindOnce(&OnShouldBlockRequestResult, false, task_runner,
                        next_callback, ctx));
   } else {
+    StoreAdBlockVerdict(ctx);
     next_callback.Run();
   }
 }
@@ -271,13 +455,48 @@ bool ProxySettingsAllowUncloaking(content::BrowserContext* browser_context) {
   return can_uncloak;
 }
 
-void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
+// Returns true when the request was answered synchronously from the
+// verdict cache; |next_callback| is untouched in that case.
+bool OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
                                  std::shared_ptr<BraveRequestInfo> ctx) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
   DCHECK_NE(ctx->request_identifier, 0UL);
   DCHECK(!ctx->request_url.is_empty());
   DCHECK(!ctx->initiator_url.is_empty());
 
+  // Most classifications within a session are repeats of earlier ones, so
+  // try the cache before paying for a task-runner round trip and engine
+  // match.
+  const std::string cache_key = AdBlockVerdictCacheKey(*ctx);
+  auto cached = AdBlockVerdictCache().Get(cache_key);
+  if (cached != AdBlockVerdictCache().end() &&
+      cached->second.engine_generation ==
+          brave_shields::AdBlockBaseService::engine_generation()) {
+    VerdictCacheStats().hits++;
+    ctx->blocked_by = cached->second.blocked_by;
+    ctx->mock_data_url = cached->second.mock_data_url;
+    if (ctx->blocked_by == kAdBlocked) {
+      brave_shields::BraveShieldsWebContentsObserver::DispatchBlockedEvent(
+          ctx->request_url, ctx->frame_tree_node_id, brave_shields::kAds);
+    }
+    return true;
+  }
+
+  // A classification for the same tuple may already be in flight, typically
+  // the speculative preload fetch racing the parser-driven fetch for the
+  // same resource. Attach to it instead of classifying twice; the verdict
+  // is applied to every waiter when it settles.
+  auto in_flight = InFlightAdBlockRequests().find(cache_key);
+  if (in_flight != InFlightAdBlockRequests().end()) {
+    VerdictCacheStats().coalesced++;
+    in_flight->second.push_back({next_callback, ctx});
+    return false;
+  }
+  VerdictCacheStats().misses++;
+  // Mark this classification as in flight so duplicates can attach to it.
+  InFlightAdBlockRequests().emplace(cache_key,
+                                    std::vector<PendingAdBlockFollower>());
+
   scoped_refptr<base::SequencedTaskRunner> task_runner =
       g_brave_browser_process->ad_block_service()->GetTaskRunner();
 
@@ -290,12 +509,25 @@ void OnBeforeURLRequestAdBlockTP(const ResponseCallback& next_callback,
       ctx->browser_context && !ctx->browser_context->IsTor() &&
       ProxySettingsAllowUncloaking(ctx->browser_context);
 
-  task_runner->PostTaskAndReplyWithResult(
-      FROM_HERE,
-      base::BindOnce(&ShouldBlockRequestOnTaskRunner, ctx, EngineFlags(),
-                     absl::nullopt),
-      base::BindOnce(&OnShouldBlockRequestResult, should_check_uncloaked,
-                     task_runner, next_callback, ctx));
+  PendingAdBlockRequest request;
+  request.next_callback = next_callback;
+  request.ctx = ctx;
+  request.should_check_uncloaked = should_check_uncloaked;
+
+  bool should_post_drain = false;
+  {
+    base::AutoLock lock(PendingAdBlockRequestsLock());
+    should_post_drain = PendingAdBlockRequests().empty();
+    PendingAdBlockRequests().push_back(std::move(request));
+  }
+  // Requests that arrive before the drain task runs are picked up by the
+  // same batch; only the first request in a burst pays for a task post.
+  if (should_post_drain) {
+    task_runner->PostTaskAndReplyWithResult(
+        FROM_HERE, base::BindOnce(&ProcessAdBlockBatchOnTaskRunner),
+        base::BindOnce(&OnAdBlockBatchResults, task_runner));
+  }
+  return false;
 }
 
 int OnBeforeURLRequest_AdBlockTPPreWork(const ResponseCallback& next_callback,
@@ -325,9 +557,17 @@ int OnBeforeURLRequest_AdBlockTPPreWork(const ResponseCallback& next_callback,
     return net::OK;
   }
 
-  OnBeforeURLRequestAdBlockTP(next_callback, ctx);
+  if (OnBeforeURLRequestAdBlockTP(next_callback, ctx)) {
+    // Answered from the verdict cache.
+    return net::OK;
+  }
 
   return net::ERR_IO_PENDING;
 }
 
+AdBlockVerdictCacheStats GetAdBlockVerdictCacheStats() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  return VerdictCacheStats();
+}
+
 }  // namespace brave
@@ -20,6 +20,17 @@ int OnBeforeURLRequest_AdBlockTPPreWork(
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx);
 
+// Session counters for the verdict cache in front of the adblock engines,
+// surfaced on brave://adblock. UI thread only.
+struct AdBlockVerdictCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+  // Requests that attached to an identical classification already in flight
+  // instead of crossing the engine again.
+  uint64_t coalesced = 0;
+};
+AdBlockVerdictCacheStats GetAdBlockVerdictCacheStats();
+
 // Be sure to reset this to `nullptr` when done testing to prevent future tests
 // from being affected.
 void SetAdblockCnameHostResolverForTesting(
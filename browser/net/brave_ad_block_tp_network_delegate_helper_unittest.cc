@@ -9,12 +9,12 @@
 #include <string>
 #include <utility>
 
-#include "base/threading/thread_task_runner_handle.h"
 #include "brave/browser/brave_browser_process.h"
 #include "brave/browser/net/url_context.h"
 #include "brave/common/network_constants.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/test/base/testing_brave_browser_process.h"
+#include "brave/test/base/testing_brave_component_updater_delegate.h"
 #include "content/public/test/browser_task_environment.h"
 #include "net/base/net_errors.h"
 #include "net/dns/mock_host_resolver.h"
@@ -24,49 +24,6 @@
 
 using brave::ResponseCallback;
 
-namespace {
-
-// Note: extract a common impl if needed for other tests, do not copy.
-
-// TODO(iefremov): This is only needed to provide a task runner to the adblock
-// service. We can drop this stub once the service doesn't need an
-// "external" runner.
-class TestingBraveComponentUpdaterDelegate : public BraveComponent::Delegate {
- public:
-  TestingBraveComponentUpdaterDelegate() = default;
-  ~TestingBraveComponentUpdaterDelegate() override = default;
-
-  TestingBraveComponentUpdaterDelegate(TestingBraveComponentUpdaterDelegate&) =
-      delete;
-  TestingBraveComponentUpdaterDelegate& operator=(
-      TestingBraveComponentUpdaterDelegate&) = delete;
-
-  using ComponentObserver = update_client::UpdateClient::Observer;
-
-  // brave_component_updater::BraveComponent::Delegate implementation
-  void Register(const std::string& component_name,
-                const std::string& component_base64_public_key,
-                base::OnceClosure registered_callback,
-                BraveComponent::ReadyCallback ready_callback) override {}
-  bool Unregister(const std::string& component_id) override { return true; }
-  void OnDemandUpdate(const std::string& component_id) override {}
-
-  void AddObserver(ComponentObserver* observer) override {}
-  void RemoveObserver(ComponentObserver* observer) override {}
-
-  scoped_refptr<base::SequencedTaskRunner> GetTaskRunner() override {
-    return base::ThreadTaskRunnerHandle::Get();
-  }
-
-  const std::string locale() const override { return "en"; }
-  PrefService* local_state() override {
-    NOTREACHED();
-    return nullptr;
-  }
-};
-
-}  // namespace
-
 class BraveAdBlockTPNetworkDelegateHelperTest : public testing::Test {
  protected:
   void SetUp() override {
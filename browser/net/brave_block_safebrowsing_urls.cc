@@ -7,6 +7,8 @@
 
 #include <vector>
 
+#include "base/no_destructor.h"
+#include "brave/browser/net/brave_host_suffix_matcher.h"
 #include "extensions/common/url_pattern.h"
 #include "net/base/net_errors.h"
 #include "url/gurl.h"
@@ -16,6 +18,14 @@ namespace brave {
 const char kDummyUrl[] = "https://no-thanks.invalid";
 
 bool IsSafeBrowsingReportingURL(const GURL& gurl) {
+  // One trie walk over the host rules out nearly every request before the
+  // more expensive URLPattern checks run.
+  static const base::NoDestructor<HostSuffixMatcher> reporting_hosts(
+      std::initializer_list<base::StringPiece>{"sb-ssl.google.com",
+                                               "safebrowsing.google.com"});
+  if (!reporting_hosts->Matches(gurl.host_piece()))
+    return false;
+
   static const std::vector<URLPattern> allowed_patterns({
       URLPattern(
           URLPattern::SCHEME_HTTPS,
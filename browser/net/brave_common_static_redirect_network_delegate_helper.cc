@@ -11,8 +11,11 @@
 
 #include "base/command_line.h"
 #include "base/feature_list.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
+#include "brave/browser/net/brave_host_suffix_matcher.h"
 #include "brave/common/network_constants.h"
 #include "brave/components/brave_component_updater/browser/features.h"
 #include "brave/components/brave_component_updater/browser/switches.h"
@@ -51,7 +54,7 @@ std::string GetUpdateURLHost() {
 // installed extensions. Update server checks happen from the system context for
 // normal update operations.
 bool IsUpdaterURL(const GURL& gurl) {
-  static std::vector<URLPattern> updater_patterns(
+  static const base::NoDestructor<std::vector<URLPattern>> updater_patterns(
       {URLPattern(URLPattern::SCHEME_HTTPS,
                   std::string(component_updater::kUpdaterJSONDefaultUrl) + "*"),
        URLPattern(
@@ -64,8 +67,31 @@ bool IsUpdaterURL(const GURL& gurl) {
 #endif
   });
   return std::any_of(
-      updater_patterns.begin(), updater_patterns.end(),
-      [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
+      updater_patterns->begin(), updater_patterns->end(),
+      [&gurl](const URLPattern& pattern) { return pattern.MatchesURL(gurl); });
+}
+
+// Every rewrite in this helper targets one of these hosts; a single trie
+// walk rules out all other requests before any URLPattern check runs. The
+// updater hosts are derived from the same constants the patterns are built
+// from, so the gate can't drift out of sync with them.
+const HostSuffixMatcher& CommonRedirectHosts() {
+  static const std::string updater_host =
+      GURL(component_updater::kUpdaterJSONDefaultUrl).host();
+  static const std::string updater_fallback_host =
+      GURL(component_updater::kUpdaterJSONFallbackUrl).host();
+#if BUILDFLAG(ENABLE_EXTENSIONS)
+  static const std::string webstore_update_host =
+      GURL(extension_urls::kChromeWebstoreUpdateURL).host();
+#endif
+  static const base::NoDestructor<HostSuffixMatcher> matcher(
+      std::initializer_list<base::StringPiece>{
+          updater_host, updater_fallback_host,
+#if BUILDFLAG(ENABLE_EXTENSIONS)
+          webstore_update_host,
+#endif
+          "gvt1.com", "clients4.google.com", "bugs.chromium.org"});
+  return *matcher;
 }
 
 bool RewriteBugReportingURL(const GURL& request_url, GURL* new_url) {
@@ -115,6 +141,9 @@ int OnBeforeURLRequest_CommonStaticRedirectWorkForGURL(
     GURL* new_url) {
   DCHECK(new_url);
 
+  if (!CommonRedirectHosts().Matches(request_url.host_piece()))
+    return net::OK;
+
   GURL::Replacements replacements;
   static URLPattern chromecast_pattern(
       URLPattern::SCHEME_HTTP | URLPattern::SCHEME_HTTPS, kChromeCastPrefix);
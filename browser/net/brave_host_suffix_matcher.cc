@@ -0,0 +1,67 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_host_suffix_matcher.h"
+
+#include <utility>
+
+namespace brave {
+
+HostSuffixMatcher::Node::Node() = default;
+HostSuffixMatcher::Node::~Node() = default;
+
+HostSuffixMatcher::HostSuffixMatcher(
+    std::initializer_list<base::StringPiece> suffixes) {
+  for (base::StringPiece suffix : suffixes)
+    Insert(suffix);
+}
+
+HostSuffixMatcher::~HostSuffixMatcher() = default;
+
+void HostSuffixMatcher::Insert(base::StringPiece suffix) {
+  Node* node = &root_;
+  size_t end = suffix.size();
+  while (end > 0) {
+    const size_t dot = suffix.rfind('.', end - 1);
+    const size_t begin = (dot == base::StringPiece::npos) ? 0 : dot + 1;
+    std::string label(suffix.substr(begin, end - begin));
+    auto it = node->children.find(label);
+    if (it == node->children.end()) {
+      it = node->children
+               .emplace(std::move(label), std::make_unique<Node>())
+               .first;
+    }
+    node = it->second.get();
+    if (begin == 0)
+      break;
+    end = dot;
+  }
+  node->terminal = true;
+}
+
+bool HostSuffixMatcher::Matches(base::StringPiece host) const {
+  // Ignore the trailing dot of fully-qualified hosts.
+  if (!host.empty() && host.back() == '.')
+    host.remove_suffix(1);
+
+  const Node* node = &root_;
+  size_t end = host.size();
+  while (end > 0) {
+    const size_t dot = host.rfind('.', end - 1);
+    const size_t begin = (dot == base::StringPiece::npos) ? 0 : dot + 1;
+    auto it = node->children.find(host.substr(begin, end - begin));
+    if (it == node->children.end())
+      return false;
+    node = it->second.get();
+    if (node->terminal)
+      return true;
+    if (begin == 0)
+      return false;
+    end = dot;
+  }
+  return false;
+}
+
+}  // namespace brave
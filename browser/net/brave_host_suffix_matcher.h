@@ -0,0 +1,51 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_NET_BRAVE_HOST_SUFFIX_MATCHER_H_
+#define BRAVE_BROWSER_NET_BRAVE_HOST_SUFFIX_MATCHER_H_
+
+#include <initializer_list>
+#include <memory>
+#include <string>
+
+#include "base/containers/flat_map.h"
+#include "base/strings/string_piece.h"
+
+namespace brave {
+
+// Matches a host against a fixed set of host suffixes in a single walk over
+// the host's dot-separated labels, instead of one string comparison per
+// listed host. Suffixes match on label boundaries only: "gvt1.com" matches
+// "gvt1.com" and "redirector.gvt1.com" but not "notgvt1.com". Intended to
+// be built once (e.g. in a function-local static) and used as a cheap gate
+// in front of more precise URLPattern checks.
+class HostSuffixMatcher {
+ public:
+  explicit HostSuffixMatcher(std::initializer_list<base::StringPiece> suffixes);
+  HostSuffixMatcher(const HostSuffixMatcher&) = delete;
+  HostSuffixMatcher& operator=(const HostSuffixMatcher&) = delete;
+  ~HostSuffixMatcher();
+
+  // Returns true if |host| equals one of the suffixes or ends with a
+  // "." followed by one of them.
+  bool Matches(base::StringPiece host) const;
+
+ private:
+  // Trie over host labels in reverse order ("com" -> "google" -> ...).
+  struct Node {
+    Node();
+    ~Node();
+    base::flat_map<std::string, std::unique_ptr<Node>> children;
+    bool terminal = false;
+  };
+
+  void Insert(base::StringPiece suffix);
+
+  Node root_;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_BROWSER_NET_BRAVE_HOST_SUFFIX_MATCHER_H_
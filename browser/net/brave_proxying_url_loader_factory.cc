@@ -532,6 +532,32 @@ void BraveProxyingURLLoaderFactory::InProgressRequest::
 
   proxied_client_receiver_.Resume();
   target_client_->OnReceiveResponse(std::move(current_response_));
+
+  MaybeFusePassThrough();
+}
+
+void BraveProxyingURLLoaderFactory::InProgressRequest::MaybeFusePassThrough() {
+  // Once the response has started and no helper rewrote it, this proxy no
+  // longer adds anything: the remaining URLLoader / URLLoaderClient traffic
+  // (body data pipe, transfer size updates, completion) would just be
+  // forwarded untouched, one browser-process hop per message. Fuse both
+  // pipe pairs so that traffic flows directly between the network service
+  // and the renderer, then drop |this|. Fused requests skip the
+  // TotalRequestTime histogram and the blocked-element collapse handling,
+  // neither of which applies to an untouched response.
+  if (!target_loader_.is_bound() || !proxied_loader_receiver_.is_bound() ||
+      !proxied_client_receiver_.is_bound() || !target_client_.is_bound()) {
+    return;
+  }
+  if (pending_follow_redirect_params_) {
+    return;
+  }
+
+  mojo::FusePipes(proxied_loader_receiver_.Unbind(), target_loader_.Unbind());
+  mojo::FusePipes(proxied_client_receiver_.Unbind(), target_client_.Unbind());
+
+  // Deletes |this|.
+  factory_->RemoveRequest(this);
 }
 
 void BraveProxyingURLLoaderFactory::InProgressRequest::ContinueToBeforeRedirect(
@@ -109,6 +109,7 @@ class BraveProxyingURLLoaderFactory
         net::CompletionOnceCallback continuation);
     void OnRequestError(const network::URLLoaderCompletionStatus& status);
     void HandleBeforeRequestRedirect();
+    void MaybeFusePassThrough();
 
     base::TimeTicks start_time_;
 
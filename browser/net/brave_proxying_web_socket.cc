@@ -202,10 +202,15 @@ void BraveProxyingWebSocket::OnConnectionEstablished(
   DCHECK(forwarding_handshake_client_);
   DCHECK(!is_done_);
   remote_endpoint_ = response->remote_endpoint;
+  // This is where the proxy leaves the connection: the WebSocket remote and
+  // both data pipes are handed straight to the renderer, so frames flow
+  // between the renderer and the network service without a per-frame hop
+  // through the browser process.
   forwarding_handshake_client_->OnConnectionEstablished(
       std::move(websocket), std::move(client_receiver), std::move(response),
       std::move(readable), std::move(writable));
 
+  // Deletes |this|; nothing is left to proxy after the handshake.
   OnError(net::ERR_FAILED);
 }
 
@@ -0,0 +1,112 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <memory>
+#include <string>
+
+#include "base/cxx17_backports.h"
+#include "base/timer/elapsed_timer.h"
+#include "brave/browser/net/brave_common_static_redirect_network_delegate_helper.h"
+#include "brave/browser/net/brave_translate_redirect_network_delegate_helper.h"
+#include "brave/browser/net/url_context.h"
+#include "brave/common/translate_network_constants.h"
+#include "net/base/net_errors.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
+
+namespace {
+
+constexpr int kRequestsPerCorpus = 100000;
+
+// Recorded translate requests as issued by a page with the translate
+// element active. All of these are rewritten to the Brave translate relay.
+const char* const kTranslateEligibleCorpus[] = {
+    "https://translate.googleapis.com/element/TE_20181015_01/e/js/element/"
+    "element_main.js",
+    "https://translate.googleapis.com/translate_static/js/element/main.js",
+    "https://translate.googleapis.com/translate_static/css/translateelement."
+    "css",
+    "https://translate.googleapis.com/translate_a/l?client=te_lib&alpha=true",
+    "https://translate.googleapis.com/translate_a/t?anno=3&client=te_lib",
+    "https://translate.googleapis.com/gen204?nca=te_li",
+};
+
+// Recorded component updater and other Google endpoint requests that the
+// common static redirect helper rewrites.
+const char* const kCommonRedirectEligibleCorpus[] = {
+    "https://update.googleapis.com/service/update2/json?cup2key=10",
+    "https://redirector.gvt1.com/edgedl/release2/chrome_component/"
+    "adwaficpmcbnhbnkmpnmfibmamjebghj_1.0.0.3.crx3",
+    "https://clients4.google.com/chrome-sync/event",
+    "https://bugs.chromium.org/p/chromium/issues/entry?comment=a&template=b&"
+    "labels=c",
+};
+
+// Ordinary page subresources; neither helper should touch these, so this
+// measures the cost the helpers add to every request that is not eligible.
+const char* const kPassThroughCorpus[] = {
+    "https://news.example.com/static/js/main.js",
+    "https://cdn.example.com/images/lead-story.jpg",
+    "https://api.example.com/v1/articles?page=1",
+    "https://fonts.gstatic.com/s/roboto/v20/KFOmCnqEu92Fr1Mu4mxK.woff2",
+    "https://www.youtube.com/embed/dQw4w9WgXcQ",
+    "https://cdn.example.com/fonts/headline.woff2",
+};
+
+using RedirectWorkFunction = int (*)(const brave::ResponseCallback&,
+                                     std::shared_ptr<brave::BraveRequestInfo>);
+
+// Replays kRequestsPerCorpus requests cycling through |corpus| against
+// |work| and reports the mean wall time per request. A fresh request info
+// is built per iteration, as the delegate chain does for real requests.
+void RunCorpus(const std::string& story,
+               RedirectWorkFunction work,
+               const char* const* corpus,
+               size_t corpus_size) {
+  base::ElapsedTimer timer;
+  for (int i = 0; i < kRequestsPerCorpus; i++) {
+    const GURL url(corpus[i % corpus_size]);
+    auto ctx = std::make_shared<brave::BraveRequestInfo>(url);
+    ctx->initiator_url = GURL(kTranslateInitiatorURL);
+
+    int rc = work(brave::ResponseCallback(), ctx);
+    ASSERT_EQ(rc, net::OK);
+  }
+  const base::TimeDelta elapsed = timer.Elapsed();
+
+  perf_test::PerfResultReporter reporter("BraveRedirectHelpers.", story);
+  reporter.RegisterImportantMetric("wall_time_per_request", "ns");
+  reporter.AddResult(
+      "wall_time_per_request",
+      elapsed.InNanoseconds() / static_cast<double>(kRequestsPerCorpus));
+}
+
+}  // namespace
+
+TEST(BraveRedirectHelpersPerfTest, TranslateEligible) {
+  RunCorpus("translate_eligible",
+            &brave::OnBeforeURLRequest_TranslateRedirectWork,
+            kTranslateEligibleCorpus, base::size(kTranslateEligibleCorpus));
+}
+
+TEST(BraveRedirectHelpersPerfTest, TranslatePassThrough) {
+  RunCorpus("translate_pass_through",
+            &brave::OnBeforeURLRequest_TranslateRedirectWork,
+            kPassThroughCorpus, base::size(kPassThroughCorpus));
+}
+
+TEST(BraveRedirectHelpersPerfTest, CommonRedirectEligible) {
+  RunCorpus("common_redirect_eligible",
+            &brave::OnBeforeURLRequest_CommonStaticRedirectWork,
+            kCommonRedirectEligibleCorpus,
+            base::size(kCommonRedirectEligibleCorpus));
+}
+
+TEST(BraveRedirectHelpersPerfTest, CommonRedirectPassThrough) {
+  RunCorpus("common_redirect_pass_through",
+            &brave::OnBeforeURLRequest_CommonStaticRedirectWork,
+            kPassThroughCorpus, base::size(kPassThroughCorpus));
+}
@@ -11,6 +11,7 @@
 #include "base/feature_list.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/task/post_task.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/browser/net/brave_ad_block_csp_network_delegate_helper.h"
 #include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/browser/net/brave_common_static_redirect_network_delegate_helper.h"
@@ -74,41 +75,42 @@ BraveRequestHandler::BraveRequestHandler() {
 BraveRequestHandler::~BraveRequestHandler() = default;
 
 void BraveRequestHandler::SetupCallbacks() {
-  brave::OnBeforeURLRequestCallback callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback = base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback = base::BindRepeating(brave::OnBeforeURLRequest_HttpsePreFileWork);
-  before_url_request_callbacks_.push_back(callback);
-
-  callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_CommonStaticRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  // Site hacks may rewrite |request_url| query parameters, which every
+  // later helper reads, so they settle alone first.
+  before_url_request_stages_.push_back(
+      {base::BindRepeating(brave::OnBeforeURLRequest_SiteHacksWork)});
+
+  // Adblock writes |blocked_by| and |mock_data_url| while HTTPSE writes
+  // |new_url_spec|; the write sets are disjoint, so both engine lookups
+  // proceed concurrently on their task runners instead of queueing.
+  before_url_request_stages_.push_back(
+      {base::BindRepeating(brave::OnBeforeURLRequest_AdBlockTPPreWork),
+       base::BindRepeating(brave::OnBeforeURLRequest_HttpsePreFileWork)});
+
+  // The remaining helpers may all read and write |new_url_spec|, so they
+  // keep their relative order, one per stage.
+  before_url_request_stages_.push_back({base::BindRepeating(
+      brave::OnBeforeURLRequest_CommonStaticRedirectWork)});
 
 #if BUILDFLAG(DECENTRALIZED_DNS_ENABLED) && BUILDFLAG(BRAVE_WALLET_ENABLED)
-  callback = base::BindRepeating(
-      decentralized_dns::OnBeforeURLRequest_DecentralizedDnsPreRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  before_url_request_stages_.push_back({base::BindRepeating(
+      decentralized_dns::OnBeforeURLRequest_DecentralizedDnsPreRedirectWork)});
 #endif
 
 #if BUILDFLAG(BRAVE_REWARDS_ENABLED)
-  callback = base::BindRepeating(brave_rewards::OnBeforeURLRequest);
-  before_url_request_callbacks_.push_back(callback);
+  before_url_request_stages_.push_back(
+      {base::BindRepeating(brave_rewards::OnBeforeURLRequest)});
 #endif
 
 #if BUILDFLAG(ENABLE_BRAVE_TRANSLATE_GO)
-  callback =
-      base::BindRepeating(brave::OnBeforeURLRequest_TranslateRedirectWork);
-  before_url_request_callbacks_.push_back(callback);
+  before_url_request_stages_.push_back({base::BindRepeating(
+      brave::OnBeforeURLRequest_TranslateRedirectWork)});
 #endif
 
 #if BUILDFLAG(IPFS_ENABLED)
   if (base::FeatureList::IsEnabled(ipfs::features::kIpfsFeature)) {
-    callback = base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork);
-    before_url_request_callbacks_.push_back(callback);
+    before_url_request_stages_.push_back(
+        {base::BindRepeating(ipfs::OnBeforeURLRequest_IPFSRedirectWork)});
     brave::OnHeadersReceivedCallback ipfs_headers_received_callback =
         base::BindRepeating(ipfs::OnHeadersReceived_IPFSRedirectWork);
     headers_received_callbacks_.push_back(ipfs_headers_received_callback);
@@ -156,14 +158,18 @@ int BraveRequestHandler::OnBeforeURLRequest(
     std::shared_ptr<brave::BraveRequestInfo> ctx,
     net::CompletionOnceCallback callback,
     GURL* new_url) {
-  if (before_url_request_callbacks_.empty() || IsInternalScheme(ctx)) {
+  if (before_url_request_stages_.empty() || IsInternalScheme(ctx)) {
     return net::OK;
   }
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.OnBeforeURLRequest_Handler");
+  TRACE_EVENT_NESTABLE_ASYNC_BEGIN1(
+      "brave.shields", "BraveRequestHandler::OnBeforeURLRequest",
+      TRACE_ID_LOCAL(ctx->request_identifier), "url",
+      ctx->request_url.possibly_invalid_spec());
   ctx->new_url = new_url;
   ctx->event_type = brave::kOnBeforeRequest;
   callbacks_[ctx->request_identifier] = std::move(callback);
-  RunNextCallback(ctx);
+  RunNextStage(ctx);
   return net::ERR_IO_PENDING;
 }
 
@@ -227,36 +233,117 @@ void BraveRequestHandler::RunCallbackForRequestIdentifier(
                  base::BindOnce(std::move(it->second), rv));
 }
 
-// TODO(iefremov): Merge all callback containers into one and run only one loop
-// instead of many (issues/5574).
-void BraveRequestHandler::RunNextCallback(
+// Runs the staged kOnBeforeRequest pipeline. Stages run in order; all
+// callbacks within a stage are dispatched together so their asynchronous
+// work overlaps, and the stage settles once every callback has completed.
+// The first failure in declaration order wins and skips the rest, matching
+// the old sequential behaviour.
+void BraveRequestHandler::RunNextStage(
     std::shared_ptr<brave::BraveRequestInfo> ctx) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  DCHECK_EQ(ctx->event_type, brave::kOnBeforeRequest);
 
   if (!base::Contains(callbacks_, ctx->request_identifier)) {
     return;
   }
 
-  // Continue processing callbacks until we hit one that returns PENDING
-  int rv = net::OK;
-
-  if (ctx->event_type == brave::kOnBeforeRequest) {
-    while (before_url_request_callbacks_.size() !=
-           ctx->next_url_request_index) {
-      brave::OnBeforeURLRequestCallback callback =
-          before_url_request_callbacks_[ctx->next_url_request_index++];
+  while (ctx->next_url_request_index < before_url_request_stages_.size()) {
+    const auto& stage = before_url_request_stages_[ctx->next_url_request_index];
+    ctx->next_url_request_index++;
+    // Hold an extra count during dispatch so an early completion can't
+    // settle the stage before every callback has started.
+    ctx->pending_stage_callbacks = 1;
+    ctx->stage_error = net::OK;
+    for (const auto& callback : stage) {
       brave::ResponseCallback next_callback =
-          base::BindRepeating(&BraveRequestHandler::RunNextCallback,
+          base::BindRepeating(&BraveRequestHandler::OnStageCallbackDone,
                               weak_factory_.GetWeakPtr(), ctx);
-      rv = callback.Run(next_callback, ctx);
+      int rv = callback.Run(next_callback, ctx);
       if (rv == net::ERR_IO_PENDING) {
-        return;
+        ctx->pending_stage_callbacks++;
+        continue;
       }
       if (rv != net::OK) {
+        ctx->stage_error = rv;
         break;
       }
     }
-  } else if (ctx->event_type == brave::kOnBeforeStartTransaction) {
+    ctx->pending_stage_callbacks--;
+    if (ctx->pending_stage_callbacks > 0) {
+      // Resumed by OnStageCallbackDone.
+      return;
+    }
+    if (ctx->stage_error != net::OK) {
+      TRACE_EVENT_NESTABLE_ASYNC_END1(
+          "brave.shields", "BraveRequestHandler::OnBeforeURLRequest",
+          TRACE_ID_LOCAL(ctx->request_identifier), "error", ctx->stage_error);
+      RunCallbackForRequestIdentifier(ctx->request_identifier,
+                                      ctx->stage_error);
+      return;
+    }
+  }
+
+  FinishOnBeforeURLRequest(ctx);
+}
+
+void BraveRequestHandler::OnStageCallbackDone(
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  if (!base::Contains(callbacks_, ctx->request_identifier)) {
+    return;
+  }
+
+  DCHECK_GT(ctx->pending_stage_callbacks, 0u);
+  if (--ctx->pending_stage_callbacks > 0) {
+    return;
+  }
+  if (ctx->stage_error != net::OK) {
+    TRACE_EVENT_NESTABLE_ASYNC_END1(
+        "brave.shields", "BraveRequestHandler::OnBeforeURLRequest",
+        TRACE_ID_LOCAL(ctx->request_identifier), "error", ctx->stage_error);
+    RunCallbackForRequestIdentifier(ctx->request_identifier, ctx->stage_error);
+    return;
+  }
+  RunNextStage(ctx);
+}
+
+void BraveRequestHandler::FinishOnBeforeURLRequest(
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  TRACE_EVENT_NESTABLE_ASYNC_END2(
+      "brave.shields", "BraveRequestHandler::OnBeforeURLRequest",
+      TRACE_ID_LOCAL(ctx->request_identifier), "blocked_by",
+      static_cast<int>(ctx->blocked_by), "new_url", ctx->new_url_spec);
+  if (!ctx->new_url_spec.empty() &&
+      (ctx->new_url_spec != ctx->request_url.spec()) &&
+      IsRequestIdentifierValid(ctx->request_identifier)) {
+    *ctx->new_url = GURL(ctx->new_url_spec);
+  }
+  if (ctx->blocked_by == brave::kAdBlocked ||
+      ctx->blocked_by == brave::kOtherBlocked) {
+    if (!ctx->ShouldMockRequest()) {
+      RunCallbackForRequestIdentifier(ctx->request_identifier,
+                                      net::ERR_BLOCKED_BY_CLIENT);
+      return;
+    }
+  }
+  RunCallbackForRequestIdentifier(ctx->request_identifier, net::OK);
+}
+
+// TODO(iefremov): Merge all callback containers into one and run only one loop
+// instead of many (issues/5574).
+void BraveRequestHandler::RunNextCallback(
+    std::shared_ptr<brave::BraveRequestInfo> ctx) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+
+  if (!base::Contains(callbacks_, ctx->request_identifier)) {
+    return;
+  }
+
+  // Continue processing callbacks until we hit one that returns PENDING
+  int rv = net::OK;
+
+  if (ctx->event_type == brave::kOnBeforeStartTransaction) {
     while (before_start_transaction_callbacks_.size() !=
            ctx->next_url_request_index) {
       brave::OnBeforeStartTransactionCallback callback =
@@ -296,20 +383,5 @@ void BraveRequestHandler::RunNextCallback(
     return;
   }
 
-  if (ctx->event_type == brave::kOnBeforeRequest) {
-    if (!ctx->new_url_spec.empty() &&
-        (ctx->new_url_spec != ctx->request_url.spec()) &&
-        IsRequestIdentifierValid(ctx->request_identifier)) {
-      *ctx->new_url = GURL(ctx->new_url_spec);
-    }
-    if (ctx->blocked_by == brave::kAdBlocked ||
-        ctx->blocked_by == brave::kOtherBlocked) {
-      if (!ctx->ShouldMockRequest()) {
-        RunCallbackForRequestIdentifier(ctx->request_identifier,
-                                        net::ERR_BLOCKED_BY_CLIENT);
-        return;
-      }
-    }
-  }
   RunCallbackForRequestIdentifier(ctx->request_identifier, rv);
 }
@@ -46,8 +46,15 @@ class BraveRequestHandler {
  private:
   void SetupCallbacks();
   void RunNextCallback(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  void RunNextStage(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  void OnStageCallbackDone(std::shared_ptr<brave::BraveRequestInfo> ctx);
+  void FinishOnBeforeURLRequest(std::shared_ptr<brave::BraveRequestInfo> ctx);
 
-  std::vector<brave::OnBeforeURLRequestCallback> before_url_request_callbacks_;
+  // kOnBeforeRequest callbacks grouped into stages. Callbacks within one
+  // stage declare disjoint reads/writes on BraveRequestInfo and run
+  // concurrently; stages run in order.
+  std::vector<std::vector<brave::OnBeforeURLRequestCallback>>
+      before_url_request_stages_;
   std::vector<brave::OnBeforeStartTransactionCallback>
       before_start_transaction_callbacks_;
   std::vector<brave::OnHeadersReceivedCallback> headers_received_callbacks_;
@@ -0,0 +1,160 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/net/brave_request_handler.h"
+
+#include <memory>
+#include <string>
+
+#include "base/bind.h"
+#include "base/cxx17_backports.h"
+#include "base/run_loop.h"
+#include "base/timer/elapsed_timer.h"
+#include "brave/browser/brave_browser_process.h"
+#include "brave/browser/net/url_context.h"
+#include "brave/components/brave_shields/browser/ad_block_service.h"
+#include "brave/test/base/testing_brave_browser_process.h"
+#include "brave/test/base/testing_brave_component_updater_delegate.h"
+#include "content/public/test/browser_task_environment.h"
+#include "net/base/net_errors.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "url/gurl.h"
+
+namespace {
+
+constexpr int kRequestsPerCorpus = 10000;
+
+// Filter rules matching the ad and tracker hosts in the corpora below, so
+// the engine exercises both its hit and its miss paths.
+constexpr char kFilterRules[] =
+    "||doubleclick.net^\n"
+    "||googlesyndication.com^\n"
+    "||adnxs.com^\n"
+    "||taboola.com^\n"
+    "||outbrain.com^\n"
+    "||google-analytics.com^\n"
+    "||scorecardresearch.com^\n"
+    "||quantserve.com^\n"
+    "||criteo.com^\n"
+    "||hotjar.com^";
+
+// Small recorded corpora of subresource requests as seen from a publisher
+// page. Mostly blocked by the rules above.
+const char* const kAdHeavyCorpus[] = {
+    "https://securepubads.g.doubleclick.net/tag/js/gpt.js",
+    "https://pagead2.googlesyndication.com/pagead/js/adsbygoogle.js",
+    "https://ib.adnxs.com/ut/v3/prebid",
+    "https://cdn.taboola.com/libtrc/publisher/loader.js",
+    "https://widgets.outbrain.com/outbrain.js",
+    "https://static.criteo.net/js/ld/publishertag.js",
+    "https://ad.doubleclick.net/ddm/adj/N1234.567890/B2345678.123",
+    "https://tpc.googlesyndication.com/safeframe/1-0-38/html/container.html",
+};
+
+// Mostly blocked by the rules above.
+const char* const kTrackerHeavyCorpus[] = {
+    "https://www.google-analytics.com/analytics.js",
+    "https://www.google-analytics.com/collect?v=1&t=pageview",
+    "https://sb.scorecardresearch.com/beacon.js",
+    "https://pixel.quantserve.com/pixel/p-12345.gif",
+    "https://static.hotjar.com/c/hotjar-12345.js",
+    "https://dis.criteo.com/dis/dis.aspx",
+    "https://secure.quantserve.com/quant.js",
+    "https://script.hotjar.com/modules.12345.js",
+};
+
+// Not matched by any rule; measures the pure pass-through cost.
+const char* const kCleanCorpus[] = {
+    "https://news.example.com/static/js/main.js",
+    "https://news.example.com/static/css/site.css",
+    "https://cdn.example.com/images/lead-story.jpg",
+    "https://cdn.example.com/fonts/headline.woff2",
+    "https://api.example.com/v1/articles?page=1",
+    "https://news.example.com/static/js/comments.js",
+    "https://cdn.example.com/images/logo.svg",
+    "https://api.example.com/v1/weather",
+};
+
+}  // namespace
+
+class BraveRequestHandlerPerfTest : public testing::Test {
+ protected:
+  void SetUp() override {
+    brave_component_updater_delegate_ =
+        std::make_unique<TestingBraveComponentUpdaterDelegate>();
+
+    auto adblock_service = brave_shields::AdBlockServiceFactory(
+        brave_component_updater_delegate_.get());
+
+    TestingBraveBrowserProcess::GetGlobal()->SetAdBlockService(
+        std::move(adblock_service));
+
+    g_brave_browser_process->ad_block_service()->Start();
+    g_brave_browser_process->ad_block_service()->ResetForTest(kFilterRules,
+                                                              "");
+  }
+
+  void TearDown() override {
+    // The AdBlockBaseService destructor must be called before the task runner
+    // is destroyed.
+    TestingBraveBrowserProcess::DeleteInstance();
+  }
+
+  // Drives |handler| with kRequestsPerCorpus requests cycling through
+  // |corpus| and reports the mean wall time per request.
+  void RunCorpus(const std::string& story,
+                 const char* const* corpus,
+                 size_t corpus_size) {
+    BraveRequestHandler handler;
+    uint64_t request_identifier = 0;
+
+    base::ElapsedTimer timer;
+    for (int i = 0; i < kRequestsPerCorpus; i++) {
+      const GURL url(corpus[i % corpus_size]);
+      auto ctx = std::make_shared<brave::BraveRequestInfo>(url);
+      ctx->request_identifier = ++request_identifier;
+      ctx->resource_type = blink::mojom::ResourceType::kScript;
+      ctx->initiator_url = GURL("https://news.example.com");
+
+      GURL new_url;
+      base::RunLoop run_loop;
+      int rc = handler.OnBeforeURLRequest(
+          ctx,
+          base::BindOnce([](base::OnceClosure quit,
+                            int /* rv */) { std::move(quit).Run(); },
+                         run_loop.QuitClosure()),
+          &new_url);
+      ASSERT_TRUE(rc == net::OK || rc == net::ERR_IO_PENDING);
+      if (rc == net::ERR_IO_PENDING)
+        run_loop.Run();
+      handler.OnURLRequestDestroyed(ctx);
+    }
+    const base::TimeDelta elapsed = timer.Elapsed();
+
+    perf_test::PerfResultReporter reporter("BraveRequestHandler.", story);
+    reporter.RegisterImportantMetric("wall_time_per_request", "ns");
+    reporter.AddResult(
+        "wall_time_per_request",
+        elapsed.InNanoseconds() / static_cast<double>(kRequestsPerCorpus));
+  }
+
+  content::BrowserTaskEnvironment task_environment_;
+  std::unique_ptr<TestingBraveComponentUpdaterDelegate>
+      brave_component_updater_delegate_;
+};
+
+TEST_F(BraveRequestHandlerPerfTest, AdHeavyCorpus) {
+  RunCorpus("ad_heavy", kAdHeavyCorpus, base::size(kAdHeavyCorpus));
+}
+
+TEST_F(BraveRequestHandlerPerfTest, TrackerHeavyCorpus) {
+  RunCorpus("tracker_heavy", kTrackerHeavyCorpus,
+            base::size(kTrackerHeavyCorpus));
+}
+
+TEST_F(BraveRequestHandlerPerfTest, CleanCorpus) {
+  RunCorpus("clean", kCleanCorpus, base::size(kCleanCorpus));
+}
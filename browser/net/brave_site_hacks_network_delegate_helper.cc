@@ -9,20 +9,20 @@
 #include <string>
 #include <vector>
 
-#include "base/lazy_instance.h"
+#include "base/containers/contains.h"
+#include "base/containers/flat_set.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/url_constants.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
 #include "content/public/common/referrer.h"
 #include "extensions/common/url_pattern.h"
-#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "net/url_request/url_request.h"
 #include "third_party/blink/public/common/loader/network_utils.h"
 #include "third_party/blink/public/common/loader/referrer_utils.h"
-#include "third_party/re2/src/re2/re2.h"
 
 namespace brave {
 
@@ -38,9 +38,11 @@ bool IsUAWhitelisted(const GURL& gurl) {
       [&gurl](URLPattern pattern) { return pattern.MatchesURL(gurl); });
 }
 
-const std::string& GetQueryStringTrackers() {
-  static const base::NoDestructor<std::string> trackers(base::JoinString(
-      std::vector<std::string>(
+// Query parameter names stripped from URLs. Matching is case-insensitive,
+// so every entry here must be lowercase.
+const base::flat_set<std::string>& GetQueryStringTrackers() {
+  static const base::NoDestructor<base::flat_set<std::string>> trackers(
+      base::flat_set<std::string>(
           {// https://github.com/brave/brave-browser/issues/4239
            "fbclid", "gclid", "msclkid", "mc_eid",
            // https://github.com/brave/brave-browser/issues/9879
@@ -58,40 +60,49 @@ const std::string& GetQueryStringTrackers() {
            // https://github.com/brave/brave-browser/issues/8975
            "__s",
            // https://github.com/brave/brave-browser/issues/9019
-           "_hsenc", "__hssc", "__hstc", "__hsfp", "hsCtaTracking"}),
-      "|"));
+           "_hsenc", "__hssc", "__hstc", "__hsfp", "hsctatracking"}));
   return *trackers;
 }
 
-// From src/components/autofill/content/renderer/page_passwords_analyser.cc
-// and password_form_conversion_utils.cc:
-#define DECLARE_LAZY_MATCHER(NAME, PATTERN)                                   \
-  struct LabelPatternLazyInstanceTraits_##NAME                                \
-      : public base::internal::DestructorAtExitLazyInstanceTraits<re2::RE2> { \
-    static re2::RE2* New(void* instance) {                                    \
-      re2::RE2::Options options;                                              \
-      options.set_case_sensitive(false);                                      \
-      re2::RE2* matcher = new (instance) re2::RE2(PATTERN, options);          \
-      DCHECK(matcher->ok());                                                  \
-      return matcher;                                                         \
-    }                                                                         \
-  };                                                                          \
-  base::LazyInstance<re2::RE2, LabelPatternLazyInstanceTraits_##NAME> NAME =  \
-      LAZY_INSTANCE_INITIALIZER
-
-// e.g. "?fbclid=1234"
-DECLARE_LAZY_MATCHER(tracker_only_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+$");
-
-// e.g. "?fbclid=1234&foo=1"
-DECLARE_LAZY_MATCHER(tracker_first_matcher,
-                     "^(" + GetQueryStringTrackers() + ")=[^&]+&");
-
-// e.g. "?foo=1&fbclid=1234" or "?foo=1&fbclid=1234&bar=2"
-DECLARE_LAZY_MATCHER(tracker_appended_matcher,
-                     "&(" + GetQueryStringTrackers() + ")=[^&]+");
-
-#undef DECLARE_LAZY_MATCHER
+// Removes tracker parameters from |query| in a single left-to-right pass,
+// appending the surviving parameters to one output buffer. This replaces a
+// set of alternation regexes that re-scanned the whole query once per
+// position, which was quadratic on long query strings. A parameter is
+// dropped only when its name matches case-insensitively and it carries a
+// non-empty value, matching the old "(name)=[^&]+" patterns. Returns the
+// number of parameters removed.
+int FilterQueryStringTrackers(base::StringPiece query, std::string* filtered) {
+  int removed_count = 0;
+  filtered->clear();
+  filtered->reserve(query.size());
+  bool wrote_param = false;
+
+  size_t pos = 0;
+  while (pos <= query.size()) {
+    size_t ampersand = query.find('&', pos);
+    const size_t end = (ampersand == base::StringPiece::npos) ? query.size()
+                                                              : ampersand;
+    const base::StringPiece param = query.substr(pos, end - pos);
+    const size_t equals = param.find('=');
+    bool drop = false;
+    if (equals != base::StringPiece::npos && equals + 1 < param.size()) {
+      drop = base::Contains(GetQueryStringTrackers(),
+                            base::ToLowerASCII(param.substr(0, equals)));
+    }
+    if (drop) {
+      removed_count++;
+    } else {
+      if (wrote_param)
+        filtered->push_back('&');
+      filtered->append(param.data(), param.size());
+      wrote_param = true;
+    }
+    if (ampersand == base::StringPiece::npos)
+      break;
+    pos = ampersand + 1;
+  }
+  return removed_count;
+}
 
 void ApplyPotentialQueryStringFilter(std::shared_ptr<BraveRequestInfo> ctx) {
   SCOPED_UMA_HISTOGRAM_TIMER("Brave.SiteHacks.QueryFilter");
@@ -107,27 +118,19 @@ void ApplyPotentialQueryStringFilter(std::shared_ptr<BraveRequestInfo> ctx) {
       return;
     }
 
-    if (net::registry_controlled_domains::SameDomainOrHost(
-            ctx->redirect_source, ctx->request_url,
-            net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES)) {
+    if (ctx->redirect_source_etld1 == ctx->request_url_etld1) {
       // Same-site redirects are exempted.
       return;
     }
   } else if (ctx->initiator_url.is_valid() &&
-             net::registry_controlled_domains::SameDomainOrHost(
-                 ctx->initiator_url, ctx->request_url,
-                 net::registry_controlled_domains::
-                     INCLUDE_PRIVATE_REGISTRIES)) {
+             ctx->initiator_url_etld1 == ctx->request_url_etld1) {
     // Same-site requests are exempted.
     return;
   }
 
-  std::string new_query = ctx->request_url.query();
-  // Note: the ordering of these replacements is important.
+  std::string new_query;
   const int replacement_count =
-      re2::RE2::GlobalReplace(&new_query, tracker_appended_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_first_matcher.Get(), "") +
-      re2::RE2::GlobalReplace(&new_query, tracker_only_matcher.Get(), "");
+      FilterQueryStringTrackers(ctx->request_url.query_piece(), &new_query);
 
   if (replacement_count > 0) {
     url::Replacements<char> replacements;
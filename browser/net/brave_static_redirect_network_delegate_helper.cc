@@ -10,7 +10,9 @@
 #include <string>
 #include <vector>
 
+#include "base/no_destructor.h"
 #include "base/strings/string_piece_forward.h"
+#include "brave/browser/net/brave_host_suffix_matcher.h"
 #include "brave/browser/translate/buildflags/buildflags.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/translate_network_constants.h"
@@ -52,6 +54,18 @@ int OnBeforeURLRequest_StaticRedirectWork(
 int OnBeforeURLRequest_StaticRedirectWorkForGURL(
     const GURL& request_url,
     GURL* new_url) {
+  // Every pattern below targets one of these hosts; a single trie walk
+  // rules out all other requests before the URLPattern cascade runs.
+  static const base::NoDestructor<HostSuffixMatcher> redirect_hosts(
+      std::initializer_list<base::StringPiece>{
+          "www.googleapis.com", "safebrowsing.googleapis.com",
+          "sb-ssl.google.com", "safebrowsing.google.com",
+          "clients2.googleusercontent.com", "www.gstatic.com",
+          "dl.google.com", "www.google.com", "storage.googleapis.com",
+          "gvt1.com", "translate.googleapis.com"});
+  if (!redirect_hosts->Matches(request_url.host_piece()))
+    return net::OK;
+
   GURL::Replacements replacements;
   static URLPattern geo_pattern(URLPattern::SCHEME_HTTPS, kGeoLocationsPattern);
   static URLPattern safeBrowsing_pattern(URLPattern::SCHEME_HTTPS,
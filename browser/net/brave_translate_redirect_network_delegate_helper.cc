@@ -8,6 +8,9 @@
 #include <memory>
 #include <string>
 #include <vector>
+
+#include "base/no_destructor.h"
+#include "brave/browser/net/brave_host_suffix_matcher.h"
 #include "brave/common/translate_network_constants.h"
 #include "extensions/common/url_pattern.h"
 
@@ -57,6 +60,15 @@ bool IsTranslateGen204Request(const GURL& gurl) {
 int OnBeforeURLRequest_TranslateRedirectWork(
     const ResponseCallback& next_callback,
     std::shared_ptr<BraveRequestInfo> ctx) {
+  // All translate patterns below target one of these hosts; a single trie
+  // walk rules out every other request up front.
+  static const base::NoDestructor<HostSuffixMatcher> translate_hosts(
+      std::initializer_list<base::StringPiece>{"translate.googleapis.com",
+                                               "translate.google.com",
+                                               "www.gstatic.com"});
+  if (!translate_hosts->Matches(ctx->request_url.host_piece()))
+    return net::OK;
+
   GURL::Replacements replacements;
 
   // Abort those gen204 requests triggered by translate element library.
@@ -5,8 +5,14 @@
 
 #include "brave/browser/net/decentralized_dns_network_delegate_helper.h"
 
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "base/containers/mru_cache.h"
+#include "base/no_destructor.h"
+#include "base/time/time.h"
 #include "net/base/net_errors.h"
 
 #include "brave/browser/brave_wallet/brave_wallet_service_factory.h"
@@ -27,6 +33,107 @@ std::string GetValue(const std::vector<std::string>& arr, RecordKeys key) {
   return arr[static_cast<size_t>(key)];
 }
 
+// A page full of links to the same .eth or .crypto domain used to issue one
+// eth_call per subresource. Resolutions are coalesced per domain (a single
+// in-flight call with the other requests attached as waiters) and successful
+// raw responses are kept in a short-lived cache, since on-chain records
+// change rarely.
+constexpr base::TimeDelta kResolutionCacheTtl = base::TimeDelta::FromMinutes(5);
+// Failures (missing records, RPC errors) are remembered briefly too, so a
+// page retrying a dead domain does not hammer the RPC endpoint, but kept
+// short so a transient error recovers quickly.
+constexpr base::TimeDelta kNegativeCacheTtl = base::TimeDelta::FromMinutes(1);
+constexpr size_t kResolutionCacheSize = 64;
+
+struct CachedResolution {
+  base::TimeTicks resolved_at;
+  bool success;
+  std::string result;
+};
+
+// Keys are "<kind>\n<host>" so ENS and Unstoppable Domains entries for the
+// same name cannot collide. UI-thread only.
+base::MRUCache<std::string, CachedResolution>& ResolutionCache() {
+  static base::NoDestructor<base::MRUCache<std::string, CachedResolution>>
+      cache(kResolutionCacheSize);
+  return *cache;
+}
+
+using ResolutionWaiter =
+    std::pair<brave::ResponseCallback, std::shared_ptr<brave::BraveRequestInfo>>;
+
+// Requests waiting on an in-flight resolution, keyed like the cache.
+// UI-thread only.
+std::map<std::string, std::vector<ResolutionWaiter>>& InFlightResolutions() {
+  static base::NoDestructor<std::map<std::string, std::vector<ResolutionWaiter>>>
+      in_flight;
+  return *in_flight;
+}
+
+void OnResolutionComplete(bool is_ens,
+                          const std::string& cache_key,
+                          bool success,
+                          const std::string& result) {
+  ResolutionCache().Put(cache_key,
+                        {base::TimeTicks::Now(), success, result});
+
+  auto it = InFlightResolutions().find(cache_key);
+  if (it == InFlightResolutions().end())
+    return;
+  std::vector<ResolutionWaiter> waiters = std::move(it->second);
+  InFlightResolutions().erase(it);
+
+  for (auto& waiter : waiters) {
+    if (is_ens) {
+      OnBeforeURLRequest_EnsRedirectWork(waiter.first, waiter.second, success,
+                                         result);
+    } else {
+      OnBeforeURLRequest_DecentralizedDnsRedirectWork(waiter.first,
+                                                      waiter.second, success,
+                                                      result);
+    }
+  }
+}
+
+// Answers |ctx| from the cache or attaches it to an in-flight resolution.
+// Returns true when no new upstream call is needed; |*pending| tells the
+// caller whether the request was parked on an existing resolution.
+bool MaybeUseExistingResolution(bool is_ens,
+                                const std::string& cache_key,
+                                const brave::ResponseCallback& next_callback,
+                                std::shared_ptr<brave::BraveRequestInfo> ctx,
+                                bool* pending) {
+  *pending = false;
+  auto cached = ResolutionCache().Get(cache_key);
+  if (cached != ResolutionCache().end()) {
+    const base::TimeDelta ttl =
+        cached->second.success ? kResolutionCacheTtl : kNegativeCacheTtl;
+    if (base::TimeTicks::Now() - cached->second.resolved_at < ttl) {
+      // Synchronous answer; the caller returns net::OK, so the redirect work
+      // must not run |next_callback|.
+      if (is_ens) {
+        OnBeforeURLRequest_EnsRedirectWork(brave::ResponseCallback(), ctx,
+                                           cached->second.success,
+                                           cached->second.result);
+      } else {
+        OnBeforeURLRequest_DecentralizedDnsRedirectWork(
+            brave::ResponseCallback(), ctx, cached->second.success,
+            cached->second.result);
+      }
+      return true;
+    }
+    ResolutionCache().Erase(cached);
+  }
+
+  auto in_flight = InFlightResolutions().find(cache_key);
+  if (in_flight != InFlightResolutions().end()) {
+    in_flight->second.emplace_back(next_callback, std::move(ctx));
+    *pending = true;
+    return true;
+  }
+  return false;
+}
+
 }  // namespace
 
 int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
@@ -46,12 +153,20 @@ int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
       return net::OK;
     }
 
+    const std::string cache_key = "ud\n" + ctx->request_url.host();
+    bool pending = false;
+    if (MaybeUseExistingResolution(false, cache_key, next_callback, ctx,
+                                   &pending)) {
+      return pending ? net::ERR_IO_PENDING : net::OK;
+    }
+
+    InFlightResolutions()[cache_key].emplace_back(next_callback, ctx);
     if (!service->rpc_controller()->UnstoppableDomainsProxyReaderGetMany(
             kProxyReaderContractAddress, ctx->request_url.host(),
             std::vector<std::string>(std::begin(kRecordKeys),
                                      std::end(kRecordKeys)),
-            base::BindOnce(&OnBeforeURLRequest_DecentralizedDnsRedirectWork,
-                           next_callback, ctx))) {
+            base::BindOnce(&OnResolutionComplete, false, cache_key))) {
+      InFlightResolutions().erase(cache_key);
       return net::OK;
     }
 
@@ -66,10 +181,18 @@ int OnBeforeURLRequest_DecentralizedDnsPreRedirectWork(
       return net::OK;
     }
 
+    const std::string cache_key = "ens\n" + ctx->request_url.host();
+    bool pending = false;
+    if (MaybeUseExistingResolution(true, cache_key, next_callback, ctx,
+                                   &pending)) {
+      return pending ? net::ERR_IO_PENDING : net::OK;
+    }
+
+    InFlightResolutions()[cache_key].emplace_back(next_callback, ctx);
     if (!service->rpc_controller()->EnsProxyReaderGetResolverAddress(
             kEnsRegistryContractAddress, ctx->request_url.host(),
-            base::BindOnce(&OnBeforeURLRequest_EnsRedirectWork, next_callback,
-                           ctx))) {
+            base::BindOnce(&OnResolutionComplete, true, cache_key))) {
+      InFlightResolutions().erase(cache_key);
       return net::OK;
     }
 
@@ -7,16 +7,29 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
+
+#include "base/containers/flat_map.h"
+#include "base/memory/ptr_util.h"
+#include "base/no_destructor.h"
+#include "base/supports_user_data.h"
+#include "base/synchronization/lock.h"
 
 #include "brave/browser/brave_shields/brave_shields_web_contents_observer.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
+#include "brave/components/brave_shields/browser/cache_generation_bus.h"
 #include "brave/components/brave_webtorrent/browser/buildflags/buildflags.h"
 #include "brave/components/brave_webtorrent/browser/webtorrent_util.h"
 #include "brave/components/ipfs/buildflags/buildflags.h"
 #include "chrome/browser/content_settings/host_content_settings_map_factory.h"
 #include "chrome/browser/profiles/profile.h"
+#include "components/content_settings/core/browser/content_settings_observer.h"
+#include "components/content_settings/core/browser/host_content_settings_map.h"
+#include "content/public/browser/browser_context.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/isolation_info.h"
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 
 #if BUILDFLAG(IPFS_ENABLED)
 #include "brave/components/ipfs/ipfs_constants.h"
@@ -47,14 +60,193 @@ std::string GetUploadData(const network::ResourceRequest& request) {
   return upload_data;
 }
 
+// Recycles BraveRequestInfo instances between requests so the hot request
+// path performs no heap allocations in steady state: a recycled context
+// reuses its own allocation and the capacity of its string and set members.
+// The last reference to a context can drop on any thread a helper bounced
+// it to, so the free list is lock-guarded.
+constexpr size_t kMaxPooledContexts = 32;
+
+base::Lock& PooledContextsLock() {
+  static base::NoDestructor<base::Lock> lock;
+  return *lock;
+}
+
+std::vector<std::unique_ptr<brave::BraveRequestInfo>>& PooledContexts() {
+  static base::NoDestructor<std::vector<std::unique_ptr<brave::BraveRequestInfo>>>
+      pool;
+  return *pool;
+}
+
+void RecycleContext(brave::BraveRequestInfo* ctx) {
+  std::unique_ptr<brave::BraveRequestInfo> owned = base::WrapUnique(ctx);
+  owned->Reset();
+  base::AutoLock lock(PooledContextsLock());
+  auto& pool = PooledContexts();
+  if (pool.size() < kMaxPooledContexts)
+    pool.push_back(std::move(owned));
+}
+
+const char kShieldsFlagsCacheKey[] = "brave_shields_flags_cache";
+
+// Caches the shields flags already computed for a tab origin so that each
+// subresource request from that tab costs one map lookup instead of four
+// pattern-matching content settings queries. The flags are pure functions
+// of the content settings and the tab origin, so entries are validated
+// against the kShieldsSettings generation of CacheGenerationBus, which the
+// observer below bumps on any content settings write. The cache lives on
+// the browser context and is only touched on the UI thread, where MakeCTX
+// runs.
+class ShieldsFlagsCache : public base::SupportsUserData::Data,
+                          public content_settings::Observer {
+ public:
+  struct Flags {
+    bool allow_brave_shields;
+    bool allow_ads;
+    bool allow_http_upgradable_resource;
+    bool allow_referrers;
+  };
+
+  explicit ShieldsFlagsCache(HostContentSettingsMap* map) : map_(map) {
+    map_->AddObserver(this);
+  }
+
+  ~ShieldsFlagsCache() override { map_->RemoveObserver(this); }
+
+  static ShieldsFlagsCache* GetOrCreate(content::BrowserContext* context,
+                                        HostContentSettingsMap* map) {
+    auto* cache = static_cast<ShieldsFlagsCache*>(
+        context->GetUserData(kShieldsFlagsCacheKey));
+    if (!cache) {
+      auto new_cache = std::make_unique<ShieldsFlagsCache>(map);
+      cache = new_cache.get();
+      context->SetUserData(kShieldsFlagsCacheKey, std::move(new_cache));
+    }
+    return cache;
+  }
+
+  Flags GetFlags(const GURL& tab_origin) {
+    // A settings write in any profile re-derives the flags; they are cheap
+    // to compute compared to tracking which profile changed.
+    const uint64_t generation = brave_shields::CacheGenerationBus::Get(
+        brave_shields::CacheGenerationBus::Channel::kShieldsSettings);
+    if (generation != settings_generation_) {
+      flags_.clear();
+      settings_generation_ = generation;
+    }
+
+    auto iter = flags_.find(tab_origin);
+    if (iter != flags_.end())
+      return iter->second;
+
+    Flags flags;
+    flags.allow_brave_shields =
+        brave_shields::GetBraveShieldsEnabled(map_.get(), tab_origin);
+    flags.allow_ads =
+        brave_shields::GetAdControlType(map_.get(), tab_origin) ==
+        brave_shields::ControlType::ALLOW;
+    flags.allow_http_upgradable_resource =
+        !brave_shields::GetHTTPSEverywhereEnabled(map_.get(), tab_origin);
+    flags.allow_referrers =
+        brave_shields::AllowReferrers(map_.get(), tab_origin);
+    if (flags_.size() >= kMaxCachedOrigins)
+      flags_.clear();
+    flags_.emplace(tab_origin, flags);
+    return flags;
+  }
+
+  // content_settings::Observer:
+  void OnContentSettingChanged(const ContentSettingsPattern& primary_pattern,
+                               const ContentSettingsPattern& secondary_pattern,
+                               ContentSettingsType content_type) override {
+    brave_shields::CacheGenerationBus::Bump(
+        brave_shields::CacheGenerationBus::Channel::kShieldsSettings);
+  }
+
+ private:
+  static constexpr size_t kMaxCachedOrigins = 100;
+
+  const scoped_refptr<HostContentSettingsMap> map_;
+  base::flat_map<GURL, Flags> flags_;
+  uint64_t settings_generation_ = 0;
+};
+
 }  // namespace
 
+std::string GetRegistrableDomainOrHost(const GURL& url) {
+  std::string domain = net::registry_controlled_domains::GetDomainAndRegistry(
+      url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+  if (domain.empty())
+    domain = url.host();
+  return domain;
+}
+
 BraveRequestInfo::BraveRequestInfo() = default;
 
 BraveRequestInfo::BraveRequestInfo(const GURL& url) : request_url(url) {}
 
 BraveRequestInfo::~BraveRequestInfo() = default;
 
+// static
+std::shared_ptr<BraveRequestInfo> BraveRequestInfo::Create() {
+  BraveRequestInfo* ctx = nullptr;
+  {
+    base::AutoLock lock(PooledContextsLock());
+    auto& pool = PooledContexts();
+    if (!pool.empty()) {
+      ctx = pool.back().release();
+      pool.pop_back();
+    }
+  }
+  if (!ctx)
+    ctx = new BraveRequestInfo();
+  return std::shared_ptr<BraveRequestInfo>(ctx, &RecycleContext);
+}
+
+void BraveRequestInfo::Reset() {
+  method.clear();
+  request_url = GURL();
+  tab_origin = GURL();
+  tab_url = GURL();
+  initiator_url = GURL();
+  internal_redirect = false;
+  redirect_source = GURL();
+  request_url_etld1.clear();
+  initiator_url_etld1.clear();
+  redirect_source_etld1.clear();
+  referrer = GURL();
+  referrer_policy =
+      net::ReferrerPolicy::CLEAR_ON_TRANSITION_FROM_SECURE_TO_INSECURE;
+  new_referrer.reset();
+  new_url_spec.clear();
+  allow_brave_shields = true;
+  allow_ads = false;
+  allow_http_upgradable_resource = false;
+  allow_referrers = false;
+  is_webtorrent_disabled = false;
+  frame_tree_node_id = 0;
+  request_identifier = 0;
+  next_url_request_index = 0;
+  pending_stage_callbacks = 0;
+  stage_error = 0;
+  browser_context = nullptr;
+  headers = nullptr;
+  set_headers.clear();
+  removed_headers.clear();
+  original_response_headers = nullptr;
+  override_response_headers = nullptr;
+  allowed_unsafe_redirect_url = nullptr;
+  event_type = kUnknownEventType;
+  blocked_by = kNotBlocked;
+  mock_data_url.clear();
+  ipfs_gateway_url = GURL();
+  ipfs_auto_fallback = false;
+  network_isolation_key = net::NetworkIsolationKey();
+  resource_type = kInvalidResourceType;
+  upload_data.clear();
+  new_url = nullptr;
+}
+
 // static
 std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
     const network::ResourceRequest& request,
@@ -65,7 +257,7 @@ std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
     std::shared_ptr<brave::BraveRequestInfo> old_ctx) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
 
-  auto ctx = std::make_shared<brave::BraveRequestInfo>();
+  auto ctx = Create();
   ctx->request_identifier = request_identifier;
   ctx->method = request.method;
   ctx->request_url = request.url;
@@ -104,6 +296,13 @@ std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
   // TODO(iefremov): We still need this for WebSockets, currently
   // |AddChannelRequest| provides only old-fashioned |site_for_cookies|.
   // (See |BraveProxyingWebSocket|).
+  if (ctx->tab_origin.is_empty() && old_ctx &&
+      !old_ctx->tab_origin.is_empty()) {
+    // WebSocket handshakes rebuild the context for each handler hook; the
+    // tab origin cannot change in between, so reuse the one already looked
+    // up instead of walking to the WebContents again.
+    ctx->tab_origin = old_ctx->tab_origin;
+  }
   if (ctx->tab_origin.is_empty()) {
     content::WebContents* contents =
         content::WebContents::FromFrameTreeNodeId(ctx->frame_tree_node_id);
@@ -134,20 +333,22 @@ std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
 
   Profile* profile = Profile::FromBrowserContext(browser_context);
   auto* map = HostContentSettingsMapFactory::GetForProfile(profile);
-  ctx->allow_brave_shields =
-      brave_shields::GetBraveShieldsEnabled(map, ctx->tab_origin);
-  ctx->allow_ads = brave_shields::GetAdControlType(map, ctx->tab_origin) ==
-                   brave_shields::ControlType::ALLOW;
+  const ShieldsFlagsCache::Flags shields_flags =
+      ShieldsFlagsCache::GetOrCreate(browser_context, map)
+          ->GetFlags(ctx->tab_origin);
+  ctx->allow_brave_shields = shields_flags.allow_brave_shields;
+  ctx->allow_ads = shields_flags.allow_ads;
   ctx->allow_http_upgradable_resource =
-      !brave_shields::GetHTTPSEverywhereEnabled(map, ctx->tab_origin);
+      shields_flags.allow_http_upgradable_resource;
 
   // HACK: after we fix multiple creations of BraveRequestInfo we should
   // use only tab_origin. Since we recreate BraveRequestInfo during consequent
   // stages of navigation, |tab_origin| changes and so does |allow_referrers|
   // flag, which is not what we want for determining referrers.
-  ctx->allow_referrers = brave_shields::AllowReferrers(
-      map,
-      ctx->redirect_source.is_empty() ? ctx->tab_origin : ctx->redirect_source);
+  ctx->allow_referrers =
+      ctx->redirect_source.is_empty()
+          ? shields_flags.allow_referrers
+          : brave_shields::AllowReferrers(map, ctx->redirect_source);
   ctx->upload_data = GetUploadData(request);
 
   ctx->browser_context = browser_context;
@@ -160,6 +361,12 @@ std::shared_ptr<brave::BraveRequestInfo> BraveRequestInfo::MakeCTX(
     ctx->redirect_source = old_ctx->redirect_source;
   }
 
+  // Derive the registrable domains once; the helpers compare these instead
+  // of re-running GetDomainAndRegistry per stage.
+  ctx->request_url_etld1 = GetRegistrableDomainOrHost(ctx->request_url);
+  ctx->initiator_url_etld1 = GetRegistrableDomainOrHost(ctx->initiator_url);
+  ctx->redirect_source_etld1 = GetRegistrableDomainOrHost(ctx->redirect_source);
+
   return ctx;
 }
 
@@ -51,6 +51,12 @@ enum BraveNetworkDelegateEventType {
 
 enum BlockedBy { kNotBlocked, kAdBlocked, kOtherBlocked };
 
+// Returns the registrable domain (eTLD+1, including private registries) of
+// |url|, or the raw host when the URL has no registrable domain. This is the
+// representation stored in the |*_etld1| fields of BraveRequestInfo; use it
+// to compare URLs that are not carried on the context.
+std::string GetRegistrableDomainOrHost(const GURL& url);
+
 struct BraveRequestInfo {
   BraveRequestInfo();
 
@@ -58,6 +64,17 @@ struct BraveRequestInfo {
   explicit BraveRequestInfo(const GURL& url);
 
   ~BraveRequestInfo();
+
+  // Returns a recycled instance when one is available so the per-request
+  // hot path avoids heap allocations in steady state; see the context pool
+  // in url_context.cc. Used by MakeCTX.
+  static std::shared_ptr<BraveRequestInfo> Create();
+
+  // Returns all fields to their default values before the instance goes
+  // back to the pool. String and set members are clear()ed so their
+  // capacity survives recycling.
+  void Reset();
+
   std::string method;
   GURL request_url;
   GURL tab_origin;
@@ -67,6 +84,16 @@ struct BraveRequestInfo {
   bool internal_redirect = false;
   GURL redirect_source;
 
+  // Registrable domains (eTLD+1, including private registries) of the URLs
+  // above, falling back to the raw host for URLs without one (IP addresses,
+  // single-label hosts). Filled once by MakeCTX so the helpers sharing this
+  // context can compare registrable domains without re-deriving them per
+  // stage. Two valid URLs are same-site in the |SameDomainOrHost| sense
+  // exactly when their fields here are equal.
+  std::string request_url_etld1;
+  std::string initiator_url_etld1;
+  std::string redirect_source_etld1;
+
   GURL referrer;
   net::ReferrerPolicy referrer_policy =
       net::ReferrerPolicy::CLEAR_ON_TRANSITION_FROM_SECURE_TO_INSECURE;
@@ -82,6 +109,11 @@ struct BraveRequestInfo {
   int frame_tree_node_id = 0;
   uint64_t request_identifier = 0;
   size_t next_url_request_index = 0;
+  // Scheduling state for the staged kOnBeforeRequest pipeline; see
+  // BraveRequestHandler::RunNextStage. For that event type
+  // |next_url_request_index| indexes stages rather than callbacks.
+  size_t pending_stage_callbacks = 0;
+  int stage_error = 0;
 
   content::BrowserContext* browser_context = nullptr;
   net::HttpRequestHeaders* headers = nullptr;
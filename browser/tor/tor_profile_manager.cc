@@ -11,8 +11,10 @@
 #include "brave/browser/translate/buildflags/buildflags.h"
 #include "brave/common/pref_names.h"
 #include "brave/components/brave_webtorrent/browser/buildflags/buildflags.h"
+#include "brave/components/tor/pref_names.h"
 #include "brave/components/tor/tor_constants.h"
 #include "brave/components/tor/tor_profile_service.h"
+#include "chrome/browser/browser_process.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/browser/profiles/profile_window.h"
 #include "chrome/browser/ui/browser_list.h"
@@ -91,6 +93,25 @@ Profile* TorProfileManager::GetTorProfile(Profile* original_profile) {
   return tor_profile;
 }
 
+void TorProfileManager::MaybePrewarmTorProcess(Profile* original_profile) {
+  if (TorProfileServiceFactory::IsTorDisabled() ||
+      !g_browser_process->local_state()->GetBoolean(
+          tor::prefs::kPrewarmTorOnStartup)) {
+    return;
+  }
+
+  // Creating the tor profile and registering the client updater launches
+  // the tor process the same way opening a Tor window would, except no
+  // window is opened.  By the time the user opens one, the daemon has
+  // already bootstrapped and pre-built circuits, so the first navigation
+  // rides an established circuit instead of waiting for bootstrap.
+  Profile* tor_profile = GetTorProfile(original_profile);
+  tor::TorProfileService* service =
+      TorProfileServiceFactory::GetForContext(tor_profile);
+  DCHECK(service);
+  service->RegisterTorClientUpdater();
+}
+
 void TorProfileManager::OnBrowserRemoved(Browser* browser) {
   if (!browser || !browser->profile()->IsTor())
     return;
@@ -21,6 +21,10 @@ class TorProfileManager : public BrowserListObserver, public ProfileObserver {
                                  ProfileManager::CreateCallback callback);
   static void CloseTorProfileWindows(Profile* tor_profile);
   Profile* GetTorProfile(Profile* original_profile);
+  // Launch the tor process without opening a Tor window if the user has
+  // opted in through kPrewarmTorOnStartup, so the daemon has circuits
+  // established before the first Tor window opens.
+  void MaybePrewarmTorProcess(Profile* original_profile);
 
  private:
   friend class base::NoDestructor<TorProfileManager>;
@@ -7,11 +7,14 @@
 
 #include <algorithm>
 
+#include "base/bind.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/stl_util.h"
 #include "base/values.h"
 #include "brave/browser/autocomplete/brave_autocomplete_scheme_classifier.h"
+#include "brave/browser/brave_browser_process.h"
 #include "brave/common/pref_names.h"
+#include "brave/components/brave_shields/browser/https_everywhere_service.h"
 #include "brave/components/weekly_storage/weekly_storage.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/browser/ui/omnibox/chrome_omnibox_client.h"
@@ -19,6 +22,7 @@
 #include "components/omnibox/browser/autocomplete_match.h"
 #include "components/prefs/pref_registry_simple.h"
 #include "components/prefs/pref_service.h"
+#include "url/url_constants.h"
 
 namespace {
 
@@ -41,6 +45,15 @@ bool IsSearchEvent(const AutocompleteMatch& match) {
   return false;
 }
 
+// Runs on the HTTPS Everywhere task runner. Accepting a navigation in the
+// omnibox gives a head start over the network request that follows it: by
+// the time the request reaches the network delegate, the upgrade verdict is
+// in the recently used cache and the UI-thread cache-only check in
+// OnBeforeURLRequest_HttpsePreFileWork hits without a task runner hop.
+void PrewarmHttpseOnTaskRunner(const GURL& url) {
+  g_brave_browser_process->https_everywhere_service()->PrewarmHTTPSURL(url);
+}
+
 void RecordSearchEventP3A(uint64_t number_of_searches) {
   constexpr int kIntervals[] = {0, 5, 10, 20, 50, 100, 500};
   const int* it =
@@ -83,6 +96,13 @@ bool BraveOmniboxClientImpl::IsAutocompleteEnabled() const {
 }
 
 void BraveOmniboxClientImpl::OnInputAccepted(const AutocompleteMatch& match) {
+  if (!IsSearchEvent(match) && match.destination_url.is_valid() &&
+      match.destination_url.SchemeIs(url::kHttpScheme)) {
+    g_brave_browser_process->https_everywhere_service()
+        ->GetTaskRunner()
+        ->PostTask(FROM_HERE, base::BindOnce(&PrewarmHttpseOnTaskRunner,
+                                             match.destination_url));
+  }
   if (IsSearchEvent(match)) {
     // TODO(iefremov): Optimize this.
     WeeklyStorage storage(profile_->GetPrefs(), kSearchCountPrefName);
@@ -7,7 +7,11 @@
 
 #include <memory>
 
+#include "base/metrics/histogram_base.h"
+#include "base/metrics/histogram_samples.h"
+#include "base/metrics/statistics_recorder.h"
 #include "brave/browser/brave_browser_process.h"
+#include "brave/browser/net/brave_ad_block_tp_network_delegate_helper.h"
 #include "brave/browser/ui/webui/brave_webui_source.h"
 #include "brave/common/webui_url_constants.h"
 #include "brave/components/brave_adblock/resources/grit/brave_adblock_generated_map.h"
@@ -29,6 +33,7 @@ class AdblockDOMHandler : public content::WebUIMessageHandler {
  private:
   void HandleEnableFilterList(const base::ListValue* args);
   void HandleGetCustomFilters(const base::ListValue* args);
+  void HandleGetEngineStats(const base::ListValue* args);
   void HandleGetRegionalLists(const base::ListValue* args);
   void HandleUpdateCustomFilters(const base::ListValue* args);
 
@@ -48,6 +53,10 @@ void AdblockDOMHandler::RegisterMessages() {
       "brave_adblock.getCustomFilters",
       base::BindRepeating(&AdblockDOMHandler::HandleGetCustomFilters,
                           base::Unretained(this)));
+  web_ui()->RegisterMessageCallback(
+      "brave_adblock.getEngineStats",
+      base::BindRepeating(&AdblockDOMHandler::HandleGetEngineStats,
+                          base::Unretained(this)));
   web_ui()->RegisterMessageCallback(
       "brave_adblock.getRegionalLists",
       base::BindRepeating(&AdblockDOMHandler::HandleGetRegionalLists,
@@ -80,6 +89,47 @@ void AdblockDOMHandler::HandleGetCustomFilters(const base::ListValue* args) {
                          base::Value(custom_filters));
 }
 
+void AdblockDOMHandler::HandleGetEngineStats(const base::ListValue* args) {
+  DCHECK_EQ(args->GetSize(), 0U);
+  AllowJavascript();
+
+  base::Value stats(base::Value::Type::DICTIONARY);
+
+  const brave::AdBlockVerdictCacheStats cache_stats =
+      brave::GetAdBlockVerdictCacheStats();
+  stats.SetDoubleKey("verdictCacheHits",
+                     static_cast<double>(cache_stats.hits));
+  stats.SetDoubleKey("verdictCacheMisses",
+                     static_cast<double>(cache_stats.misses));
+  stats.SetDoubleKey("coalescedRequests",
+                     static_cast<double>(cache_stats.coalesced));
+
+  // Engine match timing from the instrumentation on the classification
+  // path; the same histogram backs brave://performance.
+  int64_t sum_ms = 0;
+  int sample_count = 0;
+  base::HistogramBase* histogram = base::StatisticsRecorder::FindHistogram(
+      "Brave.AdBlock.ShouldStartRequest");
+  if (histogram) {
+    std::unique_ptr<base::HistogramSamples> samples =
+        histogram->SnapshotSamples();
+    sample_count = samples->TotalCount();
+    sum_ms = samples->sum();
+  }
+  stats.SetIntKey("matchSampleCount", sample_count);
+  stats.SetDoubleKey("matchMeanTimeMs",
+                     sample_count ? static_cast<double>(sum_ms) / sample_count
+                                  : 0.0);
+
+  std::unique_ptr<base::DictionaryValue> hit_report =
+      g_brave_browser_process->ad_block_regional_service_manager()
+          ->GetListHitReport();
+  stats.SetKey("listHitReport",
+               base::Value::FromUniquePtrValue(std::move(hit_report)));
+
+  CallJavascriptFunction("brave_adblock.onGetEngineStats", stats);
+}
+
 void AdblockDOMHandler::HandleGetRegionalLists(const base::ListValue* args) {
   DCHECK_EQ(args->GetSize(), 0U);
   AllowJavascript();
@@ -0,0 +1,107 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/browser/ui/webui/brave_performance_ui.h"
+
+#include <memory>
+
+#include "base/metrics/histogram_base.h"
+#include "base/metrics/histogram_samples.h"
+#include "base/metrics/statistics_recorder.h"
+#include "brave/browser/ui/webui/brave_webui_source.h"
+#include "brave/components/brave_performance/resources/grit/brave_performance_generated_map.h"
+#include "components/grit/brave_components_resources.h"
+#include "content/public/browser/web_ui_message_handler.h"
+
+namespace {
+
+// The timing histograms each Brave subsystem records on its hot path. The
+// page is a front end over this instrumentation; adding a row means adding
+// a SCOPED_UMA_HISTOGRAM_TIMER (or similar) where the cost is incurred.
+struct TimingSource {
+  const char* histogram_name;
+  const char* subsystem;
+  const char* description;
+};
+
+constexpr TimingSource kTimingSources[] = {
+    {"Brave.OnBeforeURLRequest_Handler", "network",
+     "Delegate helper chain, per request"},
+    {"Brave.AdBlock.ShouldStartRequest", "adblock",
+     "Engine match across all filter lists, per request"},
+    {"Brave.SiteHacks.QueryFilter", "network",
+     "Tracking query parameter filter, per request"},
+    {"Brave.ShieldsCNAMEBlocking.TotalResolutionTime", "adblock",
+     "CNAME uncloaking resolution"},
+    {"Brave.ProxyingURLLoader.TotalRequestTime", "network",
+     "Proxying URL loader, request lifetime"},
+    {"Brave.DomainBlock.ShouldBlock", "shields",
+     "Domain blocking decision, per navigation"},
+};
+
+class PerformanceDOMHandler : public content::WebUIMessageHandler {
+ public:
+  PerformanceDOMHandler() = default;
+  ~PerformanceDOMHandler() override = default;
+  PerformanceDOMHandler(const PerformanceDOMHandler&) = delete;
+  PerformanceDOMHandler& operator=(const PerformanceDOMHandler&) = delete;
+
+  // WebUIMessageHandler implementation.
+  void RegisterMessages() override;
+
+ private:
+  void HandleGetTimingStats(const base::ListValue* args);
+};
+
+void PerformanceDOMHandler::RegisterMessages() {
+  web_ui()->RegisterMessageCallback(
+      "brave_performance.getTimingStats",
+      base::BindRepeating(&PerformanceDOMHandler::HandleGetTimingStats,
+                          base::Unretained(this)));
+}
+
+void PerformanceDOMHandler::HandleGetTimingStats(const base::ListValue* args) {
+  DCHECK_EQ(args->GetSize(), 0U);
+  AllowJavascript();
+
+  base::ListValue stats;
+  for (const auto& source : kTimingSources) {
+    base::Value entry(base::Value::Type::DICTIONARY);
+    entry.SetStringKey("histogram", source.histogram_name);
+    entry.SetStringKey("subsystem", source.subsystem);
+    entry.SetStringKey("description", source.description);
+
+    int count = 0;
+    int64_t sum_ms = 0;
+    base::HistogramBase* histogram =
+        base::StatisticsRecorder::FindHistogram(source.histogram_name);
+    if (histogram) {
+      std::unique_ptr<base::HistogramSamples> samples =
+          histogram->SnapshotSamples();
+      count = samples->TotalCount();
+      sum_ms = samples->sum();
+    }
+    entry.SetIntKey("sampleCount", count);
+    entry.SetDoubleKey("totalTimeMs", static_cast<double>(sum_ms));
+    entry.SetDoubleKey("meanTimeMs",
+                       count ? static_cast<double>(sum_ms) / count : 0.0);
+    stats.Append(std::move(entry));
+  }
+
+  CallJavascriptFunction("brave_performance.onGetTimingStats", stats);
+}
+
+}  // namespace
+
+BravePerformanceUI::BravePerformanceUI(content::WebUI* web_ui,
+                                       const std::string& name)
+    : WebUIController(web_ui) {
+  CreateAndAddWebUIDataSource(web_ui, name, kBravePerformanceGenerated,
+                              kBravePerformanceGeneratedSize,
+                              IDR_BRAVE_PERFORMANCE_HTML);
+  web_ui->AddMessageHandler(std::make_unique<PerformanceDOMHandler>());
+}
+
+BravePerformanceUI::~BravePerformanceUI() = default;
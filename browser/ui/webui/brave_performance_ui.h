@@ -0,0 +1,24 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_BROWSER_UI_WEBUI_BRAVE_PERFORMANCE_UI_H_
+#define BRAVE_BROWSER_UI_WEBUI_BRAVE_PERFORMANCE_UI_H_
+
+#include <string>
+
+#include "content/public/browser/web_ui_controller.h"
+
+// brave://performance shows how much time Brave-added subsystems spend on
+// top of stock Chromium, using the timing instrumentation each subsystem
+// already records.
+class BravePerformanceUI : public content::WebUIController {
+ public:
+  BravePerformanceUI(content::WebUI* web_ui, const std::string& host);
+  ~BravePerformanceUI() override;
+  BravePerformanceUI(const BravePerformanceUI&) = delete;
+  BravePerformanceUI& operator=(const BravePerformanceUI&) = delete;
+};
+
+#endif  // BRAVE_BROWSER_UI_WEBUI_BRAVE_PERFORMANCE_UI_H_
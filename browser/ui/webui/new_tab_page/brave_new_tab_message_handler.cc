@@ -12,6 +12,7 @@
 #include "base/json/json_writer.h"
 #include "base/memory/weak_ptr.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/time/time.h"
 #include "base/values.h"
 #include "brave/browser/brave_ads/ads_service_factory.h"
 #include "brave/browser/ntp_background_images/view_counter_service_factory.h"
@@ -165,6 +166,12 @@ enum class NTPCustomizeUsage {
 const char kNTPCustomizeUsageStatus[] =
     "brave.new_tab_page.customize_p3a_usage";
 
+// Shields counters can increment many times per second on busy pages, and a
+// single blocked request bumps more than one observed pref. Wait a moment so
+// a burst of pref writes becomes one message to the page.
+constexpr base::TimeDelta kStatsUpdateDelay =
+    base::TimeDelta::FromMilliseconds(500);
+
 }  // namespace
 
 // static
@@ -425,6 +432,9 @@ void BraveNewTabMessageHandler::OnJavascriptAllowed() {
 
 void BraveNewTabMessageHandler::OnJavascriptDisallowed() {
   pref_change_registrar_.RemoveAll();
+  stats_update_timer_.Stop();
+  last_sent_stats_ = base::Value();
+  last_sent_preferences_ = base::Value();
 #if BUILDFLAG(ENABLE_TOR)
   if (tor_launcher_factory_)
     tor_launcher_factory_->RemoveObserver(this);
@@ -814,15 +824,31 @@ void BraveNewTabMessageHandler::OnPrivatePropertiesChanged() {
 }
 
 void BraveNewTabMessageHandler::OnStatsChanged() {
+  // An already scheduled update will pick this change up too.
+  if (stats_update_timer_.IsRunning())
+    return;
+  stats_update_timer_.Start(FROM_HERE, kStatsUpdateDelay, this,
+                            &BraveNewTabMessageHandler::SendStatsUpdate);
+}
+
+void BraveNewTabMessageHandler::SendStatsUpdate() {
   PrefService* prefs = profile_->GetPrefs();
   auto data = GetStatsDictionary(prefs);
+  // Some observed prefs (e.g. HTTPS upgrades) don't surface in the stats
+  // payload, so changes can leave it identical to what the page already has.
+  if (data == last_sent_stats_)
+    return;
   FireWebUIListener("stats-updated", data);
+  last_sent_stats_ = std::move(data);
 }
 
 void BraveNewTabMessageHandler::OnPreferencesChanged() {
   PrefService* prefs = profile_->GetPrefs();
   auto data = GetPreferencesDictionary(prefs);
+  if (data == last_sent_preferences_)
+    return;
   FireWebUIListener("preferences-changed", data);
+  last_sent_preferences_ = std::move(data);
 }
 
 void BraveNewTabMessageHandler::OnTorCircuitEstablished(bool result) {
@@ -9,6 +9,8 @@
 #include <string>
 
 #include "base/memory/weak_ptr.h"
+#include "base/timer/timer.h"
+#include "base/values.h"
 #include "brave/components/tor/buildflags/buildflags.h"
 #include "brave/components/tor/tor_launcher_observer.h"
 #include "components/prefs/pref_change_registrar.h"
@@ -69,12 +71,20 @@ class BraveNewTabMessageHandler : public content::WebUIMessageHandler,
   void OnStatsChanged();
   void OnPreferencesChanged();
   void OnPrivatePropertiesChanged();
+  void SendStatsUpdate();
 
   // TorLauncherObserver:
   void OnTorCircuitEstablished(bool result) override;
   void OnTorInitializing(const std::string& percentage) override;
 
   PrefChangeRegistrar pref_change_registrar_;
+  // Coalesces bursts of stats pref updates (every blocked resource bumps
+  // more than one counter) into a single push to the page.
+  base::OneShotTimer stats_update_timer_;
+  // Last payloads pushed to the page; pushes that wouldn't change anything
+  // the page can see are skipped.
+  base::Value last_sent_stats_;
+  base::Value last_sent_preferences_;
   // Weak pointer.
   Profile* profile_;
 #if BUILDFLAG(ENABLE_TOR)
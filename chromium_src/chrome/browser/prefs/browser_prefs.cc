@@ -12,6 +12,7 @@
 #include "brave/components/tor/buildflags/buildflags.h"
 #include "chrome/browser/profiles/profile.h"
 #include "components/gcm_driver/gcm_buildflags.h"
+#include "components/prefs/pref_service.h"
 #include "third_party/widevine/cdm/buildflags.h"
 
 #if BUILDFLAG(ENABLE_TOR)
@@ -35,6 +36,18 @@
 
 // This method should be periodically pruned of year+ old migrations.
 void MigrateObsoleteProfilePrefs(Profile* profile) {
+  PrefService* prefs = profile->GetPrefs();
+
+  // Profiles that already ran every Brave migration below skip the per-pref
+  // probing; only the Chromium migrations still run. The sentinel is bumped
+  // together with kBraveProfilePrefsMigrationCurrentVersion whenever a
+  // migration is added here.
+  if (prefs->GetInteger(kBraveProfilePrefsMigrationVersion) >=
+      brave::kBraveProfilePrefsMigrationCurrentVersion) {
+    MigrateObsoleteProfilePrefs_ChromiumImpl(profile);
+    return;
+  }
+
 #if !BUILDFLAG(USE_GCM_FROM_PLATFORM)
   // Added 02/2020.
   // Must be called before ChromiumImpl because it's migrating a Chromium pref
@@ -62,6 +75,13 @@ void MigrateObsoleteProfilePrefs(Profile* profile) {
   profile->GetPrefs()->ClearPref(kAlternativeSearchEngineProviderInTor);
   // Added 05/2021
   profile->GetPrefs()->ClearPref(kBraveTodayIntroDismissed);
+
+  // All migrations up to the current schema version have run; subsequent
+  // startups take the early return above. The writes queued by the
+  // migrations and this sentinel are flushed in a single scheduled
+  // serialization of the pref store.
+  prefs->SetInteger(kBraveProfilePrefsMigrationVersion,
+                    brave::kBraveProfilePrefsMigrationCurrentVersion);
 }
 
 // This method should be periodically pruned of year+ old migrations.
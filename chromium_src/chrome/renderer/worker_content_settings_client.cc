@@ -9,6 +9,9 @@
 #include "components/content_settings/renderer/content_settings_agent_impl.h"
 
 BraveFarblingLevel WorkerContentSettingsClient::GetBraveFarblingLevel() {
+  if (cached_farbling_level_)
+    return *cached_farbling_level_;
+
   ContentSetting setting = CONTENT_SETTING_DEFAULT;
   if (content_setting_rules_) {
     const GURL& primary_url = top_frame_origin_.GetURL();
@@ -29,13 +32,17 @@ BraveFarblingLevel WorkerContentSettingsClient::GetBraveFarblingLevel() {
           content_setting_rules_->fingerprinting_rules, primary_url);
     }
   }
+  BraveFarblingLevel level = BraveFarblingLevel::BALANCED;
   if (setting == CONTENT_SETTING_BLOCK) {
-    return BraveFarblingLevel::MAXIMUM;
+    level = BraveFarblingLevel::MAXIMUM;
   } else if (setting == CONTENT_SETTING_ALLOW) {
-    return BraveFarblingLevel::OFF;
-  } else {
-    return BraveFarblingLevel::BALANCED;
+    level = BraveFarblingLevel::OFF;
   }
+  // Only remember the answer once rules are available; a worker constructed
+  // without rules must not pin the default for its whole lifetime.
+  if (content_setting_rules_)
+    cached_farbling_level_ = level;
+  return level;
 }
 
 bool WorkerContentSettingsClient::AllowFingerprinting(
@@ -6,9 +6,20 @@
 #ifndef BRAVE_CHROMIUM_SRC_CHROME_RENDERER_WORKER_CONTENT_SETTINGS_CLIENT_H_
 #define BRAVE_CHROMIUM_SRC_CHROME_RENDERER_WORKER_CONTENT_SETTINGS_CLIENT_H_
 
-#define BRAVE_WORKER_CONTENT_SETTINGS_CLIENT_H         \
-  BraveFarblingLevel GetBraveFarblingLevel() override; \
-  bool AllowFingerprinting(bool enabled_per_settings) override;
+#include "third_party/abseil-cpp/absl/types/optional.h"
+
+// The cached level is the farbling policy compiled for this worker scope.
+// The origins and content setting rules a worker sees are fixed at creation,
+// so the pattern match runs once and every later farbling site (canvas,
+// audio, device APIs) reads the cached value.
+#define BRAVE_WORKER_CONTENT_SETTINGS_CLIENT_H                  \
+  BraveFarblingLevel GetBraveFarblingLevel() override;          \
+  bool AllowFingerprinting(bool enabled_per_settings) override; \
+                                                                \
+ private:                                                       \
+  absl::optional<BraveFarblingLevel> cached_farbling_level_;    \
+                                                                \
+ public:
 
 #include "../../../../chrome/renderer/worker_content_settings_client.h"
 
@@ -5,8 +5,7 @@
 
 #include "content/public/browser/tld_ephemeral_lifetime.h"
 
-#include <map>
-
+#include "base/containers/flat_map.h"
 #include "base/no_destructor.h"
 #include "services/network/public/mojom/cookie_manager.mojom.h"
 
@@ -15,12 +14,14 @@ namespace content {
 namespace {
 
 using TLDEphemeralLifetimeMap =
-    std::map<TLDEphemeralLifetimeKey, base::WeakPtr<TLDEphemeralLifetime>>;
+    base::flat_map<TLDEphemeralLifetimeKey, base::WeakPtr<TLDEphemeralLifetime>>;
 
 // This map allows TLDEphemeralLifetime to manage the lifetime of ephemeral
 // storage. We use weak pointers so that we can catch misuse of more easily.
 // With weak pointers, these entries will become null if they are destroyed,
-// but not removed from the map.
+// but not removed from the map. The map is read-mostly, i.e. one lookup per
+// frame creating an ephemeral storage namespace and one mutation per TLD
+// lifetime, so the few live entries are kept contiguous for lookups.
 TLDEphemeralLifetimeMap& active_tld_storage_areas() {
   static base::NoDestructor<TLDEphemeralLifetimeMap> active_storage_areas;
   return *active_storage_areas.get();
@@ -31,10 +32,10 @@ TLDEphemeralLifetimeMap& active_tld_storage_areas() {
 TLDEphemeralLifetime::TLDEphemeralLifetime(const TLDEphemeralLifetimeKey& key,
                                            StoragePartition* storage_partition)
     : key_(key), storage_partition_(storage_partition) {
-  DCHECK(active_tld_storage_areas().find(key_) ==
-         active_tld_storage_areas().end());
   DCHECK(storage_partition_);
-  active_tld_storage_areas().emplace(key_, weak_factory_.GetWeakPtr());
+  const auto result =
+      active_tld_storage_areas().emplace(key_, weak_factory_.GetWeakPtr());
+  DCHECK(result.second);
 }
 
 TLDEphemeralLifetime::~TLDEphemeralLifetime() {
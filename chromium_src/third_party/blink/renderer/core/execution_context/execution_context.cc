@@ -5,8 +5,17 @@
 
 #include "third_party/blink/renderer/core/execution_context/execution_context.h"
 
+#include <array>
+#include <map>
+#include <string>
+
 #include "base/command_line.h"
+#include "base/containers/span.h"
+#include "base/hash/hash.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/synchronization/lock.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/third_party/blink/renderer/brave_farbling_constants.h"
 #include "crypto/hmac.h"
 #include "third_party/blink/public/platform/web_content_settings_client.h"
@@ -31,27 +40,48 @@ inline uint64_t lfsr_next(uint64_t v) {
   return ((v >> 1) | (((v << 62) ^ (v << 61)) & (~(~zero << 63) << 62)));
 }
 
-float Identity(float value, size_t index) {
-  return value;
-}
-
-float ConstantMultiplier(double fudge_factor, float value, size_t index) {
-  return value * fudge_factor;
-}
+// Domain keys derived this session, shared by every execution context in the
+// renderer process. All frames and workers of one eTLD+1 farble with the same
+// key, so the HMAC over (session key, domain) only needs to run once per
+// domain instead of once per context. The session key comes from the command
+// line and never changes within a process; contexts are created on the main
+// thread and on worker threads, hence the lock.
+class DomainKeyCache {
+ public:
+  static DomainKeyCache& GetInstance() {
+    static base::NoDestructor<DomainKeyCache> instance;
+    return *instance;
+  }
 
-float PseudoRandomSequence(uint64_t seed, float value, size_t index) {
-  static uint64_t v;
-  const double maxUInt64AsDouble = UINT64_MAX;
-  if (index == 0) {
-    // start of loop, reset to initial seed which was passed in and is based on
-    // the domain key
-    v = seed;
+  // Copies the key for |domain| into |key|, deriving and caching it on the
+  // first request for that domain.
+  void GetDomainKey(uint64_t session_key,
+                    const std::string& domain,
+                    uint8_t (&key)[32]) {
+    base::AutoLock lock(lock_);
+    auto it = keys_.find(domain);
+    if (it == keys_.end()) {
+      // The single derivation point for farbling keys; trace it to measure
+      // how much time farbling spends in key setup.
+      TRACE_EVENT1("brave", "BraveSessionCache::DeriveDomainKey", "domain",
+                   domain);
+      std::array<uint8_t, 32> derived;
+      crypto::HMAC h(crypto::HMAC::SHA256);
+      CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_key),
+                   sizeof session_key));
+      CHECK(h.Sign(domain, derived.data(), derived.size()));
+      it = keys_.emplace(domain, derived).first;
+    }
+    memcpy(key, it->second.data(), it->second.size());
   }
-  // get next value in PRNG sequence
-  v = lfsr_next(v);
-  // return pseudo-random float between 0 and 0.1
-  return (v / maxUInt64AsDouble) / 10;
-}
+
+ private:
+  friend class base::NoDestructor<DomainKeyCache>;
+  DomainKeyCache() = default;
+
+  base::Lock lock_;
+  std::map<std::string, std::array<uint8_t, 32>> keys_;
+};
 
 }  // namespace
 
@@ -88,6 +118,7 @@ blink::WebContentSettingsClient* GetContentSettingsClientFor(
 BraveSessionCache::BraveSessionCache(ExecutionContext& context)
     : Supplement<ExecutionContext>(context) {
   farbling_enabled_ = false;
+  has_last_canvas_key_ = false;
   scoped_refptr<const blink::SecurityOrigin> origin;
   if (auto* window = blink::DynamicTo<blink::LocalDOMWindow>(context)) {
     auto* frame = window->GetFrame();
@@ -113,10 +144,7 @@ BraveSessionCache::BraveSessionCache(ExecutionContext& context)
   DCHECK(cmd_line->HasSwitch(kBraveSessionToken));
   base::StringToUint64(cmd_line->GetSwitchValueASCII(kBraveSessionToken),
                        &session_key_);
-  crypto::HMAC h(crypto::HMAC::SHA256);
-  CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_key_),
-               sizeof session_key_));
-  CHECK(h.Sign(domain, domain_key_, sizeof domain_key_));
+  DomainKeyCache::GetInstance().GetDomainKey(session_key_, domain, domain_key_);
   farbling_enabled_ = true;
 }
 
@@ -130,7 +158,7 @@ BraveSessionCache& BraveSessionCache::From(ExecutionContext& context) {
   return *cache;
 }
 
-AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
+AudioFarblingHelper BraveSessionCache::GetAudioFarblingHelper(
     blink::WebContentSettingsClient* settings) {
   if (farbling_enabled_ && settings) {
     switch (settings->GetBraveFarblingLevel()) {
@@ -143,15 +171,51 @@ AudioFarblingCallback BraveSessionCache::GetAudioFarblingCallback(
         double fudge_factor = 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
         VLOG(1) << "audio fudge factor (based on session token) = "
                 << fudge_factor;
-        return base::BindRepeating(&ConstantMultiplier, fudge_factor);
+        return AudioFarblingHelper::MakeConstantMultiplier(fudge_factor);
       }
       case BraveFarblingLevel::MAXIMUM: {
         uint64_t seed = *reinterpret_cast<uint64_t*>(domain_key_);
-        return base::BindRepeating(&PseudoRandomSequence, seed);
+        return AudioFarblingHelper::MakePseudoRandomSequence(seed);
       }
     }
   }
-  return base::BindRepeating(&Identity);
+  return AudioFarblingHelper();
+}
+
+void BraveSessionCache::FarbleAudioChannel(
+    blink::WebContentSettingsClient* settings,
+    float* destination,
+    size_t length) {
+  if (!farbling_enabled_ || !settings || length == 0)
+    return;
+  switch (settings->GetBraveFarblingLevel()) {
+    case BraveFarblingLevel::OFF:
+      break;
+    case BraveFarblingLevel::BALANCED: {
+      const uint64_t* fudge = reinterpret_cast<const uint64_t*>(domain_key_);
+      const double maxUInt64AsDouble = UINT64_MAX;
+      const float fudge_factor = 0.99 + ((*fudge / maxUInt64AsDouble) / 100);
+      VLOG(1) << "audio fudge factor (based on session token) = "
+              << fudge_factor;
+      // A plain multiply loop with no per-sample indirection, which the
+      // compiler can vectorize.
+      for (size_t i = 0; i < length; ++i)
+        destination[i] *= fudge_factor;
+      break;
+    }
+    case BraveFarblingLevel::MAXIMUM: {
+      // This level replaces the samples with a pseudo-random sequence, so
+      // the input values are ignored. The LFSR state is local; the
+      // generated sequence is identical to AudioFarblingHelper's.
+      uint64_t v = *reinterpret_cast<uint64_t*>(domain_key_);
+      const double maxUInt64AsDouble = UINT64_MAX;
+      for (size_t i = 0; i < length; ++i) {
+        v = lfsr_next(v);
+        destination[i] = (v / maxUInt64AsDouble) / 10;
+      }
+      break;
+    }
+  }
 }
 
 void BraveSessionCache::PerturbPixels(blink::WebContentSettingsClient* settings,
@@ -187,14 +251,27 @@ void BraveSessionCache::PerturbPixelsInternal(const unsigned char* data,
   const size_t pixel_count = size / 4;
   // calculate initial seed to find first pixel to perturb, based on session
   // key, domain key, and canvas contents
-  crypto::HMAC h(crypto::HMAC::SHA256);
-  uint64_t session_plus_domain_key =
-      session_key_ ^ *reinterpret_cast<uint64_t*>(domain_key_);
-  CHECK(h.Init(reinterpret_cast<const unsigned char*>(&session_plus_domain_key),
-               sizeof session_plus_domain_key));
   uint8_t canvas_key[32];
-  CHECK(h.Sign(base::StringPiece(reinterpret_cast<const char*>(pixels), size),
-               canvas_key, sizeof canvas_key));
+  const uint64_t content_hash = base::FastHash(base::make_span(pixels, size));
+  if (has_last_canvas_key_ && last_canvas_size_ == size &&
+      last_canvas_content_hash_ == content_hash) {
+    // Unchanged content derives the same canvas key, so the HMAC over the
+    // whole pixel buffer can be skipped.
+    memcpy(canvas_key, last_canvas_key_, sizeof canvas_key);
+  } else {
+    crypto::HMAC h(crypto::HMAC::SHA256);
+    uint64_t session_plus_domain_key =
+        session_key_ ^ *reinterpret_cast<uint64_t*>(domain_key_);
+    CHECK(h.Init(
+        reinterpret_cast<const unsigned char*>(&session_plus_domain_key),
+        sizeof session_plus_domain_key));
+    CHECK(h.Sign(base::StringPiece(reinterpret_cast<const char*>(pixels), size),
+                 canvas_key, sizeof canvas_key));
+    memcpy(last_canvas_key_, canvas_key, sizeof last_canvas_key_);
+    last_canvas_size_ = size;
+    last_canvas_content_hash_ = content_hash;
+    has_last_canvas_key_ = true;
+  }
   uint64_t v = *reinterpret_cast<uint64_t*>(canvas_key);
   uint64_t pixel_index;
   // choose which channel (R, G, or B) to perturb
@@ -218,6 +295,12 @@ void BraveSessionCache::PerturbPixelsInternal(const unsigned char* data,
 
 WTF::String BraveSessionCache::GenerateRandomString(std::string seed,
                                                     wtf_size_t length) {
+  const WTF::String memo_key =
+      WTF::String(seed.data(), static_cast<wtf_size_t>(seed.size())) + "/" +
+      WTF::String::Number(length);
+  const auto memo_it = random_string_memo_.find(memo_key);
+  if (memo_it != random_string_memo_.end())
+    return memo_it->value;
   uint8_t key[32];
   crypto::HMAC h(crypto::HMAC::SHA256);
   CHECK(h.Init(reinterpret_cast<const unsigned char*>(&domain_key_),
@@ -232,6 +315,7 @@ WTF::String BraveSessionCache::GenerateRandomString(std::string seed,
         kLettersForRandomStrings[v % kLettersForRandomStringsLength];
     v = lfsr_next(v);
   }
+  random_string_memo_.insert(memo_key, value);
   return value;
 }
 
@@ -10,7 +10,9 @@
 
 #include <random>
 
-#include "base/callback.h"
+#include "brave/third_party/blink/renderer/brave_audio_farbling_helper.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace blink {
 class WebContentSettingsClient;
@@ -26,8 +28,6 @@ using blink::TraceTrait;
 
 namespace brave {
 
-typedef base::RepeatingCallback<float(float, size_t)> AudioFarblingCallback;
-
 CORE_EXPORT blink::WebContentSettingsClient* GetContentSettingsClientFor(
     ExecutionContext* context);
 
@@ -42,8 +42,14 @@ class CORE_EXPORT BraveSessionCache final
 
   static BraveSessionCache& From(ExecutionContext&);
 
-  AudioFarblingCallback GetAudioFarblingCallback(
+  AudioFarblingHelper GetAudioFarblingHelper(
       blink::WebContentSettingsClient* settings);
+  // Farbles a whole channel of samples in one call. Unlike the per-sample
+  // helper above, this runs a single tight loop and should be preferred
+  // wherever the destination buffer is contiguous.
+  void FarbleAudioChannel(blink::WebContentSettingsClient* settings,
+                          float* destination,
+                          size_t length);
   void PerturbPixels(blink::WebContentSettingsClient* settings,
                      const unsigned char* data,
                      size_t size);
@@ -55,6 +61,19 @@ class CORE_EXPORT BraveSessionCache final
   bool farbling_enabled_;
   uint64_t session_key_;
   uint8_t domain_key_[32];
+  // Memo of the last canvas key derivation. Scripts typically read an
+  // unchanged canvas repeatedly, and the dominant farbling cost is the HMAC
+  // over the whole pixel buffer that derives the canvas key, so the derived
+  // key is reused while the content stays the same.
+  bool has_last_canvas_key_;
+  size_t last_canvas_size_;
+  uint64_t last_canvas_content_hash_;
+  uint8_t last_canvas_key_[32];
+  // Memo of derived random strings, keyed by (seed, length). The values are
+  // deterministic for a given domain key, and fingerprinting scripts query
+  // the same farbled parameters (WebGL unmasked renderer/vendor, plugin
+  // names) in bursts, so repeat queries become table reads instead of HMACs.
+  WTF::HashMap<WTF::String, WTF::String> random_string_memo_;
 
   void PerturbPixelsInternal(const unsigned char* data, size_t size);
 };
@@ -14,6 +14,7 @@
 #include "third_party/blink/renderer/core/frame/local_dom_window.h"
 #include "third_party/blink/renderer/core/frame/web_local_frame_impl.h"
 #include "third_party/blink/renderer/modules/storage/brave_dom_window_storage.h"
+#include "third_party/blink/renderer/platform/weborigin/security_origin_hash.h"
 
 namespace blink {
 
@@ -68,11 +69,25 @@ class EphemeralStorageNamespaces
 
   StorageNamespace* session_storage() { return session_storage_.Get(); }
   StorageNamespace* local_storage() { return local_storage_.Get(); }
+  scoped_refptr<CachedStorageArea> GetLocalStorageArea(LocalDOMWindow* window);
   void Trace(Visitor* visitor) const override;
 
  private:
   Member<StorageNamespace> session_storage_;
   Member<StorageNamespace> local_storage_;
+
+  // Ephemeral localStorage areas are backed by sessionStorage-type areas
+  // created outside |local_storage_|, so the per-origin reuse that
+  // StorageNamespace::GetCachedArea provides has to be replicated here.
+  // Without it every same-origin third-party frame allocates its own area,
+  // which adds up quickly on ad-iframe-heavy pages. The pool lives and dies
+  // with the Page. Keyed like StorageNamespace's own cache: SecurityOriginHash
+  // is nonce-aware, so distinct opaque (sandboxed) origins never share an
+  // area even though they all serialize to "null".
+  HashMap<scoped_refptr<const SecurityOrigin>,
+          scoped_refptr<CachedStorageArea>,
+          SecurityOriginHash>
+      local_storage_areas_;
 };
 
 const char EphemeralStorageNamespaces::kSupplementName[] =
@@ -90,6 +105,23 @@ EphemeralStorageNamespaces::EphemeralStorageNamespaces(
                                                             local_storage_id)) {
 }
 
+scoped_refptr<CachedStorageArea>
+EphemeralStorageNamespaces::GetLocalStorageArea(LocalDOMWindow* window) {
+  scoped_refptr<const SecurityOrigin> origin(window->GetSecurityOrigin());
+  auto it = local_storage_areas_.find(origin);
+  if (it != local_storage_areas_.end())
+    return it->value;
+
+  auto* controller = StorageController::GetInstance();
+  controller->ClearAreasIfNeeded();
+  auto storage_area = base::MakeRefCounted<CachedStorageArea>(
+      CachedStorageArea::AreaType::kSessionStorage, origin,
+      controller->TaskRunner(), local_storage_.Get(),
+      /*is_session_storage_for_prerendering=*/false);
+  local_storage_areas_.Set(std::move(origin), storage_area);
+  return storage_area;
+}
+
 void EphemeralStorageNamespaces::Trace(Visitor* visitor) const {
   visitor->Trace(session_storage_);
   visitor->Trace(local_storage_);
@@ -223,12 +255,7 @@ StorageArea* BraveDOMWindowStorage::ephemeralLocalStorage() {
   if (!namespaces)
     return nullptr;
 
-  auto* controller = StorageController::GetInstance();
-  controller->ClearAreasIfNeeded();
-  auto storage_area = base::MakeRefCounted<CachedStorageArea>(
-      CachedStorageArea::AreaType::kSessionStorage, window->GetSecurityOrigin(),
-      controller->TaskRunner(), namespaces->local_storage(),
-      /*is_session_storage_for_prerendering=*/false);
+  auto storage_area = namespaces->GetLocalStorageArea(window);
 
   // Ephemeral localStorage never persists stored data, which is also how
   // sessionStorage works. Due to this, when opening up a new ephemeral
@@ -3,25 +3,20 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
-#define BRAVE_REALTIMEANALYSER_CONVERTFLOATTODB                       \
-  if (audio_farbling_callback_) {                                     \
-    destination[i] = audio_farbling_callback_.Run(destination[i], i); \
-  }
+// Farble() is a plain inline method, so these expand to a multiply or an
+// LFSR step inside the conversion loops instead of a callback dispatch per
+// sample.
+#define BRAVE_REALTIMEANALYSER_CONVERTFLOATTODB \
+  destination[i] = audio_farbling_helper_.Farble(destination[i], i);
 
-#define BRAVE_REALTIMEANALYSER_CONVERTTOBYTEDATA                  \
-  if (audio_farbling_callback_) {                                 \
-    scaled_value = audio_farbling_callback_.Run(scaled_value, i); \
-  }
+#define BRAVE_REALTIMEANALYSER_CONVERTTOBYTEDATA \
+  scaled_value = audio_farbling_helper_.Farble(scaled_value, i);
 
-#define BRAVE_REALTIMEANALYSER_GETFLOATTIMEDOMAINDATA        \
-  if (audio_farbling_callback_) {                            \
-    destination[i] = audio_farbling_callback_.Run(value, i); \
-  }
+#define BRAVE_REALTIMEANALYSER_GETFLOATTIMEDOMAINDATA \
+  destination[i] = audio_farbling_helper_.Farble(value, i);
 
 #define BRAVE_REALTIMEANALYSER_GETBYTETIMEDOMAINDATA \
-  if (audio_farbling_callback_) {                    \
-    value = audio_farbling_callback_.Run(value, i);  \
-  }
+  value = audio_farbling_helper_.Farble(value, i);
 
 #include "../../../../../../../third_party/blink/renderer/modules/webaudio/realtime_analyser.cc"
 
@@ -86,6 +86,8 @@ const char kBraveSuggestedSiteSuggestionsEnabled[] =
 const char kBraveDarkMode[] = "brave.dark_mode";
 const char kOtherBookmarksMigrated[] = "brave.other_bookmarks_migrated";
 const char kBraveShieldsSettingsVersion[] = "brave.shields_settings_version";
+const char kBraveProfilePrefsMigrationVersion[] =
+    "brave.profile_prefs_migration_version";
 const char kDefaultBrowserPromptEnabled[] =
     "brave.default_browser_prompt_enabled";
 #if !BUILDFLAG(USE_GCM_FROM_PLATFORM)
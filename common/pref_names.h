@@ -71,6 +71,7 @@ extern const char kBraveSuggestedSiteSuggestionsEnabled[];
 extern const char kBraveDarkMode[];
 extern const char kOtherBookmarksMigrated[];
 extern const char kBraveShieldsSettingsVersion[];
+extern const char kBraveProfilePrefsMigrationVersion[];
 extern const char kBinanceAccessToken[];
 extern const char kBinanceRefreshToken[];
 extern const char kDefaultBrowserPromptEnabled[];
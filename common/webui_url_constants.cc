@@ -10,6 +10,7 @@ const char kAdblockJS[] = "brave_adblock.js";
 const char kIPFSWebUIHost[] = "ipfs-internals";
 const char kIPFSWebUIURL[] = "chrome://ipfs-internals/";
 const char kWebcompatReporterHost[] = "webcompat";
+const char kPerformanceHost[] = "performance";
 const char kRewardsPageHost[] = "rewards";
 const char kRewardsInternalsHost[] = "rewards-internals";
 const char kWelcomeHost[] = "welcome";
@@ -11,6 +11,7 @@ extern const char kAdblockJS[];
 extern const char kIPFSWebUIHost[];
 extern const char kIPFSWebUIURL[];
 extern const char kWebcompatReporterHost[];
+extern const char kPerformanceHost[];
 extern const char kRewardsPageHost[];
 extern const char kRewardsInternalsHost[];
 extern const char kWelcomeHost[];
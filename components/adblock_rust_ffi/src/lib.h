@@ -50,6 +50,61 @@ void engine_match(struct C_Engine *engine,
                   bool *did_match_important,
                   char **redirect);
 
+/**
+ * Variant of `engine_match` taking explicit pointer+length string slices.
+ * Avoids the caller-side NUL-terminated copies and the callee-side strlen
+ * that the string based entry point requires. The slices must be valid UTF-8.
+ */
+void engine_match_view(struct C_Engine *engine,
+                       const char *url,
+                       size_t url_len,
+                       const char *host,
+                       size_t host_len,
+                       const char *tab_host,
+                       size_t tab_host_len,
+                       bool third_party,
+                       const char *resource_type,
+                       size_t resource_type_len,
+                       bool *did_match_rule,
+                       bool *did_match_exception,
+                       bool *did_match_important,
+                       char **redirect);
+
+/**
+ * Checks a `url` against several `Engine`s in a single FFI crossing, chaining
+ * block results across engines exactly as repeated `engine_match` calls
+ * would. Stops early once an `important` rule matches.
+ */
+void engine_match_multi(struct C_Engine *const *engines,
+                        size_t engine_count,
+                        const char *url,
+                        const char *host,
+                        const char *tab_host,
+                        bool third_party,
+                        const char *resource_type,
+                        bool *did_match_rule,
+                        bool *did_match_exception,
+                        bool *did_match_important,
+                        char **redirect);
+
+/**
+ * Checks a batch of urls against the specified `Engine` in a single FFI
+ * crossing. All arrays must have `count` elements; result slots use the same
+ * in/out semantics as `engine_match` so batches can be chained across
+ * multiple engines.
+ */
+void engine_match_batch(struct C_Engine *engine,
+                        size_t count,
+                        const char *const *urls,
+                        const char *const *hosts,
+                        const char *const *tab_hosts,
+                        const bool *third_parties,
+                        const char *const *resource_types,
+                        bool *did_match_rules,
+                        bool *did_match_exceptions,
+                        bool *did_match_importants,
+                        char **redirects);
+
 /**
  * Returns any CSP directives that should be added to a subdocument or document request's response
  * headers.
@@ -98,6 +98,169 @@ pub unsafe extern "C" fn engine_match(
     };
 }
 
+/// Variant of `engine_match` taking explicit pointer+length string slices.
+/// Avoids the caller-side NUL-terminated copies and the callee-side strlen
+/// that the `CStr` based entry point requires. The slices must be valid
+/// UTF-8.
+#[no_mangle]
+pub unsafe extern "C" fn engine_match_view(
+    engine: *mut Engine,
+    url: *const c_char,
+    url_len: size_t,
+    host: *const c_char,
+    host_len: size_t,
+    tab_host: *const c_char,
+    tab_host_len: size_t,
+    third_party: bool,
+    resource_type: *const c_char,
+    resource_type_len: size_t,
+    did_match_rule: *mut bool,
+    did_match_exception: *mut bool,
+    did_match_important: *mut bool,
+    redirect: *mut *mut c_char,
+) {
+    let url = std::str::from_utf8_unchecked(std::slice::from_raw_parts(url as *const u8, url_len));
+    let host =
+        std::str::from_utf8_unchecked(std::slice::from_raw_parts(host as *const u8, host_len));
+    let tab_host = std::str::from_utf8_unchecked(std::slice::from_raw_parts(
+        tab_host as *const u8,
+        tab_host_len,
+    ));
+    let resource_type = std::str::from_utf8_unchecked(std::slice::from_raw_parts(
+        resource_type as *const u8,
+        resource_type_len,
+    ));
+    assert!(!engine.is_null());
+    let engine = Box::leak(Box::from_raw(engine));
+    let blocker_result = engine.check_network_urls_with_hostnames_subset(
+        url,
+        host,
+        tab_host,
+        resource_type,
+        Some(third_party),
+        *did_match_rule || *did_match_exception,
+        !*did_match_exception,
+    );
+    *did_match_rule |= blocker_result.matched;
+    *did_match_exception |= blocker_result.exception.is_some();
+    *did_match_important |= blocker_result.important;
+    *redirect = match blocker_result.redirect {
+        Some(x) => match CString::new(x) {
+            Ok(y) => y.into_raw(),
+            _ => ptr::null_mut(),
+        },
+        None => ptr::null_mut(),
+    };
+}
+
+/// Checks a `url` against several `Engine`s in a single FFI crossing,
+/// chaining block results across engines exactly as repeated `engine_match`
+/// calls would. Stops early once an `important` rule matches.
+#[no_mangle]
+pub unsafe extern "C" fn engine_match_multi(
+    engines: *const *mut Engine,
+    engine_count: size_t,
+    url: *const c_char,
+    host: *const c_char,
+    tab_host: *const c_char,
+    third_party: bool,
+    resource_type: *const c_char,
+    did_match_rule: *mut bool,
+    did_match_exception: *mut bool,
+    did_match_important: *mut bool,
+    redirect: *mut *mut c_char,
+) {
+    let engines = std::slice::from_raw_parts(engines, engine_count);
+    let url = CStr::from_ptr(url).to_str().unwrap();
+    let host = CStr::from_ptr(host).to_str().unwrap();
+    let tab_host = CStr::from_ptr(tab_host).to_str().unwrap();
+    let resource_type = CStr::from_ptr(resource_type).to_str().unwrap();
+    *redirect = ptr::null_mut();
+    for &engine in engines {
+        assert!(!engine.is_null());
+        let engine = Box::leak(Box::from_raw(engine));
+        let blocker_result = engine.check_network_urls_with_hostnames_subset(
+            url,
+            host,
+            tab_host,
+            resource_type,
+            Some(third_party),
+            *did_match_rule || *did_match_exception,
+            !*did_match_exception,
+        );
+        *did_match_rule |= blocker_result.matched;
+        *did_match_exception |= blocker_result.exception.is_some();
+        *did_match_important |= blocker_result.important;
+        if let Some(x) = blocker_result.redirect {
+            if let Ok(y) = CString::new(x) {
+                if !(*redirect).is_null() {
+                    drop(CString::from_raw(*redirect));
+                }
+                *redirect = y.into_raw();
+            }
+        }
+        if *did_match_important {
+            break;
+        }
+    }
+}
+
+/// Checks a batch of urls against the specified `Engine` in a single FFI
+/// crossing. All slices must have `count` elements; result slots use the same
+/// in/out semantics as `engine_match` so batches can be chained across
+/// multiple engines.
+#[no_mangle]
+pub unsafe extern "C" fn engine_match_batch(
+    engine: *mut Engine,
+    count: size_t,
+    urls: *const *const c_char,
+    hosts: *const *const c_char,
+    tab_hosts: *const *const c_char,
+    third_parties: *const bool,
+    resource_types: *const *const c_char,
+    did_match_rules: *mut bool,
+    did_match_exceptions: *mut bool,
+    did_match_importants: *mut bool,
+    redirects: *mut *mut c_char,
+) {
+    assert!(!engine.is_null());
+    let engine = Box::leak(Box::from_raw(engine));
+    let urls = std::slice::from_raw_parts(urls, count);
+    let hosts = std::slice::from_raw_parts(hosts, count);
+    let tab_hosts = std::slice::from_raw_parts(tab_hosts, count);
+    let third_parties = std::slice::from_raw_parts(third_parties, count);
+    let resource_types = std::slice::from_raw_parts(resource_types, count);
+    let did_match_rules = std::slice::from_raw_parts_mut(did_match_rules, count);
+    let did_match_exceptions = std::slice::from_raw_parts_mut(did_match_exceptions, count);
+    let did_match_importants = std::slice::from_raw_parts_mut(did_match_importants, count);
+    let redirects = std::slice::from_raw_parts_mut(redirects, count);
+    for i in 0..count {
+        let url = CStr::from_ptr(urls[i]).to_str().unwrap();
+        let host = CStr::from_ptr(hosts[i]).to_str().unwrap();
+        let tab_host = CStr::from_ptr(tab_hosts[i]).to_str().unwrap();
+        let resource_type = CStr::from_ptr(resource_types[i]).to_str().unwrap();
+        let blocker_result = engine.check_network_urls_with_hostnames_subset(
+            url,
+            host,
+            tab_host,
+            resource_type,
+            Some(third_parties[i]),
+            did_match_rules[i] || did_match_exceptions[i],
+            !did_match_exceptions[i],
+        );
+        did_match_rules[i] |= blocker_result.matched;
+        did_match_exceptions[i] |= blocker_result.exception.is_some();
+        did_match_importants[i] |= blocker_result.important;
+        redirects[i] = match blocker_result.redirect {
+            Some(x) => match CString::new(x) {
+                Ok(y) => y.into_raw(),
+                _ => ptr::null_mut(),
+            },
+            None => ptr::null_mut(),
+        };
+    }
+}
+
 /// Returns any CSP directives that should be added to a subdocument or document request's response
 /// headers.
 #[no_mangle]
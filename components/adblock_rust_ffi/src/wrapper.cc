@@ -65,6 +65,107 @@ void Engine::matches(const std::string& url,
   }
 }
 
+void Engine::matches(const char* url,
+                     size_t url_len,
+                     const char* host,
+                     size_t host_len,
+                     const char* tab_host,
+                     size_t tab_host_len,
+                     bool is_third_party,
+                     const char* resource_type,
+                     size_t resource_type_len,
+                     bool* did_match_rule,
+                     bool* did_match_exception,
+                     bool* did_match_important,
+                     std::string* redirect) {
+  char* redirect_char_ptr = nullptr;
+  engine_match_view(raw, url, url_len, host, host_len, tab_host, tab_host_len,
+                    is_third_party, resource_type, resource_type_len,
+                    did_match_rule, did_match_exception, did_match_important,
+                    &redirect_char_ptr);
+  if (redirect_char_ptr) {
+    if (redirect) {
+      *redirect = redirect_char_ptr;
+    }
+    c_char_buffer_destroy(redirect_char_ptr);
+  }
+}
+
+// static
+void Engine::matchesMulti(const std::vector<Engine*>& engines,
+                          const std::string& url,
+                          const std::string& host,
+                          const std::string& tab_host,
+                          bool is_third_party,
+                          const std::string& resource_type,
+                          bool* did_match_rule,
+                          bool* did_match_exception,
+                          bool* did_match_important,
+                          std::string* redirect) {
+  if (engines.empty())
+    return;
+  std::vector<C_Engine*> raw_engines;
+  raw_engines.reserve(engines.size());
+  for (Engine* engine : engines)
+    raw_engines.push_back(engine->raw);
+
+  char* redirect_char_ptr = nullptr;
+  engine_match_multi(raw_engines.data(), raw_engines.size(), url.c_str(),
+                     host.c_str(), tab_host.c_str(), is_third_party,
+                     resource_type.c_str(), did_match_rule, did_match_exception,
+                     did_match_important, &redirect_char_ptr);
+  if (redirect_char_ptr) {
+    if (redirect) {
+      *redirect = redirect_char_ptr;
+    }
+    c_char_buffer_destroy(redirect_char_ptr);
+  }
+}
+
+void Engine::matchesBatch(const std::vector<MatchQuery>& queries,
+                          std::vector<MatchResult>* results) {
+  const size_t count = queries.size();
+  if (count == 0)
+    return;
+  results->resize(count);
+
+  std::vector<const char*> urls(count);
+  std::vector<const char*> hosts(count);
+  std::vector<const char*> tab_hosts(count);
+  std::vector<const char*> resource_types(count);
+  std::vector<char*> redirects(count, nullptr);
+  // std::vector<bool> is a bitset and can't back a bool array.
+  std::unique_ptr<bool[]> third_parties(new bool[count]);
+  std::unique_ptr<bool[]> rules(new bool[count]);
+  std::unique_ptr<bool[]> exceptions(new bool[count]);
+  std::unique_ptr<bool[]> importants(new bool[count]);
+
+  for (size_t i = 0; i < count; i++) {
+    urls[i] = queries[i].url.c_str();
+    hosts[i] = queries[i].host.c_str();
+    tab_hosts[i] = queries[i].tab_host.c_str();
+    third_parties[i] = queries[i].is_third_party;
+    resource_types[i] = queries[i].resource_type.c_str();
+    rules[i] = (*results)[i].did_match_rule;
+    exceptions[i] = (*results)[i].did_match_exception;
+    importants[i] = (*results)[i].did_match_important;
+  }
+
+  engine_match_batch(raw, count, urls.data(), hosts.data(), tab_hosts.data(),
+                     third_parties.get(), resource_types.data(), rules.get(),
+                     exceptions.get(), importants.get(), redirects.data());
+
+  for (size_t i = 0; i < count; i++) {
+    (*results)[i].did_match_rule = rules[i];
+    (*results)[i].did_match_exception = exceptions[i];
+    (*results)[i].did_match_important = importants[i];
+    if (redirects[i]) {
+      (*results)[i].redirect = redirects[i];
+      c_char_buffer_destroy(redirects[i]);
+    }
+  }
+}
+
 std::string Engine::getCspDirectives(const std::string& url,
                                      const std::string& host,
                                      const std::string& tab_host,
@@ -64,6 +64,25 @@ class ADBLOCK_EXPORT FilterList {
   static std::vector<FilterList> regional_list;
 };
 
+// A single classification query for the batch matching API.
+struct ADBLOCK_EXPORT MatchQuery {
+  std::string url;
+  std::string host;
+  std::string tab_host;
+  bool is_third_party = false;
+  std::string resource_type;
+};
+
+// Per-query verdicts for the batch matching API. Fields are in/out, like the
+// out-parameters of `matches`, so results can be threaded through several
+// engines in sequence.
+struct ADBLOCK_EXPORT MatchResult {
+  bool did_match_rule = false;
+  bool did_match_exception = false;
+  bool did_match_important = false;
+  std::string redirect;
+};
+
 class ADBLOCK_EXPORT Engine {
  public:
   Engine();
@@ -77,6 +96,39 @@ class ADBLOCK_EXPORT Engine {
                bool* did_match_exception,
                bool* did_match_important,
                std::string* redirect);
+  // Zero-copy variant of `matches` taking pointer+length slices, so callers
+  // can pass non-owning pieces of existing buffers (e.g. GURL components)
+  // without materializing std::string copies per request.
+  void matches(const char* url,
+               size_t url_len,
+               const char* host,
+               size_t host_len,
+               const char* tab_host,
+               size_t tab_host_len,
+               bool is_third_party,
+               const char* resource_type,
+               size_t resource_type_len,
+               bool* did_match_rule,
+               bool* did_match_exception,
+               bool* did_match_important,
+               std::string* redirect);
+  // Classifies all of |queries| in a single FFI crossing. |results| must have
+  // the same size as |queries|; each slot is updated in place.
+  void matchesBatch(const std::vector<MatchQuery>& queries,
+                    std::vector<MatchResult>* results);
+  // Runs `matches` against every engine in |engines| in one FFI crossing,
+  // chaining verdicts across engines and stopping early on an important
+  // match. Used to query all enabled regional lists as a single lookup.
+  static void matchesMulti(const std::vector<Engine*>& engines,
+                           const std::string& url,
+                           const std::string& host,
+                           const std::string& tab_host,
+                           bool is_third_party,
+                           const std::string& resource_type,
+                           bool* did_match_rule,
+                           bool* did_match_exception,
+                           bool* did_match_important,
+                           std::string* redirect);
   std::string getCspDirectives(const std::string& url,
                                const std::string& host,
                                const std::string& tab_host,
@@ -0,0 +1,150 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/command_line.h"
+#include "base/files/file_util.h"
+#include "base/process/process_metrics.h"
+#include "base/strings/stringprintf.h"
+#include "base/timer/elapsed_timer.h"
+#include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+
+namespace adblock {
+
+namespace {
+
+// Points the benchmark at a real filter list (e.g. easylist.txt, optionally
+// with regional lists concatenated). Without the switch a synthetic list of
+// comparable shape is generated, so the benchmark stays hermetic on bots.
+constexpr char kRulesFileSwitch[] = "adblock-rules-file";
+
+constexpr size_t kTraceSize = 100000;
+constexpr size_t kSyntheticRuleCount = 30000;
+
+std::string LoadOrGenerateRules() {
+  const base::CommandLine* command_line =
+      base::CommandLine::ForCurrentProcess();
+  if (command_line->HasSwitch(kRulesFileSwitch)) {
+    std::string rules;
+    CHECK(base::ReadFileToString(
+        command_line->GetSwitchValuePath(kRulesFileSwitch), &rules));
+    return rules;
+  }
+
+  // Mix network rules, third-party rules, path rules and exceptions the way
+  // easylist does.
+  std::string rules;
+  rules.reserve(kSyntheticRuleCount * 40);
+  for (size_t i = 0; i < kSyntheticRuleCount; i++) {
+    switch (i % 4) {
+      case 0:
+        base::StringAppendF(&rules, "||ads%zu.example.com^\n", i);
+        break;
+      case 1:
+        base::StringAppendF(&rules, "||tracker%zu.example.net^$third-party\n",
+                            i);
+        break;
+      case 2:
+        base::StringAppendF(&rules, "/banner/%zu/*\n", i);
+        break;
+      case 3:
+        base::StringAppendF(&rules, "@@||cdn%zu.example.org^$image\n", i);
+        break;
+    }
+  }
+  return rules;
+}
+
+struct TraceEntry {
+  std::string url;
+  std::string host;
+};
+
+// Deterministic pseudo-trace: roughly 30% requests to blocked hosts and 70%
+// to clean publisher hosts, cycling through enough distinct hosts to defeat
+// any single-entry caching in the engine.
+std::vector<TraceEntry> BuildTrace() {
+  std::vector<TraceEntry> trace;
+  trace.reserve(kTraceSize);
+  for (size_t i = 0; i < kTraceSize; i++) {
+    TraceEntry entry;
+    switch (i % 10) {
+      case 0:
+      case 1:
+        // Index multiples of 4 exist as ||ads*.example.com^ rules.
+        entry.host = base::StringPrintf("ads%zu.example.com",
+                                        (i * 4) % kSyntheticRuleCount);
+        entry.url = "https://" + entry.host + "/pixel.gif";
+        break;
+      case 2:
+        // Index 4k+1 exists as a $third-party tracker rule.
+        entry.host = base::StringPrintf("tracker%zu.example.net",
+                                        (i * 4 + 1) % kSyntheticRuleCount);
+        entry.url = "https://" + entry.host + "/collect?i=1";
+        break;
+      default:
+        entry.host = base::StringPrintf("static%zu.publisher.com", i % 97);
+        entry.url = "https://" + entry.host + "/assets/app.js";
+        break;
+    }
+    trace.push_back(std::move(entry));
+  }
+  return trace;
+}
+
+}  // namespace
+
+TEST(AdBlockEnginePerfTest, MatchesTrace) {
+  const std::string rules = LoadOrGenerateRules();
+
+  // Engine memory is allocated on the malloc heap by the Rust side, so the
+  // malloc-usage delta across construction is the list's resident footprint.
+  // Reported as 0 on platforms without malloc introspection.
+  std::unique_ptr<base::ProcessMetrics> metrics =
+      base::ProcessMetrics::CreateCurrentProcessMetrics();
+  const size_t malloc_before = metrics->GetMallocUsage();
+  Engine engine(rules);
+  const size_t malloc_after = metrics->GetMallocUsage();
+
+  const std::vector<TraceEntry> trace = BuildTrace();
+
+  std::vector<double> latencies_us;
+  latencies_us.reserve(trace.size());
+
+  base::ElapsedTimer timer;
+  for (const auto& entry : trace) {
+    bool did_match_rule = false;
+    bool did_match_exception = false;
+    bool did_match_important = false;
+    std::string redirect;
+    base::ElapsedTimer request_timer;
+    engine.matches(entry.url, entry.host, "publisher.com", true, "script",
+                   &did_match_rule, &did_match_exception, &did_match_important,
+                   &redirect);
+    latencies_us.push_back(request_timer.Elapsed().InMicrosecondsF());
+  }
+  const base::TimeDelta elapsed = timer.Elapsed();
+
+  std::sort(latencies_us.begin(), latencies_us.end());
+  const double p99_latency = latencies_us[latencies_us.size() * 99 / 100];
+
+  perf_test::PerfResultReporter reporter("AdBlockEngine.", "matches_trace");
+  reporter.RegisterImportantMetric("throughput", "requests/s");
+  reporter.RegisterImportantMetric("p99_latency", "us");
+  reporter.RegisterImportantMetric("engine_heap", "bytes");
+  reporter.AddResult("throughput", trace.size() / elapsed.InSecondsF());
+  reporter.AddResult("p99_latency", p99_latency);
+  reporter.AddResult("engine_heap",
+                     static_cast<double>(malloc_after - malloc_before));
+}
+
+}  // namespace adblock
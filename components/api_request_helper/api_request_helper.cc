@@ -30,13 +30,15 @@ void APIRequestHelper::Request(
     const std::string& payload_content_type,
     bool auto_retry_on_network_change,
     ResultCallback callback,
-    const std::map<std::string, std::string>& headers) {
+    const std::map<std::string, std::string>& headers,
+    net::RequestPriority priority) {
   auto request = std::make_unique<network::ResourceRequest>();
   request->url = url;
   request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE |
                         net::LOAD_DO_NOT_SAVE_COOKIES;
   request->credentials_mode = network::mojom::CredentialsMode::kOmit;
   request->method = method;
+  request->priority = priority;
 
   if (!headers.empty()) {
     for (auto entry : headers)
@@ -81,7 +83,10 @@ void APIRequestHelper::OnResponse(
     }
   }
   url_loaders_.erase(iter);
-  std::move(callback).Run(response_code, response_body ? *response_body : "",
+  // API responses can run to hundreds of kilobytes; hand the body over
+  // without copying it.
+  std::move(callback).Run(response_code,
+                          response_body ? std::move(*response_body) : "",
                           headers);
 }
 
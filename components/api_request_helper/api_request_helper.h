@@ -12,6 +12,7 @@
 #include <string>
 
 #include "base/callback.h"
+#include "net/base/request_priority.h"
 #include "net/traffic_annotation/network_traffic_annotation.h"
 #include "url/gurl.h"
 
@@ -30,17 +31,23 @@ class APIRequestHelper {
       scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory);
   ~APIRequestHelper();
 
+  // The body is passed by value so the helper can hand it over without a
+  // copy; bound methods taking |const std::string&| keep working as before.
   using ResultCallback =
       base::OnceCallback<void(const int,
-                              const std::string&,
+                              std::string,
                               const std::map<std::string, std::string>&)>;
+  // |priority| lets background work (periodic widget refreshes) yield to
+  // requests that block visible UI; net::DEFAULT_PRIORITY leaves the
+  // scheduling decision to the network stack as before.
   void Request(const std::string& method,
                const GURL& url,
                const std::string& payload,
                const std::string& payload_content_type,
                bool auto_retry_on_network_change,
                ResultCallback callback,
-               const std::map<std::string, std::string>& headers = {});
+               const std::map<std::string, std::string>& headers = {},
+               net::RequestPriority priority = net::DEFAULT_PRIORITY);
 
  private:
   APIRequestHelper(const APIRequestHelper&) = delete;
@@ -46,6 +46,11 @@ const char oauth_scope[] =
     "user:email,user:address,asset:balance,asset:ocbs";
 const char oauth_url[] = "https://accounts.binance.com/en/oauth/authorize";
 const unsigned int kRetriesCountOnNetworkChange = 1;
+// How long a freshly obtained access token answers later token requests
+// without another OAuth round trip. Widgets request a token on every
+// load, far more often than the token actually expires.
+constexpr base::TimeDelta kAccessTokenFreshness =
+    base::TimeDelta::FromMinutes(10);
 
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("binance_service", R"(
@@ -114,8 +119,25 @@ std::string BinanceService::GetOAuthClientUrl() {
 }
 
 bool BinanceService::GetAccessToken(GetAccessTokenCallback callback) {
+  // Widgets call this on every load. Without a new auth code to exchange,
+  // a recently obtained access token answers directly instead of another
+  // OAuth round trip.
+  if (auth_token_.empty() && !access_token_.empty() &&
+      !access_token_obtained_at_.is_null() &&
+      base::TimeTicks::Now() - access_token_obtained_at_ <
+          kAccessTokenFreshness) {
+    std::move(callback).Run(true);
+    return true;
+  }
+
+  pending_access_token_callbacks_.push_back(std::move(callback));
+  if (pending_access_token_callbacks_.size() > 1) {
+    // A token request is already on its way; share its result.
+    return true;
+  }
+
   auto internal_callback = base::BindOnce(&BinanceService::OnGetAccessToken,
-      base::Unretained(this), std::move(callback));
+      base::Unretained(this));
   GURL base_url = GetURLWithPath(oauth_host_, oauth_path_access_token);
   GURL url = base_url;
   url = net::AppendQueryParameter(url, "grant_type", "authorization_code");
@@ -124,8 +146,13 @@ bool BinanceService::GetAccessToken(GetAccessTokenCallback callback) {
   url = net::AppendQueryParameter(url, "code_verifier", code_verifier_);
   url = net::AppendQueryParameter(url, "redirect_uri", oauth_callback);
   auth_token_.clear();
-  return OAuthRequest(
-      base_url, "POST", url.query(), std::move(internal_callback), true, true);
+  if (!OAuthRequest(
+          base_url, "POST", url.query(),
+          std::move(internal_callback), true, true)) {
+    pending_access_token_callbacks_.clear();
+    return false;
+  }
+  return true;
 }
 
 bool BinanceService::IsSupportedRegion() {
@@ -163,7 +190,6 @@ void BinanceService::OnGetAccountBalances(GetAccountBalancesCallback callback,
 }
 
 void BinanceService::OnGetAccessToken(
-    GetAccessTokenCallback callback,
     const int status, const std::string& body,
     const std::map<std::string, std::string>& headers) {
   std::string access_token;
@@ -173,7 +199,15 @@ void BinanceService::OnGetAccessToken(
     BinanceJSONParser::GetTokensFromJSON(body, &refresh_token, "refresh_token");
     SetAccessTokens(access_token, refresh_token);
   }
-  std::move(callback).Run(!access_token.empty());
+  const bool success = !access_token.empty();
+  if (success) {
+    access_token_obtained_at_ = base::TimeTicks::Now();
+  }
+  auto callbacks = std::move(pending_access_token_callbacks_);
+  pending_access_token_callbacks_.clear();
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(success);
+  }
 }
 
 bool BinanceService::OAuthRequest(const GURL &url,
@@ -279,6 +313,7 @@ bool BinanceService::SetAccessTokens(const std::string& access_token,
 void BinanceService::ResetAccessTokens() {
   access_token_ = "";
   refresh_token_ = "";
+  access_token_obtained_at_ = base::TimeTicks();
 
   PrefService* prefs = user_prefs::UserPrefs::Get(context_);
   prefs->SetString(kBinanceAccessToken, access_token_);
@@ -360,22 +395,42 @@ void BinanceService::OnGetConvertQuote(
 }
 
 bool BinanceService::GetCoinNetworks(GetCoinNetworksCallback callback) {
+  if (coin_networks_loaded_) {
+    std::move(callback).Run(coin_networks_cache_);
+    return true;
+  }
+
+  pending_coin_networks_callbacks_.push_back(std::move(callback));
+  if (pending_coin_networks_callbacks_.size() > 1) {
+    // A fetch is already on its way.
+    return true;
+  }
+
   auto internal_callback = base::BindOnce(&BinanceService::OnGetCoinNetworks,
-      base::Unretained(this), std::move(callback));
+      base::Unretained(this));
   GURL url = GetURLWithPath(gateway_host_, gateway_path_networks);
-  return OAuthRequest(
-      url, "GET", "", std::move(internal_callback), true, false);
+  if (!OAuthRequest(
+          url, "GET", "", std::move(internal_callback), true, false)) {
+    pending_coin_networks_callbacks_.clear();
+    return false;
+  }
+  return true;
 }
 
 void BinanceService::OnGetCoinNetworks(
-  GetCoinNetworksCallback callback,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   BinanceCoinNetworks networks;
   if (status >= 200 && status <= 299) {
     BinanceJSONParser::GetCoinNetworksFromJSON(body, &networks);
+    coin_networks_cache_ = networks;
+    coin_networks_loaded_ = true;
+  }
+  auto callbacks = std::move(pending_coin_networks_callbacks_);
+  pending_coin_networks_callbacks_.clear();
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(networks);
   }
-  std::move(callback).Run(networks);
 }
 
 bool BinanceService::GetDepositInfo(const std::string& symbol,
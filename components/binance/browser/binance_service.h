@@ -18,6 +18,7 @@
 #include "base/macros.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "url/gurl.h"
 
@@ -112,9 +113,8 @@ class BinanceService : public KeyedService {
                               const std::map<std::string, std::string>&)>;
 
   base::SequencedTaskRunner* io_task_runner();
-  void OnGetAccessToken(GetAccessTokenCallback callback,
-                           const int status, const std::string& body,
-                           const std::map<std::string, std::string>& headers);
+  void OnGetAccessToken(const int status, const std::string& body,
+                        const std::map<std::string, std::string>& headers);
   void OnGetConvertQuote(GetConvertQuoteCallback callback,
                            const int status, const std::string& body,
                            const std::map<std::string, std::string>& headers);
@@ -133,7 +133,7 @@ class BinanceService : public KeyedService {
   void OnRevokeToken(RevokeTokenCallback callback,
                      const int status, const std::string& body,
                      const std::map<std::string, std::string>& headers);
-  void OnGetCoinNetworks(GetCoinNetworksCallback callback,
+  void OnGetCoinNetworks(
         const int status, const std::string& body,
         const std::map<std::string, std::string>& headers);
   bool OAuthRequest(const GURL& url, const std::string& method,
@@ -161,6 +161,19 @@ class BinanceService : public KeyedService {
   content::BrowserContext* context_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   SimpleURLLoaderList url_loaders_;
+
+  // The supported-networks catalog is static for a browser session, so the
+  // first successful fetch answers all later calls and concurrent callers
+  // share a single request.
+  bool coin_networks_loaded_ = false;
+  BinanceCoinNetworks coin_networks_cache_;
+  std::vector<GetCoinNetworksCallback> pending_coin_networks_callbacks_;
+
+  // Token requests issued while one is in flight share its result, and a
+  // token obtained recently answers requests directly.
+  std::vector<GetAccessTokenCallback> pending_access_token_callbacks_;
+  base::TimeTicks access_token_obtained_at_;
+
   base::WeakPtrFactory<BinanceService> weak_factory_;
 
   FRIEND_TEST_ALL_PREFIXES(BinanceAPIBrowserTest, GetOAuthClientURL);
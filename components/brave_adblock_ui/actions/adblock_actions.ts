@@ -15,6 +15,8 @@ export const enableFilterList = (uuid: string, enabled: boolean) =>
 
 export const getCustomFilters = () => action(types.ADBLOCK_GET_CUSTOM_FILTERS)
 
+export const getEngineStats = () => action(types.ADBLOCK_GET_ENGINE_STATS)
+
 export const getRegionalLists = () => action(types.ADBLOCK_GET_REGIONAL_LISTS)
 
 export const onGetCustomFilters = (customFilters: string) =>
@@ -22,6 +24,11 @@ export const onGetCustomFilters = (customFilters: string) =>
     customFilters
   })
 
+export const onGetEngineStats = (stats: AdBlock.EngineStats) =>
+  action(types.ADBLOCK_ON_GET_ENGINE_STATS, {
+    stats
+  })
+
 export const onGetRegionalLists = (regionalLists: AdBlock.FilterList[]) =>
   action(types.ADBLOCK_ON_GET_REGIONAL_LISTS, {
     regionalLists
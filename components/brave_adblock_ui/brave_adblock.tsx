@@ -19,6 +19,11 @@ function getCustomFilters () {
   actions.getCustomFilters()
 }
 
+function getEngineStats () {
+  const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
+  actions.getEngineStats()
+}
+
 function getRegionalLists () {
   const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
   actions.getRegionalLists()
@@ -27,6 +32,7 @@ function getRegionalLists () {
 function initialize () {
   getCustomFilters()
   getRegionalLists()
+  getEngineStats()
   render(
     <Provider store={store}>
       <App />
@@ -39,6 +45,11 @@ function onGetCustomFilters (customFilters: string) {
   actions.onGetCustomFilters(customFilters)
 }
 
+function onGetEngineStats (stats: AdBlock.EngineStats) {
+  const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
+  actions.onGetEngineStats(stats)
+}
+
 function onGetRegionalLists (regionalLists: AdBlock.FilterList[]) {
   const actions = bindActionCreators(adblockActions, store.dispatch.bind(store))
   actions.onGetRegionalLists(regionalLists)
@@ -49,6 +60,7 @@ function onGetRegionalLists (regionalLists: AdBlock.FilterList[]) {
 // @ts-ignore
 window.brave_adblock = {
   onGetCustomFilters,
+  onGetEngineStats,
   onGetRegionalLists
 }
 
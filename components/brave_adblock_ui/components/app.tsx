@@ -9,6 +9,7 @@ import { connect } from 'react-redux'
 // Components
 import { AdBlockItemList } from './adBlockItemList'
 import { CustomFilters } from './customFilters'
+import { EngineStats } from './engineStats'
 
 // Utils
 import * as adblockActions from '../actions/adblock_actions'
@@ -39,6 +40,10 @@ export class AdblockPage extends React.Component<Props, {}> {
           actions={actions}
           rules={adblockData.settings.customFilters || ''}
         />
+        <EngineStats
+          actions={actions}
+          stats={adblockData.stats}
+        />
       </div>
     )
   }
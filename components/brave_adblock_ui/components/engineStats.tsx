@@ -0,0 +1,90 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import * as React from 'react'
+
+interface Props {
+  actions: any
+  stats?: AdBlock.EngineStats
+}
+
+export class EngineStats extends React.Component<Props, {}> {
+  constructor (props: Props) {
+    super(props)
+  }
+
+  refresh = () => {
+    this.props.actions.getEngineStats()
+  }
+
+  renderListHitRow = (listHit: AdBlock.ListHitCount) => {
+    return (
+      <tr key={listHit.uuid}>
+        <td>{listHit.title || listHit.uuid}</td>
+        <td>{listHit.hits}</td>
+      </tr>
+    )
+  }
+
+  render () {
+    const { stats } = this.props
+    if (!stats) {
+      return null
+    }
+    const cacheLookups = stats.verdictCacheHits + stats.verdictCacheMisses
+    const hitRatio = cacheLookups
+      ? (100 * stats.verdictCacheHits / cacheLookups).toFixed(1) + '%'
+      : 'n/a'
+    const listHits = stats.listHitReport.list_hits
+      .slice()
+      .sort((a, b) => b.hits - a.hits)
+    return (
+      <div>
+        <div
+          style={{ fontSize: '18px', marginTop: '20px' }}
+        >
+          {'Engine statistics (this session)'}
+        </div>
+        <button onClick={this.refresh}>Refresh</button>
+        <table>
+          <tbody>
+            <tr>
+              <td>Verdict cache hit ratio</td>
+              <td>{hitRatio} ({stats.verdictCacheHits} of {cacheLookups})</td>
+            </tr>
+            <tr>
+              <td>Coalesced duplicate requests</td>
+              <td>{stats.coalescedRequests}</td>
+            </tr>
+            <tr>
+              <td>Engine matches</td>
+              <td>{stats.matchSampleCount}</td>
+            </tr>
+            <tr>
+              <td>Mean match time (ms)</td>
+              <td>{stats.matchMeanTimeMs.toFixed(3)}</td>
+            </tr>
+            <tr>
+              <td>Classified requests (regional lists)</td>
+              <td>{stats.listHitReport.total_queries}</td>
+            </tr>
+          </tbody>
+        </table>
+        <div style={{ marginTop: '10px' }}>
+          <table>
+            <thead>
+              <tr>
+                <th>Regional list</th>
+                <th>Rule matches</th>
+              </tr>
+            </thead>
+            <tbody>
+              {listHits.map(this.renderListHitRow)}
+            </tbody>
+          </table>
+        </div>
+      </div>
+    )
+  }
+}
@@ -37,12 +37,18 @@ const adblockReducer: Reducer<AdBlock.State | undefined> = (state: AdBlock.State
     case types.ADBLOCK_GET_CUSTOM_FILTERS:
       chrome.send('brave_adblock.getCustomFilters')
       break
+    case types.ADBLOCK_GET_ENGINE_STATS:
+      chrome.send('brave_adblock.getEngineStats')
+      break
     case types.ADBLOCK_GET_REGIONAL_LISTS:
       chrome.send('brave_adblock.getRegionalLists')
       break
     case types.ADBLOCK_ON_GET_CUSTOM_FILTERS:
       state = { ...state, settings: { ...state.settings, customFilters: action.payload.customFilters } }
       break
+    case types.ADBLOCK_ON_GET_ENGINE_STATS:
+      state = { ...state, stats: action.payload.stats }
+      break
     case types.ADBLOCK_ON_GET_REGIONAL_LISTS:
       state = { ...state, settings: { ...state.settings, regionalLists: action.payload.regionalLists } }
       break
@@ -95,14 +95,15 @@ void RegisterP2APrefs(PrefRegistrySimple* registry) {
 }
 
 void RecordInWeeklyStorageAndEmitP2AHistogramAnswer(PrefService* prefs,
-                                                    const std::string& name) {
+                                                    const std::string& name,
+                                                    const uint64_t count) {
   std::string pref_path(prefs::kP2AStoragePrefNamePrefix);
   pref_path.append(name);
   if (!prefs->FindPreference(pref_path)) {
     return;
   }
   WeeklyStorage storage(prefs, pref_path.c_str());
-  storage.AddDelta(1);
+  storage.AddDelta(count);
   EmitP2AHistogramAnswer(name, storage.GetWeeklySum());
 }
 
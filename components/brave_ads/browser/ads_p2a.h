@@ -18,8 +18,11 @@ namespace brave_ads {
 
 void RegisterP2APrefs(PrefRegistrySimple* prefs);
 
+// Adds |count| occurrences of |name| to its weekly storage and emits the
+// updated histogram answer
 void RecordInWeeklyStorageAndEmitP2AHistogramAnswer(PrefService* prefs,
-                                                    const std::string& name);
+                                                    const std::string& name,
+                                                    uint64_t count);
 
 void EmitP2AHistogramAnswer(const std::string& name, uint16_t count_value);
 
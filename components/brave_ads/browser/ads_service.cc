@@ -60,6 +60,7 @@ void AdsService::RegisterProfilePrefs(
 
   registry->RegisterStringPref(ads::prefs::kCatalogId, "");
   registry->RegisterIntegerPref(ads::prefs::kCatalogVersion, 0);
+  registry->RegisterStringPref(ads::prefs::kCatalogETag, "");
   registry->RegisterInt64Pref(ads::prefs::kCatalogPing, 0);
   registry->RegisterInt64Pref(ads::prefs::kCatalogLastUpdated, 0);
 
@@ -67,6 +68,8 @@ void AdsService::RegisterProfilePrefs(
   registry->RegisterStringPref(ads::prefs::kEpsilonGreedyBanditEligibleSegments,
                                "");
 
+  registry->RegisterBooleanPref(prefs::kHasMigratedConfirmationState, false);
+
   registry->RegisterBooleanPref(ads::prefs::kHasMigratedConversionState, false);
   registry->RegisterBooleanPref(ads::prefs::kHasMigratedEstimatedPendingRewards,
                                 false);
@@ -111,6 +111,17 @@ namespace {
 
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+// How often the idle state is polled while the user is already idle or the
+// screen is locked. Detecting the return from idle a few seconds late is
+// fine, and the coarse cadence keeps the browser quiet on idle machines.
+const int kIdlePollIntervalWhileIdleSeconds = 5;
+
+// How long P2A ad events are accumulated in memory before being flushed to
+// their weekly storage prefs. Short enough that counts always land in the
+// correct P3A reporting cycle.
+constexpr base::TimeDelta kP2ACountFlushInterval =
+    base::TimeDelta::FromMinutes(1);
+
 }  // namespace
 
 namespace {
@@ -213,6 +224,9 @@ AdsServiceImpl::AdsServiceImpl(Profile* profile,
       file_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
           {base::MayBlock(), base::TaskPriority::BEST_EFFORT,
            base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
+      db_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
       base_path_(profile_->GetPath().AppendASCII("ads_service")),
       last_idle_state_(ui::IdleState::IDLE_STATE_ACTIVE),
       last_idle_time_(0),
@@ -567,12 +581,15 @@ void AdsServiceImpl::Shutdown() {
 
   idle_poll_timer_.Stop();
 
+  p2a_flush_timer_.Stop();
+  FlushP2ACounts();
+
   bat_ads_.reset();
   bat_ads_client_receiver_.reset();
   bat_ads_service_.reset();
 
   const bool success =
-      file_task_runner_->DeleteSoon(FROM_HERE, database_.release());
+      db_task_runner_->DeleteSoon(FROM_HERE, database_.release());
   VLOG_IF(1, !success) << "Failed to release database";
 }
 
@@ -622,6 +639,13 @@ bool MigrateConfirmationsStateOnFileTaskRunner(const base::FilePath& path) {
 }
 
 void AdsServiceImpl::MaybeInitialize() {
+  if (GetBooleanPref(prefs::kHasMigratedConfirmationState)) {
+    // Migration completed in an earlier session, so don't probe the profile
+    // directory for legacy state on this launch
+    Initialize();
+    return;
+  }
+
   const base::FilePath path = profile_->GetPath();
 
   base::PostTaskAndReplyWithResult(
@@ -639,6 +663,8 @@ void AdsServiceImpl::OnMigrateConfirmationsState(const bool success) {
 
   VLOG(1) << "Successfully migrated confirmations state";
 
+  SetBooleanPref(prefs::kHasMigratedConfirmationState, true);
+
   Initialize();
 }
 
@@ -927,8 +953,7 @@ void AdsServiceImpl::StartCheckIdleStateTimer() {
 #if !defined(OS_ANDROID)
   idle_poll_timer_.Stop();
 
-  idle_poll_timer_.Start(FROM_HERE, base::TimeDelta::FromSeconds(1), this,
-                         &AdsServiceImpl::CheckIdleState);
+  CheckIdleState();
 #endif
 }
 
@@ -938,6 +963,31 @@ void AdsServiceImpl::CheckIdleState() {
   ProcessIdleState(idle_state, last_idle_time_);
 
   last_idle_time_ = ui::CalculateIdleTime();
+
+  ScheduleNextIdleStateCheck(idle_state, idle_threshold, last_idle_time_);
+}
+
+void AdsServiceImpl::ScheduleNextIdleStateCheck(const ui::IdleState idle_state,
+                                                const int idle_threshold,
+                                                const int idle_time) {
+  // There is no push API for input idleness at this layer, so the state has
+  // to be polled, but a fixed one second cadence kept this timer hot around
+  // the clock. While the user is active the state cannot become idle before
+  // the remainder of the threshold elapses, so sleep exactly that long; any
+  // input in between only pushes the transition further out. Once idle, poll
+  // coarsely; returning from idle is only acted on in transitions, and a few
+  // seconds of detection latency does not matter there.
+  base::TimeDelta delay;
+  if (idle_state == ui::IdleState::IDLE_STATE_ACTIVE &&
+      idle_time < idle_threshold) {
+    delay = base::TimeDelta::FromSeconds(
+        std::max(1, idle_threshold - idle_time));
+  } else {
+    delay = base::TimeDelta::FromSeconds(kIdlePollIntervalWhileIdleSeconds);
+  }
+
+  idle_poll_timer_.Start(FROM_HERE, delay, this,
+                         &AdsServiceImpl::CheckIdleState);
 }
 
 void AdsServiceImpl::ProcessIdleState(const ui::IdleState idle_state,
@@ -2063,15 +2113,31 @@ void AdsServiceImpl::RecordP2AEvent(const std::string& name,
         break;
       }
 
+      // Accumulate in memory and flush on a timer so browse-heavy sessions
+      // collapse thousands of per-opportunity pref writes into one update
+      // per question per flush
       for (auto& item : list->GetList()) {
-        RecordInWeeklyStorageAndEmitP2AHistogramAnswer(profile_->GetPrefs(),
-                                                       item.GetString());
+        pending_p2a_counts_[item.GetString()]++;
+      }
+
+      if (!p2a_flush_timer_.IsRunning()) {
+        p2a_flush_timer_.Start(FROM_HERE, kP2ACountFlushInterval, this,
+                               &AdsServiceImpl::FlushP2ACounts);
       }
       break;
     }
   }
 }
 
+void AdsServiceImpl::FlushP2ACounts() {
+  for (const auto& count : pending_p2a_counts_) {
+    RecordInWeeklyStorageAndEmitP2AHistogramAnswer(profile_->GetPrefs(),
+                                                   count.first, count.second);
+  }
+
+  pending_p2a_counts_.clear();
+}
+
 void AdsServiceImpl::Load(const std::string& name, ads::LoadCallback callback) {
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(), FROM_HERE,
@@ -2104,7 +2170,7 @@ ads::DBCommandResponsePtr RunDBTransactionOnFileTaskRunner(
 void AdsServiceImpl::RunDBTransaction(ads::DBTransactionPtr transaction,
                                       ads::RunDBTransactionCallback callback) {
   base::PostTaskAndReplyWithResult(
-      file_task_runner_.get(), FROM_HERE,
+      db_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RunDBTransactionOnFileTaskRunner, std::move(transaction),
                      database_.get()),
       base::BindOnce(&AdsServiceImpl::OnRunDBTransaction, AsWeakPtr(),
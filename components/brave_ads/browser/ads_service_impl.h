@@ -230,9 +230,14 @@ class AdsServiceImpl : public AdsService,
 
   void StartCheckIdleStateTimer();
   void CheckIdleState();
+  void ScheduleNextIdleStateCheck(const ui::IdleState idle_state,
+                                  const int idle_threshold,
+                                  const int idle_time);
   void ProcessIdleState(const ui::IdleState idle_state, const int idle_time);
   int GetIdleTimeThreshold();
 
+  void FlushP2ACounts();
+
   void MaybeOpenNewTabWithAd();
   void OpenNewTabWithAd(const std::string& uuid);
   void OnOpenNewTabWithAd(const std::string& json);
@@ -439,6 +444,11 @@ class AdsServiceImpl : public AdsService,
 
   const scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
 
+  // The database gets its own sequence so that ad event recording is not
+  // queued behind unrelated file IO such as resource loads and diagnostic
+  // log writes.
+  const scoped_refptr<base::SequencedTaskRunner> db_task_runner_;
+
   const base::FilePath base_path_;
 
   std::map<std::string, std::unique_ptr<base::OneShotTimer>>
@@ -453,7 +463,12 @@ class AdsServiceImpl : public AdsService,
   ui::IdleState last_idle_state_;
   int last_idle_time_;
 
-  base::RepeatingTimer idle_poll_timer_;
+  base::OneShotTimer idle_poll_timer_;
+
+  // P2A ad events accumulated in memory until the next flush to their
+  // weekly storage prefs
+  std::map<std::string, uint64_t> pending_p2a_counts_;
+  base::OneShotTimer p2a_flush_timer_;
 
   PrefChangeRegistrar profile_pref_change_registrar_;
 
@@ -36,6 +36,12 @@ const char kAdNotificationLastScreenPositionX[] =
 const char kAdNotificationLastScreenPositionY[] =
     "brave.brave_ads.ad_notification.last_screen_position_y";
 
+// Stores whether the legacy confirmations state has been moved to the ads
+// service directory, so that launches after the first do not probe the
+// profile directory for legacy state
+const char kHasMigratedConfirmationState[] =
+    "brave.brave_ads.migrated.confirmation_state";
+
 // Stores the preferences version number
 const char kVersion[] = "brave.brave_ads.prefs.version";
 
@@ -24,6 +24,8 @@ extern const int kSupportedCountryCodesSchemaVersionNumber;
 extern const char kAdNotificationLastScreenPositionX[];
 extern const char kAdNotificationLastScreenPositionY[];
 
+extern const char kHasMigratedConfirmationState[];
+
 extern const char kVersion[];
 extern const int kCurrentVersionNumber;
 
@@ -34,6 +34,36 @@ void GetDATFileData(const base::FilePath& file_path,
   }
 }
 
+base::MappedReadOnlyRegion GetDATFileAsSharedMemory(
+    const base::FilePath& file_path) {
+  int64_t size = 0;
+  if (!base::PathExists(file_path) ||
+      !base::GetFileSize(file_path, &size) ||
+      0 == size) {
+    LOG(ERROR) << "GetDATFileAsSharedMemory: "
+               << "the dat file is not found or corrupted "
+               << file_path;
+    return {};
+  }
+
+  base::MappedReadOnlyRegion mapped_region =
+      base::ReadOnlySharedMemoryRegion::Create(size);
+  if (!mapped_region.IsValid()) {
+    LOG(ERROR) << "GetDATFileAsSharedMemory: cannot "
+               << "allocate a shared region for " << file_path;
+    return {};
+  }
+
+  if (size != base::ReadFile(file_path,
+                             mapped_region.mapping.GetMemoryAs<char>(),
+                             size)) {
+    LOG(ERROR) << "GetDATFileAsSharedMemory: cannot "
+               << "read dat file " << file_path;
+    return {};
+  }
+  return mapped_region;
+}
+
 std::string GetDATFileAsString(const base::FilePath& file_path) {
   std::string contents;
   bool success = base::ReadFileToString(file_path, &contents);
@@ -12,6 +12,11 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/files/memory_mapped_file.h"
+#include "base/hash/hash.h"
+#include "base/logging.h"
+#include "base/memory/read_only_shared_memory_region.h"
+#include "base/strings/string_piece.h"
 
 namespace brave_component_updater {
 
@@ -21,6 +26,13 @@ void GetDATFileData(const base::FilePath& file_path,
                     DATFileDataBuffer* buffer);
 std::string GetDATFileAsString(const base::FilePath& file_path);
 
+// Reads the DAT at |file_path| into a read-only shared memory region so a
+// single physical copy of the compiled data can be mapped by other processes
+// (e.g. the network service) instead of each one reading its own private
+// buffer. Returns an invalid region on failure.
+base::MappedReadOnlyRegion GetDATFileAsSharedMemory(
+    const base::FilePath& file_path);
+
 template<typename T>
 using LoadDATFileDataResult =
     std::pair<std::unique_ptr<T>, brave_component_updater::DATFileDataBuffer>;
@@ -41,6 +53,88 @@ LoadDATFileDataResult<T> LoadDATFileData(
       std::move(client), std::move(buffer));
 }
 
+template <typename T>
+struct LoadMappedDATFileDataResult {
+  std::unique_ptr<T> client;
+  // Keeps the file-backed mapping alive. The pages are clean and shared with
+  // the page cache, so a dozen loaded DATs cost no dirty private memory.
+  std::unique_ptr<base::MemoryMappedFile> mapped_file;
+};
+
+// Same as LoadDATFileData, but memory-maps the DAT instead of copying it onto
+// the heap; the client is deserialized directly from the mapping.
+template <typename T>
+LoadMappedDATFileDataResult<T> LoadMappedDATFileData(
+    const base::FilePath& dat_file_path) {
+  LoadMappedDATFileDataResult<T> result;
+  auto mapped_file = std::make_unique<base::MemoryMappedFile>();
+  if (!mapped_file->Initialize(dat_file_path) || mapped_file->length() == 0) {
+    LOG(ERROR) << "LoadMappedDATFileData: cannot "
+               << "map dat file " << dat_file_path;
+    return result;
+  }
+
+  auto client = std::make_unique<T>();
+  if (!client->deserialize(reinterpret_cast<const char*>(mapped_file->data()),
+                           mapped_file->length()))
+    return result;
+
+  result.client = std::move(client);
+  result.mapped_file = std::move(mapped_file);
+  return result;
+}
+
+template <typename T>
+struct LoadSharedDATFileDataResult {
+  std::unique_ptr<T> client;
+  // Keeps the single physical copy of the DAT alive; handles duplicated from
+  // this region can be mapped read-only by other processes.
+  base::ReadOnlySharedMemoryRegion region;
+  base::WritableSharedMemoryMapping mapping;
+  // Hash of the DAT bytes, for change detection across component updates.
+  // Not a security check; the component updater has already verified the
+  // package signature by the time the DAT is read.
+  uint64_t content_hash = 0;
+  // True when |last_content_hash| matched and deserialization was skipped;
+  // the caller keeps its current client and region.
+  bool unchanged = false;
+};
+
+// Same as LoadDATFileData, but backs the DAT with a shared memory region so
+// the bytes are mapped once per system rather than copied per profile.
+// The client is deserialized directly from the mapping. When
+// |last_content_hash| is non-zero and the DAT hashes to the same value, the
+// expensive deserialization is skipped and |unchanged| is set instead; most
+// component update checks redeliver byte-identical DATs.
+template <typename T>
+LoadSharedDATFileDataResult<T> LoadSharedDATFileData(
+    const base::FilePath& dat_file_path,
+    uint64_t last_content_hash = 0) {
+  LoadSharedDATFileDataResult<T> result;
+  base::MappedReadOnlyRegion mapped_region =
+      GetDATFileAsSharedMemory(dat_file_path);
+  if (!mapped_region.IsValid())
+    return result;
+
+  result.content_hash = base::FastHash(
+      base::StringPiece(mapped_region.mapping.GetMemoryAs<char>(),
+                        mapped_region.mapping.size()));
+  if (last_content_hash != 0 && result.content_hash == last_content_hash) {
+    result.unchanged = true;
+    return result;
+  }
+
+  auto client = std::make_unique<T>();
+  if (!client->deserialize(mapped_region.mapping.GetMemoryAs<char>(),
+                           mapped_region.mapping.size()))
+    return result;
+
+  result.client = std::move(client);
+  result.region = std::move(mapped_region.region);
+  result.mapping = std::move(mapped_region.mapping);
+  return result;
+}
+
 
 }  // namespace brave_component_updater
 
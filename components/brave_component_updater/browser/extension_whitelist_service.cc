@@ -69,7 +69,8 @@ void ExtensionWhitelistService::OnComponentReady(
       local_data_files_service()->GetTaskRunner().get(),
       FROM_HERE,
       base::BindOnce(
-          &brave_component_updater::LoadDATFileData<ExtensionWhitelistParser>,
+          &brave_component_updater::LoadMappedDATFileData<
+              ExtensionWhitelistParser>,
           dat_file_path),
       base::BindOnce(&ExtensionWhitelistService::OnGetDATFileData,
                      weak_factory_.GetWeakPtr()));
@@ -77,17 +78,17 @@ void ExtensionWhitelistService::OnComponentReady(
 
 void ExtensionWhitelistService::OnGetDATFileData(GetDATFileDataResult result) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  if (result.second.empty()) {
+  if (!result.mapped_file) {
     LOG(ERROR) << "Could not obtain extension whitelist data";
     return;
   }
-  if (!result.first.get()) {
+  if (!result.client.get()) {
     LOG(ERROR) << "Failed to deserialize extension whitelist data";
     return;
   }
 
-  extension_whitelist_client_ = std::move(result.first);
-  buffer_ = std::move(result.second);
+  extension_whitelist_client_ = std::move(result.client);
+  mapped_dat_file_ = std::move(result.mapped_file);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
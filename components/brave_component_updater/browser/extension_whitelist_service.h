@@ -12,6 +12,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/files/memory_mapped_file.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
@@ -32,7 +33,8 @@ namespace brave_component_updater {
 class ExtensionWhitelistService : public LocalDataFilesObserver {
  public:
   using GetDATFileDataResult =
-      brave_component_updater::LoadDATFileDataResult<ExtensionWhitelistParser>;
+      brave_component_updater::LoadMappedDATFileDataResult<
+          ExtensionWhitelistParser>;
 
   explicit ExtensionWhitelistService(
       LocalDataFilesService* local_data_files_service,
@@ -57,7 +59,7 @@ class ExtensionWhitelistService : public LocalDataFilesObserver {
 
   SEQUENCE_CHECKER(sequence_checker_);
   std::unique_ptr<ExtensionWhitelistParser> extension_whitelist_client_;
-  brave_component_updater::DATFileDataBuffer buffer_;
+  std::unique_ptr<base::MemoryMappedFile> mapped_dat_file_;
   std::vector<std::string> whitelist_;
   base::WeakPtrFactory<ExtensionWhitelistService> weak_factory_;
 
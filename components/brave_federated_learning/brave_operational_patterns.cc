@@ -9,10 +9,12 @@
 
 #include "brave/components/brave_federated_learning/brave_operational_patterns.h"
 
+#include "base/containers/contains.h"
 #include "base/json/json_writer.h"
 #include "base/strings/string_util.h"
 #include "base/time/time.h"
 #include "base/timer/timer.h"
+#include "base/values.h"
 #include "brave/components/brave_federated_learning/brave_operational_patterns_features.h"
 #include "brave/components/brave_stats/browser/brave_stats_updater_util.h"
 #include "components/prefs/pref_registry_simple.h"
@@ -31,6 +33,12 @@ constexpr char kLastCheckedSlotPrefName[] = "brave.federated.last_checked_slot";
 constexpr char kCollectionIdPrefName[] = "brave.federated.collection_id";
 constexpr char kCollectionIdExpirationPrefName[] =
     "brave.federated.collection_id_expiration";
+constexpr char kPendingSlotsPrefName[] =
+    "brave.federated.pending_collection_slots";
+
+// Bounds the persisted upload backlog if the device stays offline for a long
+// stretch; one day of 30-minute slots.
+constexpr size_t kMaxPendingSlots = 48;
 
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("brave_operational_patterns", R"(
@@ -70,6 +78,7 @@ void BraveOperationalPatterns::RegisterLocalStatePrefs(
   registry->RegisterIntegerPref(kLastCheckedSlotPrefName, -1);
   registry->RegisterStringPref(kCollectionIdPrefName, {});
   registry->RegisterTimePref(kCollectionIdExpirationPrefName, base::Time());
+  registry->RegisterListPref(kPendingSlotsPrefName);
 }
 
 void BraveOperationalPatterns::Start() {
@@ -108,6 +117,14 @@ void BraveOperationalPatterns::LoadPrefs() {
   collection_id_ = local_state_->GetString(kCollectionIdPrefName);
   collection_id_expiration_time_ =
       local_state_->GetTime(kCollectionIdExpirationPrefName);
+
+  pending_slots_.clear();
+  for (const auto& value :
+       local_state_->GetList(kPendingSlotsPrefName)->GetList()) {
+    if (value.is_int()) {
+      pending_slots_.push_back(value.GetInt());
+    }
+  }
 }
 
 void BraveOperationalPatterns::SavePrefs() {
@@ -115,9 +132,22 @@ void BraveOperationalPatterns::SavePrefs() {
   local_state_->SetString(kCollectionIdPrefName, collection_id_);
   local_state_->SetTime(kCollectionIdExpirationPrefName,
                         collection_id_expiration_time_);
+
+  base::ListValue pending_slots;
+  for (int slot : pending_slots_) {
+    pending_slots.Append(slot);
+  }
+  local_state_->Set(kPendingSlotsPrefName, pending_slots);
 }
 
 void BraveOperationalPatterns::OnCollectionSlotStartTimerFired() {
+  // Don't schedule the training step wakeup at all when the current slot is
+  // already reported and no backlog is waiting.
+  if (GetCurrentCollectionSlot() == last_checked_slot_ &&
+      pending_slots_.empty()) {
+    return;
+  }
+
   simulate_local_training_step_timer_->Reset();
 }
 
@@ -126,12 +156,26 @@ void BraveOperationalPatterns::OnSimulateLocalTrainingStepTimerFired() {
 }
 
 void BraveOperationalPatterns::SendCollectionSlot() {
-  current_collected_slot_ = GetCurrentCollectionSlot();
-  if (current_collected_slot_ == last_checked_slot_) {
+  const int current_slot = GetCurrentCollectionSlot();
+  if (current_slot != last_checked_slot_ &&
+      !base::Contains(pending_slots_, current_slot)) {
+    pending_slots_.push_back(current_slot);
+    if (pending_slots_.size() > kMaxPendingSlots) {
+      pending_slots_.erase(pending_slots_.begin());
+    }
+    SavePrefs();
+  }
+
+  if (pending_slots_.empty() || url_loader_) {
     return;
   }
 
   MaybeResetCollectionId();
+  UploadNextPendingSlot();
+}
+
+void BraveOperationalPatterns::UploadNextPendingSlot() {
+  DCHECK(!pending_slots_.empty());
 
   auto resource_request = std::make_unique<network::ResourceRequest>();
   resource_request->url = GURL(federatedLearningUrl);
@@ -142,7 +186,8 @@ void BraveOperationalPatterns::SendCollectionSlot() {
 
   url_loader_ = network::SimpleURLLoader::Create(
       std::move(resource_request), GetNetworkTrafficAnnotationTag());
-  url_loader_->AttachStringForUpload(BuildPayload(), "application/json");
+  url_loader_->AttachStringForUpload(BuildPayload(pending_slots_.front()),
+                                     "application/json");
 
   url_loader_->DownloadHeadersOnly(
       url_loader_factory_.get(),
@@ -152,21 +197,34 @@ void BraveOperationalPatterns::SendCollectionSlot() {
 
 void BraveOperationalPatterns::OnUploadComplete(
     scoped_refptr<net::HttpResponseHeaders> headers) {
+  url_loader_.reset();
+
   int response_code = -1;
   if (headers)
     response_code = headers->response_code();
-  if (response_code == 200) {
-    last_checked_slot_ = current_collected_slot_;
-    SavePrefs();
+  if (response_code != 200) {
+    // Keep the slot queued; it is retried on the next wakeup.
+    return;
+  }
+
+  last_checked_slot_ = pending_slots_.front();
+  pending_slots_.erase(pending_slots_.begin());
+  SavePrefs();
+
+  if (!pending_slots_.empty()) {
+    // The connection is already warm, so drain the backlog now instead of
+    // waking the radio once per queued slot.
+    UploadNextPendingSlot();
   }
 }
 
-std::string BraveOperationalPatterns::BuildPayload() const {
+std::string BraveOperationalPatterns::BuildPayload(
+    const int collection_slot) const {
   base::Value root(base::Value::Type::DICTIONARY);
 
   root.SetKey("collection_id", base::Value(collection_id_));
   root.SetKey("platform", base::Value(brave_stats::GetPlatformIdentifier()));
-  root.SetKey("collection_slot", base::Value(current_collected_slot_));
+  root.SetKey("collection_slot", base::Value(collection_slot));
   root.SetKey("wiki-link", base::Value("https://github.com/brave/brave-browser/"
                                        "wiki/Operational-Patterns"));
 
@@ -190,6 +248,9 @@ void BraveOperationalPatterns::MaybeResetCollectionId() {
                                  now > collection_id_expiration_time_)) {
     collection_id_ =
         base::ToUpperASCII(base::UnguessableToken::Create().ToString());
+    // Queued slots were recorded under the retired collection id; reporting
+    // them under the fresh one would link the two, so drop them.
+    pending_slots_.clear();
     collection_id_expiration_time_ =
         now + base::TimeDelta::FromSeconds(
                   operational_patterns::features::GetCollectionIdLifetime() *
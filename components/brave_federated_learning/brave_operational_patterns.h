@@ -15,6 +15,11 @@
 // the |collection_slot_periodic_timer_|. When this timer fires, a ping is sent
 // to the server.
 //
+// Slots that could not be uploaded (e.g. the device was offline) are queued in
+// local state and drained back to back over the same connection the next time
+// a ping goes out, so a backlog costs one radio wakeup instead of one per
+// slot.
+//
 // For more information see
 // https://github.com/brave/brave-browser/wiki/Operational-Patterns
 //
@@ -25,6 +30,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/time/time.h"
 #include "base/timer/timer.h"
@@ -65,11 +71,12 @@ class BraveOperationalPatterns final {
   void OnUploadComplete(scoped_refptr<net::HttpResponseHeaders> headers);
 
   void SendCollectionSlot();
+  void UploadNextPendingSlot();
 
   void SavePrefs();
   void LoadPrefs();
 
-  std::string BuildPayload() const;
+  std::string BuildPayload(int collection_slot) const;
   int GetCurrentCollectionSlot() const;
 
   void MaybeResetCollectionId();
@@ -82,9 +89,9 @@ class BraveOperationalPatterns final {
   std::unique_ptr<network::SimpleURLLoader> url_loader_;
 
   base::Time collection_id_expiration_time_;
-  int current_collected_slot_ = 0;
   int last_checked_slot_ = 0;
   std::string collection_id_;
+  std::vector<int> pending_slots_;
 };
 
 }  // namespace brave
@@ -9,14 +9,33 @@
 #include <cmath>
 #include <numeric>
 #include <utility>
+#include <vector>
 
 #include "base/logging.h"
+#include "base/no_destructor.h"
+#include "base/strings/string_piece.h"
 #include "brave/components/brave_perf_predictor/browser/bandwidth_linreg_parameters.h"
 
 namespace brave_perf_predictor {
 
 namespace {
 
+// Maps feature names to their position in |feature_sequence|, so that
+// predictions iterate over the handful of features a page actually produced
+// instead of probing the feature map once per model coefficient. Built once
+// and reused for every prediction.
+const base::flat_map<base::StringPiece, size_t>& GetFeatureIndex() {
+  static const base::NoDestructor<base::flat_map<base::StringPiece, size_t>>
+      feature_index([] {
+        std::vector<std::pair<base::StringPiece, size_t>> pairs;
+        pairs.reserve(feature_count);
+        for (size_t i = 0; i < feature_count; i++)
+          pairs.emplace_back(feature_sequence[i], i);
+        return base::flat_map<base::StringPiece, size_t>(std::move(pairs));
+      }());
+  return *feature_index;
+}
+
 bool StandardiseFeatsNoOutliers(
     std::array<double, standardise_feat_count>* features,
     const std::array<double, standardise_feat_count>& means,
@@ -66,11 +85,12 @@ double LinregPredictVector(const std::array<double, feature_count>& features) {
 }
 
 double LinregPredictNamed(const base::flat_map<std::string, double>& features) {
+  const auto& feature_index = GetFeatureIndex();
   std::array<double, feature_count> feature_vector{};
-  for (unsigned int i = 0; i < feature_count; i++) {
-    auto it = features.find(feature_sequence.at(i));
-    if (it != features.end())
-      feature_vector[i] = it->second;
+  for (const auto& feature : features) {
+    auto it = feature_index.find(feature.first);
+    if (it != feature_index.end())
+      feature_vector[it->second] = feature.second;
   }
   return LinregPredictVector(feature_vector);
 }
@@ -5,13 +5,14 @@
 
 #include "brave/components/brave_perf_predictor/browser/named_third_party_registry.h"
 
-#include <tuple>
+#include <utility>
 
 #include "base/bind.h"
 #include "base/containers/flat_set.h"
 #include "base/json/json_reader.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/no_destructor.h"
 #include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "base/task/post_task.h"
@@ -28,11 +29,13 @@ namespace brave_perf_predictor {
 
 namespace {
 
-std::tuple<base::flat_map<std::string, std::string>,
-           base::flat_map<std::string, std::string>>
-ParseMappings(const base::StringPiece entities, bool discard_irrelevant) {
-  base::flat_map<std::string, std::string> entity_by_domain;
-  base::flat_map<std::string, std::string> entity_by_root_domain;
+EntityMappings ParseMappings(const base::StringPiece entities,
+                             bool discard_irrelevant) {
+  EntityMappings mappings;
+  base::flat_map<std::string, std::string>& entity_by_domain =
+      mappings.by_domain;
+  base::flat_map<std::string, std::string>& entity_by_root_domain =
+      mappings.by_root_domain;
 
   // Parse the JSON
   absl::optional<base::Value> document = base::JSONReader::Read(entities);
@@ -82,12 +85,10 @@ ParseMappings(const base::StringPiece entities, bool discard_irrelevant) {
 
   entity_by_domain.shrink_to_fit();
   entity_by_root_domain.shrink_to_fit();
-  return std::make_tuple(entity_by_domain, entity_by_root_domain);
+  return mappings;
 }
 
-std::tuple<base::flat_map<std::string, std::string>,
-           base::flat_map<std::string, std::string>>
-ParseFromResource(int resource_id) {
+EntityMappings ParseFromResource(int resource_id) {
   // TODO(AndriusA): insert trace event here
   SCOPED_UMA_HISTOGRAM_TIMER(
       "Brave.Savings.NamedThirdPartyRegistry.LoadTimeMS");
@@ -98,30 +99,44 @@ ParseFromResource(int resource_id) {
   return ParseMappings(data_resource, true);
 }
 
+// The bundled dataset is identical for every profile, so it is parsed once
+// per process and the resulting tables are shared between registries. Must
+// be called on the thread pool: the first call does the blocking parse,
+// concurrent callers wait on the static initialization.
+const EntityMappings* GetDefaultMappings() {
+  static const base::NoDestructor<EntityMappings> mappings(
+      ParseFromResource(IDR_THIRD_PARTY_ENTITIES));
+  return mappings.get();
+}
+
 }  // namespace
 
+EntityMappings::EntityMappings() = default;
+EntityMappings::EntityMappings(EntityMappings&& other) = default;
+EntityMappings& EntityMappings::operator=(EntityMappings&& other) = default;
+EntityMappings::~EntityMappings() = default;
+
 bool NamedThirdPartyRegistry::LoadMappings(const base::StringPiece entities,
                                            bool discard_irrelevant) {
   // Reset previous mappings
-  entity_by_domain_.clear();
-  entity_by_root_domain_.clear();
+  mappings_ = nullptr;
   initialized_ = false;
 
-  tie(entity_by_domain_, entity_by_root_domain_) =
-      ParseMappings(entities, discard_irrelevant);
-  if (entity_by_domain_.size() == 0 || entity_by_root_domain_.size() == 0)
+  owned_mappings_ = ParseMappings(entities, discard_irrelevant);
+  if (owned_mappings_.by_domain.empty() ||
+      owned_mappings_.by_root_domain.empty())
     return false;
 
+  mappings_ = &owned_mappings_;
   initialized_ = true;
   return true;
 }
 
-void NamedThirdPartyRegistry::UpdateMappings(
-    std::tuple<base::flat_map<std::string, std::string>,
-               base::flat_map<std::string, std::string>> entity_mappings) {
-  tie(entity_by_domain_, entity_by_root_domain_) = entity_mappings;
-  VLOG(2) << "Loaded " << entity_by_domain_.size() << " mappings by domain and "
-          << entity_by_root_domain_.size() << " by root domain; size";
+void NamedThirdPartyRegistry::UseMappings(const EntityMappings* mappings) {
+  mappings_ = mappings;
+  VLOG(2) << "Loaded " << mappings_->by_domain.size()
+          << " mappings by domain and " << mappings_->by_root_domain.size()
+          << " by root domain; size";
   initialized_ = true;
 }
 
@@ -137,15 +152,15 @@ absl::optional<std::string> NamedThirdPartyRegistry::GetThirdParty(
     return absl::nullopt;
 
   if (url.has_host()) {
-    auto domain_entry = entity_by_domain_.find(url.host());
-    if (domain_entry != entity_by_domain_.end())
+    auto domain_entry = mappings_->by_domain.find(url.host());
+    if (domain_entry != mappings_->by_domain.end())
       return domain_entry->second;
 
     auto root_domain = net::registry_controlled_domains::GetDomainAndRegistry(
         url, net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
 
-    auto root_domain_entry = entity_by_root_domain_.find(root_domain);
-    if (root_domain_entry != entity_by_root_domain_.end())
+    auto root_domain_entry = mappings_->by_root_domain.find(root_domain);
+    if (root_domain_entry != mappings_->by_root_domain.end())
       return root_domain_entry->second;
   }
 
@@ -158,9 +173,8 @@ NamedThirdPartyRegistry::~NamedThirdPartyRegistry() = default;
 
 void NamedThirdPartyRegistry::InitializeDefault() {
   base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&ParseFromResource, IDR_THIRD_PARTY_ENTITIES),
-      base::BindOnce(&NamedThirdPartyRegistry::UpdateMappings,
+      FROM_HERE, {base::MayBlock()}, base::BindOnce(&GetDefaultMappings),
+      base::BindOnce(&NamedThirdPartyRegistry::UseMappings,
                      weak_factory_.GetWeakPtr()));
 }
 
@@ -7,7 +7,6 @@
 #define BRAVE_COMPONENTS_BRAVE_PERF_PREDICTOR_BROWSER_NAMED_THIRD_PARTY_REGISTRY_H_
 
 #include <string>
-#include <tuple>
 
 #include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
@@ -16,6 +15,18 @@
 
 namespace brave_perf_predictor {
 
+// Parsed (domain, entity) lookup tables. The tables parsed from the bundled
+// resource are immutable once built and shared by every profile's registry.
+struct EntityMappings {
+  EntityMappings();
+  EntityMappings(EntityMappings&& other);
+  EntityMappings& operator=(EntityMappings&& other);
+  ~EntityMappings();
+
+  base::flat_map<std::string, std::string> by_domain;
+  base::flat_map<std::string, std::string> by_root_domain;
+};
+
 // Retrieves publicly known Third Party (organisation) for a given URL, using
 // data from the Third Party Web repository
 // (https://github.com/patrickhulce/third-party-web).
@@ -39,13 +50,13 @@ class NamedThirdPartyRegistry : public KeyedService {
  private:
   bool IsInitialized() const { return initialized_; }
   void MarkInitialized(bool initialized) { initialized_ = initialized; }
-  void UpdateMappings(
-      std::tuple<base::flat_map<std::string, std::string>,
-                 base::flat_map<std::string, std::string>> entity_mappings);
+  void UseMappings(const EntityMappings* mappings);
 
   bool initialized_ = false;
-  base::flat_map<std::string, std::string> entity_by_domain_;
-  base::flat_map<std::string, std::string> entity_by_root_domain_;
+  // Points either at the process-wide default mappings or at
+  // |owned_mappings_| when custom data was loaded via |LoadMappings|.
+  const EntityMappings* mappings_ = nullptr;
+  EntityMappings owned_mappings_;
 
   base::WeakPtrFactory<NamedThirdPartyRegistry> weak_factory_{this};
 };
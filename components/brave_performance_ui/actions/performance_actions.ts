@@ -0,0 +1,16 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import { action } from 'typesafe-actions'
+
+// Constants
+import { types } from '../constants/performance_types'
+
+export const getTimingStats = () => action(types.GET_TIMING_STATS)
+
+export const onGetTimingStats = (stats: BravePerformance.TimingStat[]) =>
+  action(types.ON_GET_TIMING_STATS, {
+    stats
+  })
@@ -0,0 +1,43 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import * as React from 'react'
+import { render } from 'react-dom'
+import { Provider } from 'react-redux'
+import { bindActionCreators } from 'redux'
+
+// Components
+import App from './components/app'
+
+// Utils
+import store from './store'
+import * as performanceActions from './actions/performance_actions'
+
+function getTimingStats () {
+  const actions = bindActionCreators(performanceActions, store.dispatch.bind(store))
+  actions.getTimingStats()
+}
+
+function onGetTimingStats (stats: BravePerformance.TimingStat[]) {
+  const actions = bindActionCreators(performanceActions, store.dispatch.bind(store))
+  actions.onGetTimingStats(stats)
+}
+
+function initialize () {
+  getTimingStats()
+  render(
+    <Provider store={store}>
+      <App />
+    </Provider>,
+    document.getElementById('root'))
+}
+
+// Expose functions to Page Handlers.
+// @ts-ignore
+window.brave_performance = {
+  onGetTimingStats
+}
+
+document.addEventListener('DOMContentLoaded', initialize)
@@ -0,0 +1,81 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import * as React from 'react'
+import { bindActionCreators, Dispatch } from 'redux'
+import { connect } from 'react-redux'
+
+// Utils
+import * as performanceActions from '../actions/performance_actions'
+
+interface Props {
+  actions: any
+  performanceData: BravePerformance.State
+}
+
+export class PerformancePage extends React.Component<Props, {}> {
+  componentDidMount () {
+    this.props.actions.getTimingStats()
+  }
+
+  refresh = () => {
+    this.props.actions.getTimingStats()
+  }
+
+  renderRow = (stat: BravePerformance.TimingStat) => {
+    return (
+      <tr key={stat.histogram}>
+        <td>{stat.subsystem}</td>
+        <td>{stat.description}</td>
+        <td>{stat.sampleCount}</td>
+        <td>{stat.meanTimeMs.toFixed(3)}</td>
+        <td>{stat.totalTimeMs.toFixed(0)}</td>
+        <td>{stat.histogram}</td>
+      </tr>
+    )
+  }
+
+  render () {
+    return (
+      <div id='performancePage'>
+        <h1>Brave-added work in this browser session</h1>
+        <p>
+          Timings are collected since browser startup from the
+          instrumentation each subsystem already records. Per-site numbers
+          are available through tracing (category brave.shields).
+        </p>
+        <button onClick={this.refresh}>Refresh</button>
+        <table>
+          <thead>
+            <tr>
+              <th>Subsystem</th>
+              <th>What is measured</th>
+              <th>Samples</th>
+              <th>Mean (ms)</th>
+              <th>Total (ms)</th>
+              <th>Histogram</th>
+            </tr>
+          </thead>
+          <tbody>
+            {this.props.performanceData.timingStats.map(this.renderRow)}
+          </tbody>
+        </table>
+      </div>
+    )
+  }
+}
+
+export const mapStateToProps = (state: BravePerformance.ApplicationState) => ({
+  performanceData: state.performanceData
+})
+
+export const mapDispatchToProps = (dispatch: Dispatch) => ({
+  actions: bindActionCreators(performanceActions, dispatch)
+})
+
+export default connect(
+  mapStateToProps,
+  mapDispatchToProps
+)(PerformancePage)
@@ -0,0 +1,9 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+export const enum types {
+  GET_TIMING_STATS = '@@brave_performance/GET_TIMING_STATS',
+  ON_GET_TIMING_STATS = '@@brave_performance/ON_GET_TIMING_STATS'
+}
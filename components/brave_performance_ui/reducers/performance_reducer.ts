@@ -0,0 +1,36 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import { Reducer } from 'redux'
+
+// Constants
+import { types } from '../constants/performance_types'
+
+// Utils
+import * as storage from '../storage'
+
+const performanceReducer: Reducer<BravePerformance.State | undefined> = (state: BravePerformance.State | undefined, action) => {
+  if (state === undefined) {
+    state = storage.load()
+  }
+
+  switch (action.type) {
+    case types.GET_TIMING_STATS:
+      chrome.send('brave_performance.getTimingStats')
+      break
+    case types.ON_GET_TIMING_STATS:
+      state = {
+        ...state,
+        timingStats: action.payload.stats
+      }
+      break
+    default:
+      break
+  }
+
+  return state
+}
+
+export default performanceReducer
@@ -9,6 +9,7 @@
 
 #include "base/containers/flat_set.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/stl_util.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/trace_event/trace_event.h"
@@ -35,6 +36,23 @@ MFkwEwYHKoZIzj0CAQYIKoZIzj0DAQcDQgAEQCeVJbcADloHb8bwftIi1UO0smiz
 8ObdAFQ8j3U9cMehGqI3zXgS8APvBW/9XxMkb4XWQe+t9h6qHq82P6zcBg==
 -----END PUBLIC KEY-----)";
 
+// The shuffler and analyzer keys are compile-time constants, so parse the
+// PEM blocks once and share the loaded keys between messages. Reloading them
+// per prochlomation made every upload cycle re-run two PEM decodes and the
+// matching EVP_PKEY allocations for each reported metric.
+BraveProchloCrypto* GetPreparedCrypto() {
+  static base::NoDestructor<BraveProchloCrypto> crypto;
+  static const bool keys_loaded = [] {
+    const std::vector<char> shuffler_key(
+        &kShufflerKey[0], &kShufflerKey[0] + base::size(kShufflerKey));
+    const std::vector<char> analyzer_key(
+        &kAnalyzerKey[0], &kAnalyzerKey[0] + base::size(kAnalyzerKey));
+    return crypto->load_shuffler_key_from_bytes(shuffler_key) &&
+           crypto->load_analyzer_key_from_bytes(analyzer_key);
+  }();
+  return keys_loaded ? crypto.get() : nullptr;
+}
+
 bool MakeProchlomation(uint64_t metric,
                        const uint8_t* data,
                        const uint8_t* crowd_id,
@@ -46,17 +64,8 @@ bool MakeProchlomation(uint64_t metric,
   // to src/base/trace_event/builtin_categories.h
   // TRACE_EVENT0("brave_p3a", "MakeProchlomation");
 
-  BraveProchloCrypto crypto;
-
-  const std::vector<char> shuffler_key(
-      &kShufflerKey[0], &kShufflerKey[0] + base::size(kShufflerKey));
-  if (!crypto.load_shuffler_key_from_bytes(shuffler_key)) {
-    return false;
-  }
-
-  const std::vector<char> analyzer_key(
-      &kAnalyzerKey[0], &kAnalyzerKey[0] + base::size(kAnalyzerKey));
-  if (!crypto.load_analyzer_key_from_bytes(analyzer_key)) {
+  BraveProchloCrypto* crypto = GetPreparedCrypto();
+  if (!crypto) {
     return false;
   }
 
@@ -71,8 +80,8 @@ bool MakeProchlomation(uint64_t metric,
   memcpy(prochlomation.data, data, kProchlomationDataLength);
 
   // Then the AnalyzerItem of the PlainShufflerItem
-  if (!crypto.EncryptForAnalyzer(prochlomation,
-                                 &plain_shuffler_item.analyzer_item)) {
+  if (!crypto->EncryptForAnalyzer(prochlomation,
+                                  &plain_shuffler_item.analyzer_item)) {
     NOTREACHED();
     return false;
   }
@@ -81,7 +90,7 @@ bool MakeProchlomation(uint64_t metric,
   memcpy(plain_shuffler_item.crowd_id, crowd_id, kCrowdIdLength);
 
   // And create the ShufflerItem
-  if (!crypto.EncryptForShuffler(plain_shuffler_item, shuffler_item)) {
+  if (!crypto->EncryptForShuffler(plain_shuffler_item, shuffler_item)) {
     NOTREACHED();
     return false;
   }
@@ -17,6 +17,7 @@
 #include "base/json/json_writer.h"
 #include "base/path_service.h"
 #include "base/strings/string_number_conversions.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
 #include "base/system/sys_info.h"
@@ -156,13 +157,42 @@ BraveReferralsHeaders::BraveReferralsHeaders() {
   referral_headers_.push_back(CreateReferralHeader(
       kPartnerGrammarlyName, {"www.grammarly.com", "grammarly.com",
                               "static.grammarly.com", "gnar.grammarly.com"}));
+
+  // Freeze the host lookup once; the common path consults it for every
+  // network request.
+  std::vector<std::pair<std::string, const base::Value*>> hosts;
+  for (const base::Value& headers_value : referral_headers_) {
+    const base::Value* domains_list =
+        headers_value.FindKeyOfType("domains", base::Value::Type::LIST);
+    const base::Value* headers_dict =
+        headers_value.FindKeyOfType("headers", base::Value::Type::DICTIONARY);
+    if (!domains_list || !headers_dict)
+      continue;
+    for (const auto& domain_value : domains_list->GetList())
+      hosts.emplace_back(domain_value.GetString(), headers_dict);
+  }
+  referral_hosts_ =
+      base::flat_map<std::string, const base::Value*>(std::move(hosts));
 }
 
 bool BraveReferralsHeaders::GetMatchingReferralHeaders(
     const base::DictionaryValue** request_headers_dict,
     const GURL& url) {
-  return GetMatchingReferralHeaders(referral_headers_, request_headers_dict,
-                                    url);
+  if (!url.SchemeIsHTTPOrHTTPS())
+    return false;
+
+  // Walk the host's label suffixes ("a.b.com", "b.com", "com") so a listed
+  // domain matches itself and any of its subdomains.
+  const base::StringPiece host = url.host_piece();
+  for (size_t pos = 0; pos != base::StringPiece::npos;) {
+    const auto it = referral_hosts_.find(host.substr(pos));
+    if (it != referral_hosts_.end())
+      return it->second->GetAsDictionary(request_headers_dict);
+    pos = host.find('.', pos);
+    if (pos != base::StringPiece::npos)
+      pos++;
+  }
+  return false;
 }
 
 template <typename Iter>
@@ -8,8 +8,10 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/files/file_path.h"
 #include "base/macros.h"
 #include "base/memory/weak_ptr.h"
@@ -61,6 +63,11 @@ class BraveReferralsHeaders {
   BraveReferralsHeaders();
 
   std::vector<base::Value> referral_headers_;
+  // Frozen host -> headers lookup derived from |referral_headers_|. All
+  // partner entries are plain host suffixes over http(s), so the common
+  // path matches a request by walking its host's label suffixes instead of
+  // testing URL patterns one by one.
+  base::flat_map<std::string, const base::Value*> referral_hosts_;
 };
 
 class BraveReferralsService : public ProfileManagerObserver {
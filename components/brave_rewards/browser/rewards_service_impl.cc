@@ -74,11 +74,14 @@
 #include "content/public/browser/storage_partition.h"
 #include "content/public/browser/url_data_source.h"
 #include "net/base/escape.h"
+#include "net/base/network_isolation_key.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
+#include "net/base/request_priority.h"
 #include "net/base/url_util.h"
 #include "net/http/http_status_code.h"
 #include "services/network/public/cpp/shared_url_loader_factory.h"
 #include "services/network/public/cpp/simple_url_loader.h"
+#include "services/network/public/mojom/network_context.mojom.h"
 #include "ui/base/resource/resource_bundle.h"
 #include "ui/gfx/image/image.h"
 #include "url/gurl.h"
@@ -105,6 +108,12 @@ const int kDiagnosticLogKeepNumLines = 20000;
 const int kDiagnosticLogMaxFileSize = 10 * (1024 * 1024);
 const char pref_prefix[] = "brave.rewards";
 
+// How long a panel publisher index entry may answer navigations before the
+// ledger database is consulted again; bounds how stale a verified status
+// shown in the panel can get.
+constexpr base::TimeDelta kPanelPublisherIndexTtl =
+    base::TimeDelta::FromHours(1);
+
 std::string URLMethodToRequestType(ledger::type::UrlMethod method) {
   switch (method) {
     case ledger::type::UrlMethod::GET:
@@ -321,6 +330,9 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
       file_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
           {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
            base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
+      db_reader_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_VISIBLE,
+           base::TaskShutdownBehavior::BLOCK_SHUTDOWN})),
       ledger_state_path_(profile_->GetPath().Append(kLedger_state)),
       publisher_state_path_(profile_->GetPath().Append(kPublisher_state)),
       publisher_info_db_path_(profile->GetPath().Append(kPublisher_info_db)),
@@ -342,12 +354,27 @@ RewardsServiceImpl::RewardsServiceImpl(Profile* profile)
 
 RewardsServiceImpl::~RewardsServiceImpl() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  if (ledger_database_) {
-    file_task_runner_->DeleteSoon(FROM_HERE, ledger_database_.release());
-  }
+  ReleaseLedgerDatabase();
   StopNotificationTimers();
 }
 
+void RewardsServiceImpl::ReleaseLedgerDatabase() {
+  if (!ledger_database_) {
+    return;
+  }
+
+  // Queued read tasks still hold a raw pointer to the database, so drain the
+  // reader sequence before scheduling deletion behind any queued writes.
+  db_reader_task_runner_->PostTask(
+      FROM_HERE,
+      base::BindOnce(
+          [](scoped_refptr<base::SequencedTaskRunner> writer_task_runner,
+             ledger::LedgerDatabase* database) {
+            writer_task_runner->DeleteSoon(FROM_HERE, database);
+          },
+          file_task_runner_, ledger_database_.release()));
+}
+
 void RewardsServiceImpl::ConnectionClosed() {
   base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(
       FROM_HERE,
@@ -780,6 +807,8 @@ void RewardsServiceImpl::OnRestorePublishers(
     return;
   }
 
+  panel_publisher_index_.clear();
+
   for (auto& observer : observers_) {
     observer.OnExcludedSitesChanged(
       this, "-1", static_cast<int>(ledger::type::PublisherExclude::ALL));
@@ -1005,6 +1034,12 @@ void RewardsServiceImpl::LoadURL(
   net_request->method = URLMethodToRequestType(request->method);
   net_request->load_flags = request->load_flags;
 
+  // Bulk refreshes such as the publisher prefix list are marked background
+  // by the ledger; schedule them behind user-visible traffic
+  if (request->is_background) {
+    net_request->priority = net::IDLE;
+  }
+
   // Loading Twitter requires credentials
   if (net_request->url.DomainIs("twitter.com")) {
     net_request->credentials_mode = network::mojom::CredentialsMode::kInclude;
@@ -1043,6 +1078,22 @@ void RewardsServiceImpl::LoadURL(
                      base::Unretained(this), loader_it, callback));
 }
 
+void RewardsServiceImpl::PreconnectURL(const std::string& url) {
+  GURL parsed_url(url);
+  if (!parsed_url.is_valid()) {
+    return;
+  }
+
+  // Warming up the connection ahead of a burst of ledger requests means the
+  // first request of the burst does not pay for the TLS handshake. Ledger
+  // requests are loaded without credentials, so preconnect the same way
+  profile_->GetDefaultStoragePartition()
+      ->GetNetworkContext()
+      ->PreconnectSockets(1, parsed_url.GetOrigin(),
+                          false /* allow_credentials */,
+                          net::NetworkIsolationKey());
+}
+
 void RewardsServiceImpl::OnURLLoaderComplete(
     SimpleURLLoaderList::iterator loader_it,
     ledger::client::LoadURLCallback callback,
@@ -1089,9 +1140,12 @@ void RewardsServiceImpl::OnURLLoaderComplete(
 }
 
 void RewardsServiceImpl::OnGetRewardsParameters(
-    GetRewardsParametersCallback callback,
     ledger::type::RewardsParametersPtr parameters) {
-  std::move(callback).Run(std::move(parameters));
+  auto callbacks = std::move(pending_parameters_callbacks_);
+  pending_parameters_callbacks_.clear();
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(parameters ? parameters->Clone() : nullptr);
+  }
 }
 
 void RewardsServiceImpl::GetRewardsParameters(
@@ -1100,10 +1154,15 @@ void RewardsServiceImpl::GetRewardsParameters(
     return;
   }
 
+  pending_parameters_callbacks_.push_back(std::move(callback));
+  if (pending_parameters_callbacks_.size() > 1) {
+    // A fetch is already in flight and will resolve this callback too.
+    return;
+  }
+
   bat_ledger_->GetRewardsParameters(
       base::BindOnce(&RewardsServiceImpl::OnGetRewardsParameters,
-                     AsWeakPtr(),
-                     std::move(callback)));
+                     AsWeakPtr()));
 }
 
 void RewardsServiceImpl::OnFetchPromotions(
@@ -1429,6 +1488,8 @@ void RewardsServiceImpl::OnDiagnosticLogDeletedForCompleteReset(
 
 void RewardsServiceImpl::Reset() {
   url_loaders_.clear();
+  panel_publisher_index_.clear();
+  pending_panel_lookups_.clear();
 
   BitmapFetcherService* image_service =
       BitmapFetcherServiceFactory::GetForBrowserContext(profile_);
@@ -1443,9 +1504,7 @@ void RewardsServiceImpl::Reset() {
   bat_ledger_client_receiver_.reset();
   bat_ledger_service_.reset();
   ready_ = std::make_unique<base::OneShotEvent>();
-  bool success =
-      file_task_runner_->DeleteSoon(FROM_HERE, ledger_database_.release());
-  BLOG_IF(1, !success, "Database was not released");
+  ReleaseLedgerDatabase();
   BLOG(1, "Successfully reset rewards service");
 }
 
@@ -1773,10 +1832,27 @@ void RewardsServiceImpl::GetPublisherActivityFromUrl(
     return;
   }
 
+  // Repeat navigations to a known domain are answered from the in-memory
+  // index instead of round-tripping to the ledger database.
+  auto indexed = panel_publisher_index_.find(baseDomain);
+  if (indexed != panel_publisher_index_.end()) {
+    if (base::TimeTicks::Now() - indexed->second.created_at <
+        kPanelPublisherIndexTtl) {
+      OnPanelPublisherInfo(
+          indexed->second.result,
+          indexed->second.info ? indexed->second.info->Clone() : nullptr,
+          windowId);
+      return;
+    }
+    panel_publisher_index_.erase(indexed);
+  }
+
   if (!Connected()) {
     return;
   }
 
+  pending_panel_lookups_[windowId] = baseDomain;
+
   ledger::type::VisitDataPtr visit_data = ledger::type::VisitData::New();
   visit_data->domain = visit_data->name = baseDomain;
   visit_data->path = path;
@@ -1793,6 +1869,19 @@ void RewardsServiceImpl::OnPanelPublisherInfo(
     const ledger::type::Result result,
     ledger::type::PublisherInfoPtr info,
     uint64_t windowId) {
+  auto pending = pending_panel_lookups_.find(windowId);
+  if (pending != pending_panel_lookups_.end()) {
+    if (result == ledger::type::Result::LEDGER_OK ||
+        result == ledger::type::Result::NOT_FOUND) {
+      PanelPublisherEntry entry;
+      entry.result = result;
+      entry.info = info ? info->Clone() : nullptr;
+      entry.created_at = base::TimeTicks::Now();
+      panel_publisher_index_[pending->second] = std::move(entry);
+    }
+    pending_panel_lookups_.erase(pending);
+  }
+
   if (result != ledger::type::Result::LEDGER_OK &&
       result != ledger::type::Result::NOT_FOUND) {
     return;
@@ -2121,6 +2210,8 @@ void RewardsServiceImpl::OnSetPublisherExclude(
     return;
   }
 
+  panel_publisher_index_.clear();
+
   for (auto& observer : observers_) {
     observer.OnExcludedSitesChanged(this, publisher_key, exclude);
   }
@@ -2600,6 +2691,8 @@ void RewardsServiceImpl::OnRefreshPublisher(
     RefreshPublisherCallback callback,
     const std::string& publisher_key,
     ledger::type::PublisherStatus status) {
+  // The publisher's status may have changed; drop the stale index entries.
+  panel_publisher_index_.clear();
   std::move(callback).Run(status, publisher_key);
 }
 
@@ -2754,7 +2847,6 @@ void RewardsServiceImpl::OnContributeUnverifiedPublishers(
 }
 
 void RewardsServiceImpl::OnFetchBalance(
-    FetchBalanceCallback callback,
     const ledger::type::Result result,
     ledger::type::BalancePtr balance) {
   // Record wallet P3A stats
@@ -2777,7 +2869,11 @@ void RewardsServiceImpl::OnFetchBalance(
     }
   }
 
-  std::move(callback).Run(result, std::move(balance));
+  auto callbacks = std::move(pending_balance_callbacks_);
+  pending_balance_callbacks_.clear();
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(result, balance ? balance->Clone() : nullptr);
+  }
 }
 
 void RewardsServiceImpl::FetchBalance(FetchBalanceCallback callback) {
@@ -2786,10 +2882,16 @@ void RewardsServiceImpl::FetchBalance(FetchBalanceCallback callback) {
     return;
   }
 
+  pending_balance_callbacks_.push_back(std::move(callback));
+  if (pending_balance_callbacks_.size() > 1) {
+    // A balance fetch hits every connected wallet provider's servers, so
+    // simultaneous requests share the one already on its way.
+    return;
+  }
+
   bat_ledger_->FetchBalance(
       base::BindOnce(&RewardsServiceImpl::OnFetchBalance,
-                     AsWeakPtr(),
-                     std::move(callback)));
+                     AsWeakPtr()));
 }
 
 std::string RewardsServiceImpl::GetLegacyWallet() {
@@ -3119,10 +3221,52 @@ ledger::type::DBCommandResponsePtr RunDBTransactionOnFileTaskRunner(
   return response;
 }
 
+ledger::type::DBCommandResponsePtr RunReadOnlyDBTransactionOnReaderTaskRunner(
+    ledger::type::DBTransactionPtr transaction,
+    ledger::LedgerDatabase* database) {
+  auto response = ledger::type::DBCommandResponse::New();
+  if (!database) {
+    response->status = ledger::type::DBCommandResponse::Status::RESPONSE_ERROR;
+  } else {
+    database->RunReadOnlyTransaction(std::move(transaction), response.get());
+  }
+
+  return response;
+}
+
+bool IsReadOnlyDBTransaction(const ledger::type::DBTransaction& transaction) {
+  if (transaction.commands.empty()) {
+    return false;
+  }
+
+  for (const auto& command : transaction.commands) {
+    if (command->type != ledger::type::DBCommand::Type::READ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 void RewardsServiceImpl::RunDBTransaction(
     ledger::type::DBTransactionPtr transaction,
     ledger::client::RunDBTransactionCallback callback) {
   DCHECK(ledger_database_);
+
+  // Once the ledger is initialized, read-only transactions run on their own
+  // connection in WAL mode, so panel reads (balance reports, pending
+  // contributions) don't queue behind contribution writes on the database
+  // sequence.
+  if (ready_->is_signaled() && IsReadOnlyDBTransaction(*transaction)) {
+    base::PostTaskAndReplyWithResult(
+        db_reader_task_runner_.get(), FROM_HERE,
+        base::BindOnce(&RunReadOnlyDBTransactionOnReaderTaskRunner,
+                       std::move(transaction), ledger_database_.get()),
+        base::BindOnce(&RewardsServiceImpl::OnRunDBTransaction, AsWeakPtr(),
+                       std::move(callback)));
+    return;
+  }
+
   base::PostTaskAndReplyWithResult(
       file_task_runner_.get(), FROM_HERE,
       base::BindOnce(&RunDBTransactionOnFileTaskRunner, std::move(transaction),
@@ -18,6 +18,7 @@
 #include "base/files/file.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "base/observer_list.h"
 #include "base/one_shot_event.h"
 #include "base/sequence_checker.h"
@@ -396,9 +397,7 @@ class RewardsServiceImpl : public RewardsService,
                               std::pair<std::string, base::Value> data);
   void OnPublisherStateLoaded(ledger::client::OnLoadCallback callback,
                               const std::string& data);
-  void OnGetRewardsParameters(
-      GetRewardsParametersCallback callback,
-      ledger::type::RewardsParametersPtr parameters);
+  void OnGetRewardsParameters(ledger::type::RewardsParametersPtr parameters);
   void OnFetchPromotions(
     const ledger::type::Result result,
     ledger::type::PromotionList promotions);
@@ -467,8 +466,7 @@ class RewardsServiceImpl : public RewardsService,
 
   void OnRemoveAllPendingContributions(const ledger::type::Result result);
 
-  void OnFetchBalance(FetchBalanceCallback callback,
-                      const ledger::type::Result result,
+  void OnFetchBalance(const ledger::type::Result result,
                       ledger::type::BalancePtr balance);
 
   void OnGetExternalWallet(GetExternalWalletCallback callback,
@@ -545,6 +543,7 @@ class RewardsServiceImpl : public RewardsService,
   void LoadURL(
       ledger::type::UrlRequestPtr request,
       ledger::client::LoadURLCallback callback) override;
+  void PreconnectURL(const std::string& url) override;
   void SetPublisherMinVisits(int visits) const override;
   void SetPublisherAllowNonVerified(bool allow) const override;
   void SetPublisherAllowVideos(bool allow) const override;
@@ -718,6 +717,8 @@ class RewardsServiceImpl : public RewardsService,
       ledger::client::RunDBTransactionCallback callback,
       ledger::type::DBCommandResponsePtr response);
 
+  void ReleaseLedgerDatabase();
+
   void OnGetAllMonthlyReportIds(
       GetAllMonthlyReportIdsCallback callback,
       const std::vector<std::string>& ids);
@@ -763,6 +764,9 @@ class RewardsServiceImpl : public RewardsService,
   mojo::AssociatedRemote<bat_ledger::mojom::BatLedger> bat_ledger_;
   mojo::Remote<bat_ledger::mojom::BatLedgerService> bat_ledger_service_;
   const scoped_refptr<base::SequencedTaskRunner> file_task_runner_;
+  // Runs read-only database transactions on a dedicated connection so UI
+  // reads don't queue behind contribution writes on |file_task_runner_|.
+  const scoped_refptr<base::SequencedTaskRunner> db_reader_task_runner_;
 
   const base::FilePath ledger_state_path_;
   const base::FilePath publisher_state_path_;
@@ -776,6 +780,25 @@ class RewardsServiceImpl : public RewardsService,
   std::unique_ptr<RewardsServiceObserver> extension_observer_;
   std::unique_ptr<RewardsServicePrivateObserver> private_observer_;
 
+  // A panel publisher lookup answered by the ledger process, kept so repeat
+  // navigations to the same registrable domain are served without touching
+  // the rewards database. See GetPublisherActivityFromUrl.
+  struct PanelPublisherEntry {
+    ledger::type::Result result;
+    ledger::type::PublisherInfoPtr info;
+    base::TimeTicks created_at;
+  };
+  base::flat_map<std::string, PanelPublisherEntry> panel_publisher_index_;
+  // Registrable domain of each in-flight panel lookup, keyed by window id,
+  // used to attribute the reply in OnPanelPublisherInfo.
+  base::flat_map<uint64_t, std::string> pending_panel_lookups_;
+  // Callbacks waiting on a rewards parameters or balance fetch that is
+  // already in flight. Every rewards surface (page, panel, NTP widget) asks
+  // for these when it opens, so simultaneous requests share one ledger
+  // round trip instead of each issuing their own.
+  std::vector<GetRewardsParametersCallback> pending_parameters_callbacks_;
+  std::vector<FetchBalanceCallback> pending_balance_callbacks_;
+
   std::unique_ptr<base::OneShotEvent> ready_;
   SimpleURLLoaderList url_loaders_;
   std::map<std::string, BitmapFetcherService::RequestId>
@@ -37,6 +37,12 @@ net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
 }
 
 const unsigned int kRetriesCountOnNetworkChange = 1;
+
+// Backup results for the same query are reused briefly so a refresh or a
+// re-submitted query does not pay for another round trip
+constexpr base::TimeDelta kResponseCacheTtl = base::TimeDelta::FromMinutes(5);
+constexpr size_t kResponseCacheSize = 10;
+
 static GURL backup_provider_for_test;
 }  // namespace
 
@@ -49,7 +55,9 @@ void BraveSearchFallbackHost::SetBackupProviderForTest(
 
 BraveSearchFallbackHost::BraveSearchFallbackHost(
     scoped_refptr<network::SharedURLLoaderFactory> factory)
-    : shared_url_loader_factory_(std::move(factory)), weak_factory_(this) {}
+    : shared_url_loader_factory_(std::move(factory)),
+      response_cache_(kResponseCacheSize),
+      weak_factory_(this) {}
 
 BraveSearchFallbackHost::~BraveSearchFallbackHost() {}
 
@@ -88,6 +96,18 @@ void BraveSearchFallbackHost::FetchBackupResults(
   }
   request->url = GetBackupResultURL(request->url, query, lang, country, geo,
                                     filter_explicit_results);
+
+  const std::string cache_key = request->url.spec() + "\n" + geo;
+  auto cached = response_cache_.Get(cache_key);
+  if (cached != response_cache_.end()) {
+    if (base::TimeTicks::Now() - cached->second.fetched_at <
+        kResponseCacheTtl) {
+      std::move(callback).Run(cached->second.body);
+      return;
+    }
+    response_cache_.Erase(cached);
+  }
+
   request->load_flags = net::LOAD_BYPASS_CACHE | net::LOAD_DISABLE_CACHE;
   request->credentials_mode = network::mojom::CredentialsMode::kOmit;
   request->load_flags |= net::LOAD_DO_NOT_SAVE_COOKIES;
@@ -103,15 +123,18 @@ void BraveSearchFallbackHost::FetchBackupResults(
   iter->get()->DownloadToStringOfUnboundedSizeUntilCrashAndDie(
       shared_url_loader_factory_.get(),
       base::BindOnce(&BraveSearchFallbackHost::OnURLLoaderComplete,
-                     weak_factory_.GetWeakPtr(), iter, std::move(callback)));
+                     weak_factory_.GetWeakPtr(), iter, cache_key,
+                     std::move(callback)));
 }
 
 void BraveSearchFallbackHost::OnURLLoaderComplete(
     SimpleURLLoaderList::iterator iter,
+    const std::string& cache_key,
     BraveSearchFallbackHost::FetchBackupResultsCallback callback,
     const std::unique_ptr<std::string> response_body) {
   url_loaders_.erase(iter);
   if (response_body) {
+    response_cache_.Put(cache_key, {base::TimeTicks::Now(), *response_body});
     std::move(callback).Run(*response_body);
   } else {
     std::move(callback).Run("");
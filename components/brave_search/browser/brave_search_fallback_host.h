@@ -11,7 +11,9 @@
 #include <memory>
 #include <string>
 
+#include "base/containers/mru_cache.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "brave/components/brave_search/common/brave_search_fallback.mojom.h"
 #include "url/gurl.h"
 
@@ -54,11 +56,20 @@ class BraveSearchFallbackHost final
                               const std::string&,
                               const std::map<std::string, std::string>&)>;
 
+  struct CachedResponse {
+    base::TimeTicks fetched_at;
+    std::string body;
+  };
+
   void OnURLLoaderComplete(
       SimpleURLLoaderList::iterator iter,
+      const std::string& cache_key,
       BraveSearchFallbackHost::FetchBackupResultsCallback callback,
       const std::unique_ptr<std::string> response_body);
   SimpleURLLoaderList url_loaders_;
+  // Recently fetched backup results keyed by request URL and geo, so
+  // re-submitting the same query does not pay for another round trip
+  base::MRUCache<std::string, CachedResponse> response_cache_;
   scoped_refptr<network::SharedURLLoaderFactory> shared_url_loader_factory_;
   base::WeakPtrFactory<BraveSearchFallbackHost> weak_factory_;
 };
@@ -11,16 +11,26 @@
 #include <vector>
 
 #include "base/bind.h"
+#include "base/cxx17_backports.h"
+#include "base/feature_list.h"
 #include "base/files/file_path.h"
 #include "base/json/json_reader.h"
 #include "base/macros.h"
 #include "base/memory/ptr_util.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/task/post_task.h"
 #include "base/task/thread_pool.h"
+#include "base/timer/elapsed_timer.h"
+#include "base/trace_event/trace_event.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
+#include "brave/components/brave_shields/browser/ad_block_service_helper.h"
+#include "brave/components/brave_shields/browser/cache_generation_bus.h"
+#include "brave/components/brave_shields/browser/shields_data_ready_barrier.h"
 #include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "brave/components/brave_shields/common/features.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
@@ -31,77 +41,88 @@ using brave_component_updater::BraveComponent;
 using content::BrowserThread;
 using namespace net::registry_controlled_domains;  // NOLINT
 
+namespace brave_shields {
+
 namespace {
 
-std::string ResourceTypeToString(blink::mojom::ResourceType resource_type) {
-  std::string filter_option = "";
-  switch (resource_type) {
-    // top level page
-    case blink::mojom::ResourceType::kMainFrame:
-      filter_option = "main_frame";
-      break;
-    // frame or iframe
-    case blink::mojom::ResourceType::kSubFrame:
-      filter_option = "sub_frame";
-      break;
-    // a CSS stylesheet
-    case blink::mojom::ResourceType::kStylesheet:
-      filter_option = "stylesheet";
-      break;
-    // an external script
-    case blink::mojom::ResourceType::kScript:
-      filter_option = "script";
-      break;
-    // an image (jpg/gif/png/etc)
-    case blink::mojom::ResourceType::kFavicon:
-    case blink::mojom::ResourceType::kImage:
-      filter_option = "image";
-      break;
-    // a font
-    case blink::mojom::ResourceType::kFontResource:
-      filter_option = "font";
-      break;
-    // an "other" subresource.
-    case blink::mojom::ResourceType::kSubResource:
-      filter_option = "other";
-      break;
-    // an object (or embed) tag for a plugin.
-    case blink::mojom::ResourceType::kObject:
-      filter_option = "object";
-      break;
-    // a media resource.
-    case blink::mojom::ResourceType::kMedia:
-      filter_option = "media";
-      break;
-    // a XMLHttpRequest
-    case blink::mojom::ResourceType::kXhr:
-      filter_option = "xhr";
-      break;
-    // a ping request for <a ping>/sendBeacon.
-    case blink::mojom::ResourceType::kPing:
-      filter_option = "ping";
-      break;
-    // the main resource of a dedicated worker.
-    case blink::mojom::ResourceType::kWorker:
-    // the main resource of a shared worker.
-    case blink::mojom::ResourceType::kSharedWorker:
-    // an explicitly requested prefetch
-    case blink::mojom::ResourceType::kPrefetch:
-    // the main resource of a service worker.
-    case blink::mojom::ResourceType::kServiceWorker:
-    // a report of Content Security Policy violations.
-    case blink::mojom::ResourceType::kCspReport:
-    // a resource that a plugin requested.
-    case blink::mojom::ResourceType::kPluginResource:
-    default:
-      break;
+// A canned corpus representative of the request mix an engine sees in the
+// wild: first-party page resources, third-party subresources, and URLs with
+// long query strings that are the usual victims of pathological regex
+// rules. Kept small; admission cost is corpus size times |kAdmissionRounds|
+// matches on the task runner per list update.
+struct AdmissionQuery {
+  const char* url;
+  const char* host;
+  const char* tab_host;
+  bool is_third_party;
+  const char* resource_type;
+};
+
+constexpr AdmissionQuery kAdmissionCorpus[] = {
+    {"https://example.com/static/app.js", "example.com", "example.com", false,
+     "script"},
+    {"https://example.com/assets/hero.jpg", "example.com", "example.com",
+     false, "image"},
+    {"https://cdn.example.net/lib/jquery.min.js", "cdn.example.net",
+     "example.com", true, "script"},
+    {"https://fonts.example.org/css2?family=Inter:wght@400;700",
+     "fonts.example.org", "example.com", true, "stylesheet"},
+    {"https://ads.example-tracker.com/pixel?id=1234567890&ref=example.com",
+     "ads.example-tracker.com", "example.com", true, "image"},
+    {"https://analytics.example.net/collect?v=1&tid=UA-1&cid=5&t=pageview"
+     "&dl=https%3A%2F%2Fexample.com%2F&ul=en-us&de=UTF-8&sd=24-bit",
+     "analytics.example.net", "example.com", true, "xmlhttprequest"},
+    {"https://video.example.com/api/manifest/dash/id/1234/fmt/mpd",
+     "video.example.com", "video.example.com", false, "media"},
+    {"https://sub.news-site.com/2021/05/01/article-title/amp/",
+     "sub.news-site.com", "news-site.com", false, "sub_frame"},
+    {"https://social.example.org/plugins/like.php?href=example.com&width=90",
+     "social.example.org", "example.com", true, "sub_frame"},
+    {"https://example.com/wp-content/uploads/2021/04/photo-1024x768.png",
+     "example.com", "example.com", false, "image"},
+};
+
+constexpr int kAdmissionRounds = 50;
+
+// Budget for the mean match time over the corpus. Generous relative to a
+// healthy engine so only genuinely pathological lists trip it.
+constexpr base::TimeDelta kAdmissionMeanMatchBudget =
+    base::TimeDelta::FromMicroseconds(500);
+
+// Returns whether |engine|'s mean match time over the canned corpus fits
+// the admission budget.
+bool PassesAdmissionBenchmark(adblock::Engine* engine) {
+  bool did_match_rule = false;
+  bool did_match_exception = false;
+  bool did_match_important = false;
+  std::string mock_data_url;
+
+  const base::ElapsedTimer timer;
+  for (int round = 0; round < kAdmissionRounds; ++round) {
+    for (const AdmissionQuery& query : kAdmissionCorpus) {
+      engine->matches(query.url, query.host, query.tab_host,
+                      query.is_third_party, query.resource_type,
+                      &did_match_rule, &did_match_exception,
+                      &did_match_important, &mock_data_url);
+    }
   }
-  return filter_option;
+  const base::TimeDelta mean =
+      timer.Elapsed() / (kAdmissionRounds * base::size(kAdmissionCorpus));
+  if (mean > kAdmissionMeanMatchBudget) {
+    LOG(ERROR) << "Ad block list update failed admission benchmark: mean "
+               << mean.InMicrosecondsF() << "us per match against a budget of "
+               << kAdmissionMeanMatchBudget.InMicrosecondsF() << "us";
+    return false;
+  }
+  return true;
 }
 
 }  // namespace
 
-namespace brave_shields {
+// static
+uint64_t AdBlockBaseService::engine_generation() {
+  return CacheGenerationBus::Get(CacheGenerationBus::Channel::kAdBlockEngine);
+}
 
 AdBlockBaseService::AdBlockBaseService(BraveComponent::Delegate* delegate)
     : BaseBraveShieldsService(delegate),
@@ -109,7 +130,11 @@ AdBlockBaseService::AdBlockBaseService(BraveComponent::Delegate* delegate)
       weak_factory_(this) {}
 
 AdBlockBaseService::~AdBlockBaseService() {
-  GetTaskRunner()->DeleteSoon(FROM_HERE, ad_block_client_.release());
+  // An in-flight match may still hold a reference; the engine is destroyed
+  // on the task runner once the last reference is dropped.
+  GetTaskRunner()->PostTask(
+      FROM_HERE, base::BindOnce([](std::shared_ptr<adblock::Engine>) {},
+                                std::move(ad_block_client_)));
 }
 
 void AdBlockBaseService::ShouldStartRequest(
@@ -120,7 +145,11 @@ void AdBlockBaseService::ShouldStartRequest(
     bool* did_match_exception,
     bool* did_match_important,
     std::string* mock_data_url) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  TRACE_EVENT1("brave.shields", "AdBlockBaseService::ShouldStartRequest",
+               "url", url.possibly_invalid_spec());
+  // The engine is read-only after load, so matching can run on any thread
+  // against a snapshot; only the pointer swap on DAT update is synchronized.
+  std::shared_ptr<adblock::Engine> engine = GetAdBlockClient();
 
   // Determine third-party here so the library doesn't need to figure it out.
   // CreateFromNormalizedTuple is needed because SameDomainOrHost needs
@@ -129,10 +158,22 @@ void AdBlockBaseService::ShouldStartRequest(
       url,
       url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
       INCLUDE_PRIVATE_REGISTRIES);
-  ad_block_client_->matches(
-      url.spec(), url.host(), tab_host, is_third_party,
-      ResourceTypeToString(resource_type), did_match_rule,
-      did_match_exception, did_match_important, mock_data_url);
+  const std::string& spec = url.spec();
+  const base::StringPiece host = url.host_piece();
+  const std::string resource_type_string =
+      ResourceTypeToString(resource_type);
+  engine->matches(spec.data(), spec.size(), host.data(), host.size(),
+                  tab_host.data(), tab_host.size(), is_third_party,
+                  resource_type_string.data(), resource_type_string.size(),
+                  did_match_rule, did_match_exception, did_match_important,
+                  mock_data_url);
+
+  if (*did_match_rule) {
+    TRACE_EVENT_INSTANT2("brave.shields", "AdBlockVerdict",
+                         TRACE_EVENT_SCOPE_THREAD, "url",
+                         url.possibly_invalid_spec(), "exception",
+                         *did_match_exception);
+  }
 
   // LOG(ERROR) << "AdBlockBaseService::ShouldStartRequest(), host: "
   //  << tab_host
@@ -140,11 +181,19 @@ void AdBlockBaseService::ShouldStartRequest(
   //  << ", url.spec(): " << url.spec();
 }
 
+void AdBlockBaseService::ShouldStartRequestBatch(
+    const std::vector<adblock::MatchQuery>& queries,
+    std::vector<adblock::MatchResult>* results) {
+  TRACE_EVENT1("brave.shields", "AdBlockBaseService::ShouldStartRequestBatch",
+               "queries", queries.size());
+  GetAdBlockClient()->matchesBatch(queries, results);
+}
+
 absl::optional<std::string> AdBlockBaseService::GetCspDirectives(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
     const std::string& tab_host) {
-  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  std::shared_ptr<adblock::Engine> engine = GetAdBlockClient();
 
   // Determine third-party here so the library doesn't need to figure it out.
   // CreateFromNormalizedTuple is needed because SameDomainOrHost needs
@@ -153,7 +202,7 @@ absl::optional<std::string> AdBlockBaseService::GetCspDirectives(
       url,
       url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
       INCLUDE_PRIVATE_REGISTRIES);
-  const std::string result = ad_block_client_->getCspDirectives(
+  const std::string result = engine->getCspDirectives(
       url.spec(), url.host(), tab_host, is_third_party,
       ResourceTypeToString(resource_type));
 
@@ -165,36 +214,80 @@ absl::optional<std::string> AdBlockBaseService::GetCspDirectives(
 }
 
 void AdBlockBaseService::EnableTag(const std::string& tag, bool enabled) {
-  if (BrowserThread::CurrentlyOn(BrowserThread::UI)) {
-    GetTaskRunner()->PostTask(
-        FROM_HERE, base::BindOnce(&AdBlockBaseService::EnableTag,
-                                  base::Unretained(this), tag, enabled));
-    return;
-  }
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  // The live engine is never mutated: matchers run against it lock-free
+  // from other threads and the FFI layer has no internal synchronization.
+  // Recompile with the new tag set and publish the result atomically
+  // instead. A demoted list stays demoted (no region to rebuild from).
+  GetTaskRunner()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&AdBlockBaseService::EnableTagOnTaskRunner,
+                     base::Unretained(this), tag, enabled,
+                     demoted_ ? base::ReadOnlySharedMemoryRegion()
+                              : dat_region_.Duplicate()));
+}
 
+void AdBlockBaseService::EnableTagOnTaskRunner(
+    const std::string& tag,
+    bool enabled,
+    base::ReadOnlySharedMemoryRegion region) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
   if (enabled) {
-    ad_block_client_->addTag(tag);
     tags_.push_back(tag);
   } else {
-    ad_block_client_->removeTag(tag);
     std::vector<std::string>::iterator it =
         std::find(tags_.begin(), tags_.end(), tag);
     if (it != tags_.end()) {
       tags_.erase(it);
     }
   }
+  RebuildEngineOnTaskRunner(std::move(region));
 }
 
 void AdBlockBaseService::AddResources(const std::string& resources) {
-  if (BrowserThread::CurrentlyOn(BrowserThread::UI)) {
-    GetTaskRunner()->PostTask(
-        FROM_HERE, base::BindOnce(&AdBlockBaseService::AddResources,
-                                  base::Unretained(this), resources));
-    return;
-  }
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  // Same copy-on-write scheme as EnableTag(); see above.
+  GetTaskRunner()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&AdBlockBaseService::AddResourcesOnTaskRunner,
+                     base::Unretained(this), resources,
+                     demoted_ ? base::ReadOnlySharedMemoryRegion()
+                              : dat_region_.Duplicate()));
+}
 
-  ad_block_client_->addResources(resources);
-  resources_ = resources;
+void AdBlockBaseService::AddResourcesOnTaskRunner(
+    const std::string& resources,
+    base::ReadOnlySharedMemoryRegion region) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  // Kept compressed for later engine swaps; the store de-duplicates the
+  // identical resources file every service forwards
+  AdBlockResourceStore::GetInstance()->SetResources(resources);
+  RebuildEngineOnTaskRunner(std::move(region));
+}
+
+void AdBlockBaseService::RebuildEngineOnTaskRunner(
+    base::ReadOnlySharedMemoryRegion region) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  std::unique_ptr<adblock::Engine> engine;
+  if (source_rules_) {
+    engine = std::make_unique<adblock::Engine>(*source_rules_);
+  } else if (region.IsValid()) {
+    base::ReadOnlySharedMemoryMapping mapping = region.Map();
+    engine = std::make_unique<adblock::Engine>();
+    if (!mapping.IsValid() ||
+        !engine->deserialize(static_cast<const char*>(mapping.memory()),
+                             mapping.size())) {
+      // Keep the current engine rather than publish a broken one; the new
+      // tags and resources still land with the next successful swap.
+      LOG(ERROR) << "Failed to rebuild ad block engine from its DAT";
+      return;
+    }
+  } else {
+    // No list source yet (or the list is demoted). The tags and resources
+    // are applied via UpdateAdBlockClient when one arrives.
+    engine = std::make_unique<adblock::Engine>();
+  }
+  UpdateAdBlockClient(std::move(engine));
 }
 
 bool AdBlockBaseService::TagExists(const std::string& tag) {
@@ -204,7 +297,8 @@ bool AdBlockBaseService::TagExists(const std::string& tag) {
 absl::optional<base::Value> AdBlockBaseService::UrlCosmeticResources(
     const std::string& url) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  return base::JSONReader::Read(ad_block_client_->urlCosmeticResources(url));
+  return base::JSONReader::Read(
+      GetAdBlockClient()->urlCosmeticResources(url));
 }
 
 absl::optional<base::Value> AdBlockBaseService::HiddenClassIdSelectors(
@@ -213,65 +307,181 @@ absl::optional<base::Value> AdBlockBaseService::HiddenClassIdSelectors(
     const std::vector<std::string>& exceptions) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
   return base::JSONReader::Read(
-      ad_block_client_->hiddenClassIdSelectors(classes, ids, exceptions));
+      GetAdBlockClient()->hiddenClassIdSelectors(classes, ids, exceptions));
 }
 
 void AdBlockBaseService::GetDATFileData(const base::FilePath& dat_file_path) {
+  ShieldsDataReadyBarrier::GetInstance()->RegisterPendingSource();
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&brave_component_updater::LoadDATFileData<adblock::Engine>,
-                     dat_file_path),
+      base::BindOnce(
+          &brave_component_updater::LoadSharedDATFileData<adblock::Engine>,
+          dat_file_path, dat_content_hash_),
       base::BindOnce(&AdBlockBaseService::OnGetDATFileData,
                      weak_factory_.GetWeakPtr()));
 }
 
-void AdBlockBaseService::OnGetDATFileData(GetDATFileDataResult result) {
-  if (result.second.empty()) {
+void AdBlockBaseService::DemoteEngine() {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  // Without a retained DAT there would be no way back to a full engine.
+  if (demoted_ || !dat_region_.IsValid())
+    return;
+  demoted_ = true;
+  GetTaskRunner()->PostTask(
+      FROM_HERE, base::BindOnce(&AdBlockBaseService::DemoteEngineOnTaskRunner,
+                                base::Unretained(this)));
+}
+
+void AdBlockBaseService::DemoteEngineOnTaskRunner() {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  // An empty engine keeps concurrent matchers working; it simply matches
+  // nothing until the list is restored.
+  SwapAdBlockClient(std::make_unique<adblock::Engine>());
+}
+
+void AdBlockBaseService::RestoreDemotedEngine() {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  if (!demoted_)
+    return;
+  demoted_ = false;
+  GetTaskRunner()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&AdBlockBaseService::RestoreDemotedEngineOnTaskRunner,
+                     base::Unretained(this), dat_region_.Duplicate()));
+}
+
+void AdBlockBaseService::RestoreDemotedEngineOnTaskRunner(
+    base::ReadOnlySharedMemoryRegion region) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  base::ReadOnlySharedMemoryMapping mapping = region.Map();
+  if (!mapping.IsValid())
+    return;
+  auto engine = std::make_unique<adblock::Engine>();
+  if (!engine->deserialize(static_cast<const char*>(mapping.memory()),
+                           mapping.size())) {
+    LOG(ERROR) << "Failed to restore demoted ad block engine";
+    return;
+  }
+  UpdateAdBlockClient(std::move(engine));
+}
+
+void AdBlockBaseService::OnGetDATFileData(GetSharedDATFileDataResult result) {
+  if (result.unchanged) {
+    // Byte-identical to the DAT already loaded; the current engine, DAT
+    // region and tiering state all stay as they are.
+    VLOG(1) << "Ad block DAT unchanged; keeping current engine";
+    ShieldsDataReadyBarrier::GetInstance()->SignalSourceReady();
+    return;
+  }
+  if (!result.region.IsValid()) {
     LOG(ERROR) << "Could not obtain ad block data";
+    ShieldsDataReadyBarrier::GetInstance()->SignalSourceReady();
     return;
   }
-  if (!result.first.get()) {
+  if (!result.client.get()) {
     LOG(ERROR) << "Failed to deserialize ad block data";
+    ShieldsDataReadyBarrier::GetInstance()->SignalSourceReady();
     return;
   }
-  GetTaskRunner()->PostTask(
-      FROM_HERE, base::BindOnce(&AdBlockBaseService::UpdateAdBlockClient,
-                                base::Unretained(this),
-                                std::move(result.first)));
+  // Remember the hash whether or not the engine is ultimately admitted; a
+  // quarantined update redelivered byte-for-byte would only be rejected
+  // again, so there is no point recompiling it.
+  dat_content_hash_ = result.content_hash;
+  // The DAT region is only adopted once the engine built from it is
+  // admitted; a quarantined update must not become the restore source for
+  // tiering either.
+  GetTaskRunner()->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&AdBlockBaseService::AdmitAndUpdateAdBlockClient,
+                     base::Unretained(this), std::move(result.client)),
+      base::BindOnce(&AdBlockBaseService::OnEngineAdmission,
+                     weak_factory_.GetWeakPtr(), std::move(result.region)));
 }
 
-void AdBlockBaseService::UpdateAdBlockClient(
+bool AdBlockBaseService::AdmitAndUpdateAdBlockClient(
     std::unique_ptr<adblock::Engine> ad_block_client) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  ad_block_client_ = std::move(ad_block_client);
-  AddKnownTagsToAdBlockInstance();
-  AddKnownResourcesToAdBlockInstance();
+  if (engine_published_ &&
+      base::FeatureList::IsEnabled(features::kBraveAdblockListQuarantine) &&
+      !PassesAdmissionBenchmark(ad_block_client.get())) {
+    // Keep serving the previous engine; the next component update gets a
+    // fresh chance.
+    return false;
+  }
+  UpdateAdBlockClient(std::move(ad_block_client));
+  engine_published_ = true;
+  // A DAT-built engine supersedes any rules-text source.
+  source_rules_.reset();
+  return true;
 }
 
-void AdBlockBaseService::AddKnownTagsToAdBlockInstance() {
+void AdBlockBaseService::OnEngineAdmission(
+    base::ReadOnlySharedMemoryRegion region,
+    bool admitted) {
+  DCHECK(BrowserThread::CurrentlyOn(BrowserThread::UI));
+  if (admitted) {
+    dat_region_ = std::move(region);
+    // A fresh DAT always ships with a fully compiled engine.
+    demoted_ = false;
+  }
+  ShieldsDataReadyBarrier::GetInstance()->SignalSourceReady();
+}
+
+void AdBlockBaseService::UpdateAdBlockClient(
+    std::unique_ptr<adblock::Engine> ad_block_client) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  // Configure the new engine before publishing it so concurrent matchers
+  // never observe an engine without the known tags and resources.
   std::for_each(tags_.begin(), tags_.end(),
-                [&](const std::string tag) { ad_block_client_->addTag(tag); });
+                [&](const std::string& tag) { ad_block_client->addTag(tag); });
+  const std::shared_ptr<const std::string> resources =
+      AdBlockResourceStore::GetInstance()->GetResources();
+  ad_block_client->addResources(*resources);
+  SwapAdBlockClient(std::move(ad_block_client));
 }
 
-void AdBlockBaseService::AddKnownResourcesToAdBlockInstance() {
-  ad_block_client_->addResources(resources_);
+std::shared_ptr<adblock::Engine> AdBlockBaseService::GetAdBlockClient() const {
+  base::AutoLock lock(engine_lock_);
+  return ad_block_client_;
+}
+
+void AdBlockBaseService::SwapAdBlockClient(
+    std::unique_ptr<adblock::Engine> ad_block_client) {
+  std::shared_ptr<adblock::Engine> old_client;
+  {
+    base::AutoLock lock(engine_lock_);
+    old_client = std::move(ad_block_client_);
+    ad_block_client_ = std::move(ad_block_client);
+  }
+  CacheGenerationBus::Bump(CacheGenerationBus::Channel::kAdBlockEngine);
+  // |old_client| is released outside the lock; matchers still holding a
+  // reference keep it alive until they finish.
 }
 
 bool AdBlockBaseService::Init() {
   return true;
 }
 
+void AdBlockBaseService::UpdateEngineFromRules(const std::string& rules) {
+  DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
+  source_rules_ = rules;
+  UpdateAdBlockClient(std::make_unique<adblock::Engine>(rules));
+}
+
 void AdBlockBaseService::ResetForTest(const std::string& rules,
                                       const std::string& resources) {
   // This is temporary until adblock-rust supports incrementally adding
   // filter rules to an existing instance. At which point the hack below
   // will dissapear.
-  ad_block_client_.reset(new adblock::Engine(rules));
-  AddKnownTagsToAdBlockInstance();
+  source_rules_ = rules;
+  auto engine = std::make_unique<adblock::Engine>(rules);
+  std::for_each(tags_.begin(), tags_.end(),
+                [&](const std::string& tag) { engine->addTag(tag); });
   if (!resources.empty()) {
-    resources_ = resources;
+    AdBlockResourceStore::GetInstance()->SetResources(resources);
   }
-  AddKnownResourcesToAdBlockInstance();
+  engine->addResources(*AdBlockResourceStore::GetInstance()->GetResources());
+  SwapAdBlockClient(std::move(engine));
 }
 
 ///////////////////////////////////////////////////////////////////////////////
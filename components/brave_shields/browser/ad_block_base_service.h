@@ -14,8 +14,10 @@
 #include <vector>
 
 #include "base/files/file_path.h"
+#include "base/memory/read_only_shared_memory_region.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
+#include "base/synchronization/lock.h"
 #include "base/values.h"
 #include "brave/components/brave_shields/browser/base_brave_shields_service.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
@@ -27,6 +29,8 @@ class BraveAdBlockTPNetworkDelegateHelperTest;
 using brave_component_updater::BraveComponent;
 namespace adblock {
 class Engine;
+struct MatchQuery;
+struct MatchResult;
 }
 
 namespace brave_shields {
@@ -37,10 +41,19 @@ class AdBlockBaseService : public BaseBraveShieldsService {
  public:
   using GetDATFileDataResult =
       brave_component_updater::LoadDATFileDataResult<adblock::Engine>;
+  using GetSharedDATFileDataResult =
+      brave_component_updater::LoadSharedDATFileDataResult<adblock::Engine>;
 
   explicit AdBlockBaseService(BraveComponent::Delegate* delegate);
   ~AdBlockBaseService() override;
 
+  // A read-only handle to the raw DAT backing the current engine. Consumers
+  // (e.g. the network service) can map this to deserialize their own engine
+  // from the same physical pages instead of receiving another copy over IPC.
+  base::ReadOnlySharedMemoryRegion shared_dat_region() const {
+    return dat_region_.Duplicate();
+  }
+
   void ShouldStartRequest(const GURL& url,
                           blink::mojom::ResourceType resource_type,
                           const std::string& tab_host,
@@ -48,6 +61,12 @@ class AdBlockBaseService : public BaseBraveShieldsService {
                           bool* did_match_exception,
                           bool* did_match_important,
                           std::string* mock_data_url) override;
+  // Classifies all of |queries| in a single engine crossing. |results| must
+  // have the same size as |queries|; verdicts are merged in place so one
+  // batch can be threaded through several services.
+  virtual void ShouldStartRequestBatch(
+      const std::vector<adblock::MatchQuery>& queries,
+      std::vector<adblock::MatchResult>* results);
   absl::optional<std::string> GetCspDirectives(
       const GURL& url,
       blink::mojom::ResourceType resource_type,
@@ -63,6 +82,26 @@ class AdBlockBaseService : public BaseBraveShieldsService {
       const std::vector<std::string>& ids,
       const std::vector<std::string>& exceptions);
 
+  // Returns a snapshot of the current engine. The caller may match against it
+  // from any thread; the reference keeps the engine alive across an
+  // in-flight match even if a DAT update swaps the engine concurrently.
+  std::shared_ptr<adblock::Engine> GetAdBlockClient() const;
+
+  // Tiering support. DemoteEngine() swaps the compiled engine for an empty
+  // one, dropping the list's resident cost to the retained read-only DAT
+  // region; a demoted list matches nothing. RestoreDemotedEngine()
+  // recompiles the engine from that region. Used by
+  // AdBlockRegionalServiceManager to keep rarely-hit regional lists cheap on
+  // low-memory devices. Both must be called on the UI thread; the engine
+  // swap itself happens on the task runner.
+  void DemoteEngine();
+  void RestoreDemotedEngine();
+
+  // A process-wide counter bumped whenever any adblock engine is swapped.
+  // Consumers caching engine-derived data (e.g. renderer-side cosmetic
+  // resources) can compare generations to detect staleness.
+  static uint64_t engine_generation();
+
  protected:
   friend class ::AdBlockServiceTest;
   friend class ::BraveAdBlockTPNetworkDelegateHelperTest;
@@ -70,20 +109,68 @@ class AdBlockBaseService : public BaseBraveShieldsService {
   bool Init() override;
 
   void GetDATFileData(const base::FilePath& dat_file_path);
-  void AddKnownTagsToAdBlockInstance();
-  void AddKnownResourcesToAdBlockInstance();
   void ResetForTest(const std::string& rules, const std::string& resources);
 
-  std::unique_ptr<adblock::Engine> ad_block_client_;
+  // Atomically publishes |ad_block_client| as the current engine and bumps
+  // the engine cache generation. Known tags and resources must already be
+  // applied so readers never observe a partially configured engine. Every
+  // change to engine state must be published through here; the live engine
+  // is never mutated, since matchers run against it lock-free from other
+  // threads and dependent caches invalidate off the generation bump.
+  void SwapAdBlockClient(std::unique_ptr<adblock::Engine> ad_block_client);
+
+  // Compiles an engine from |rules| and publishes it with the known tags
+  // and resources applied, remembering the text so later tag or resource
+  // changes can recompile from the same source. Task runner only.
+  void UpdateEngineFromRules(const std::string& rules);
 
  private:
   void UpdateAdBlockClient(
       std::unique_ptr<adblock::Engine> ad_block_client);
-  void OnGetDATFileData(GetDATFileDataResult result);
+  void EnableTagOnTaskRunner(const std::string& tag,
+                             bool enabled,
+                             base::ReadOnlySharedMemoryRegion region);
+  void AddResourcesOnTaskRunner(const std::string& resources,
+                                base::ReadOnlySharedMemoryRegion region);
+  // Recompiles the engine from this service's current source (rules text if
+  // set, otherwise |region|) and publishes it, so tag and resource changes
+  // never mutate the live engine out from under concurrent matchers.
+  void RebuildEngineOnTaskRunner(base::ReadOnlySharedMemoryRegion region);
+  // Component-update path: benchmarks |ad_block_client| against a canned
+  // URL corpus on the task runner and publishes it only when it fits the
+  // admission budget (see features::kBraveAdblockListQuarantine). Returns
+  // whether the engine was published. The first engine for a service is
+  // always admitted; some protection beats none.
+  bool AdmitAndUpdateAdBlockClient(
+      std::unique_ptr<adblock::Engine> ad_block_client);
+  void OnEngineAdmission(base::ReadOnlySharedMemoryRegion region,
+                         bool admitted);
+  void OnGetDATFileData(GetSharedDATFileDataResult result);
   void OnPreferenceChanges(const std::string& pref_name);
+  void DemoteEngineOnTaskRunner();
+  void RestoreDemotedEngineOnTaskRunner(
+      base::ReadOnlySharedMemoryRegion region);
 
   std::vector<std::string> tags_;
-  std::string resources_;
+  // Rules text the engine was last compiled from, when the source is not a
+  // DAT (custom filters, tests). Task runner only; cleared once a DAT-built
+  // engine is admitted.
+  absl::optional<std::string> source_rules_;
+  // Whether an engine built from component data has been published. Task
+  // runner only; gates the admission benchmark so the first list load is
+  // never quarantined.
+  bool engine_published_ = false;
+  // Whether the compiled engine has been released in favour of the raw DAT.
+  // UI thread only; cleared when a DAT update delivers a fresh engine.
+  bool demoted_ = false;
+  // Hash of the last DAT handed to OnGetDATFileData(). UI thread only; lets
+  // a component update that redelivers identical bytes skip deserialization.
+  uint64_t dat_content_hash_ = 0;
+  base::ReadOnlySharedMemoryRegion dat_region_;
+  // Guards only the pointer itself; matching happens outside the lock on a
+  // shared_ptr snapshot, so the read path never contends with other readers.
+  mutable base::Lock engine_lock_;
+  std::shared_ptr<adblock::Engine> ad_block_client_;
   base::WeakPtrFactory<AdBlockBaseService> weak_factory_;
   DISALLOW_COPY_AND_ASSIGN(AdBlockBaseService);
 };
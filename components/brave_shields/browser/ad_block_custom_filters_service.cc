@@ -5,6 +5,9 @@
 
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
 
+#include <utility>
+
+#include "base/bind.h"
 #include "base/logging.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
@@ -42,15 +45,40 @@ bool AdBlockCustomFiltersService::UpdateCustomFilters(
     return false;
   local_state->SetString(prefs::kAdBlockCustomFilters, custom_filters);
 
-  GetTaskRunner()->PostTask(
+  // Skip the compile entirely if the rule set is unchanged.
+  if (custom_filters == last_compiled_filters_ && !compile_in_flight_)
+    return true;
+
+  // Coalesce edits that arrive while a compile is running; only the most
+  // recent rule set is compiled once the current one finishes.
+  if (compile_in_flight_) {
+    pending_filters_ = custom_filters;
+    return true;
+  }
+
+  compile_in_flight_ = true;
+  last_compiled_filters_ = custom_filters;
+  GetTaskRunner()->PostTaskAndReply(
       FROM_HERE,
       base::BindOnce(
           &AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner,
-          base::Unretained(this), custom_filters));
+          base::Unretained(this), custom_filters),
+      base::BindOnce(&AdBlockCustomFiltersService::OnCustomFiltersCompiled,
+                     weak_factory_.GetWeakPtr()));
 
   return true;
 }
 
+void AdBlockCustomFiltersService::OnCustomFiltersCompiled() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  compile_in_flight_ = false;
+  if (pending_filters_) {
+    std::string filters = std::move(*pending_filters_);
+    pending_filters_.reset();
+    UpdateCustomFilters(filters);
+  }
+}
+
 bool AdBlockCustomFiltersService::MigrateLegacyCosmeticFilters(
     const std::map<std::string, std::vector<std::string>> legacyFilters) {
   DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
@@ -84,7 +112,10 @@ bool AdBlockCustomFiltersService::MigrateLegacyCosmeticFilters(
 void AdBlockCustomFiltersService::UpdateCustomFiltersOnFileTaskRunner(
     const std::string& custom_filters) {
   DCHECK(GetTaskRunner()->RunsTasksInCurrentSequence());
-  ad_block_client_.reset(new adblock::Engine(custom_filters.c_str()));
+  // Publishing through the rules path keeps the filter text as the rebuild
+  // source for later tag or resource changes, and applies the known tags
+  // and resources before the engine goes live.
+  UpdateEngineFromRules(custom_filters);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
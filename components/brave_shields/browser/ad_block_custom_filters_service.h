@@ -11,7 +11,9 @@
 #include <string>
 #include <vector>
 
+#include "base/memory/weak_ptr.h"
 #include "brave/components/brave_shields/browser/ad_block_base_service.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 class AdBlockServiceTest;
 
@@ -37,6 +39,17 @@ class AdBlockCustomFiltersService : public AdBlockBaseService {
  private:
   friend class ::AdBlockServiceTest;
   void UpdateCustomFiltersOnFileTaskRunner(const std::string& custom_filters);
+  void OnCustomFiltersCompiled();
+
+  // adblock-rust cannot add rules to a live engine, so edits always recompile
+  // the full set; these members make a burst of edits (e.g. enterprise
+  // deployments pushing rules one at a time) cost one compile instead of one
+  // per rule. All accessed on the UI thread.
+  std::string last_compiled_filters_;
+  bool compile_in_flight_ = false;
+  absl::optional<std::string> pending_filters_;
+
+  base::WeakPtrFactory<AdBlockCustomFiltersService> weak_factory_{this};
 
   DISALLOW_COPY_AND_ASSIGN(AdBlockCustomFiltersService);
 };
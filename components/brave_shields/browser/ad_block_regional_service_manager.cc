@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/feature_list.h"
 #include "base/strings/string_util.h"
 #include "base/task/post_task.h"
 #include "base/values.h"
@@ -16,16 +17,37 @@
 #include "brave/components/brave_shields/browser/ad_block_regional_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service_helper.h"
+#include "brave/components/brave_shields/browser/cache_generation_bus.h"
+#include "brave/components/brave_shields/common/features.h"
 #include "brave/components/brave_shields/common/pref_names.h"
 #include "components/prefs/pref_service.h"
 #include "components/prefs/scoped_user_pref_update.h"
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "content/public/browser/browser_task_traits.h"
 #include "content/public/browser/browser_thread.h"
+#include "url/origin.h"
 
 using adblock::FilterList;
 
 namespace brave_shields {
 
+namespace {
+
+// Number of classified requests between tier evaluations. Large enough that
+// any list the user's routine browsing actually hits keeps its engine.
+constexpr uint64_t kTieringQueryWindow = 20000;
+
+size_t CountRuleMatches(const std::vector<adblock::MatchResult>& results) {
+  size_t matches = 0;
+  for (const auto& result : results) {
+    if (result.did_match_rule)
+      matches++;
+  }
+  return matches;
+}
+
+}  // namespace
+
 AdBlockRegionalServiceManager::AdBlockRegionalServiceManager(
     brave_component_updater::BraveComponent::Delegate* delegate)
     : delegate_(delegate),
@@ -123,18 +145,90 @@ void AdBlockRegionalServiceManager::ShouldStartRequest(
     bool* did_match_exception,
     bool* did_match_important,
     std::string* mock_data_url) {
+  // Snapshot the engines of every enabled list under the lock, then run a
+  // single multi-engine lookup outside it. One FFI crossing covers all
+  // regions, and matching never blocks list enable/disable.
+  std::vector<std::shared_ptr<adblock::Engine>> engine_refs;
+  {
+    base::AutoLock lock(regional_services_lock_);
+    engine_refs.reserve(regional_services_.size());
+    for (const auto& regional_service : regional_services_) {
+      engine_refs.push_back(regional_service.second->GetAdBlockClient());
+    }
+  }
+  if (engine_refs.empty()) {
+    return;
+  }
+
+  std::vector<adblock::Engine*> engines;
+  engines.reserve(engine_refs.size());
+  for (const auto& engine : engine_refs) {
+    engines.push_back(engine.get());
+  }
+
+  bool is_third_party = !net::registry_controlled_domains::SameDomainOrHost(
+      url,
+      url::Origin::CreateFromNormalizedTuple("https", tab_host.c_str(), 80),
+      net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+  adblock::Engine::matchesMulti(
+      engines, url.spec(), url.host(), tab_host, is_third_party,
+      ResourceTypeToString(resource_type), did_match_rule, did_match_exception,
+      did_match_important, mock_data_url);
+}
+
+void AdBlockRegionalServiceManager::ShouldStartRequestBatch(
+    const std::vector<adblock::MatchQuery>& queries,
+    std::vector<adblock::MatchResult>* results) {
   base::AutoLock lock(regional_services_lock_);
 
+  const bool tiering_enabled =
+      base::FeatureList::IsEnabled(features::kBraveAdblockRegionalListTiering);
   for (const auto& regional_service : regional_services_) {
-    regional_service.second->ShouldStartRequest(
-        url, resource_type, tab_host, did_match_rule, did_match_exception,
-        did_match_important, mock_data_url);
-    if (did_match_important && *did_match_important) {
-      return;
+    // Results merge in place, so the matches a list adds on top of the
+    // earlier ones attribute its hits.
+    const size_t hits_before = CountRuleMatches(*results);
+    regional_service.second->ShouldStartRequestBatch(queries, results);
+    const uint64_t hits = CountRuleMatches(*results) - hits_before;
+    list_hits_total_[regional_service.first] += hits;
+    if (tiering_enabled) {
+      tiering_hits_[regional_service.first] += hits;
+    }
+  }
+  match_queries_total_ += queries.size();
+
+  if (tiering_enabled) {
+    tiering_queries_ += queries.size();
+    if (tiering_queries_ >= kTieringQueryWindow) {
+      tiering_queries_ = 0;
+      base::PostTask(
+          FROM_HERE, {content::BrowserThread::UI},
+          base::BindOnce(&AdBlockRegionalServiceManager::EvaluateListTiers,
+                         base::Unretained(this)));
     }
   }
 }
 
+void AdBlockRegionalServiceManager::EvaluateListTiers() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  auto locale_entry = brave_shields::FindAdBlockFilterListByLocale(
+      regional_catalog_, delegate_->locale());
+
+  base::AutoLock lock(regional_services_lock_);
+  for (const auto& regional_service : regional_services_) {
+    const std::string& uuid = regional_service.first;
+    if (locale_entry != regional_catalog_.end() && locale_entry->uuid == uuid) {
+      // The current locale's list is always kept hot; an earlier locale may
+      // have left it demoted.
+      regional_service.second->RestoreDemotedEngine();
+      continue;
+    }
+    if (tiering_hits_[uuid] == 0) {
+      regional_service.second->DemoteEngine();
+    }
+  }
+  tiering_hits_.clear();
+}
+
 absl::optional<std::string> AdBlockRegionalServiceManager::GetCspDirectives(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
@@ -190,6 +284,11 @@ void AdBlockRegionalServiceManager::EnableFilterList(
       DCHECK(it != regional_services_.end());
       it->second->Unregister();
       regional_services_.erase(it);
+      // No engine swap happens when a list is removed, so caches keyed on
+      // the engine generation would keep serving verdicts that include it;
+      // bump the generation here. The enable path bumps when the new
+      // list's engine is published.
+      CacheGenerationBus::Bump(CacheGenerationBus::Channel::kAdBlockEngine);
     }
   }
 
@@ -314,6 +413,30 @@ AdBlockRegionalServiceManager::GetRegionalLists() {
   return list_value;
 }
 
+std::unique_ptr<base::DictionaryValue>
+AdBlockRegionalServiceManager::GetListHitReport() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  auto report = std::make_unique<base::DictionaryValue>();
+  auto list_value = std::make_unique<base::ListValue>();
+
+  base::AutoLock lock(regional_services_lock_);
+  report->SetDouble("total_queries",
+                    static_cast<double>(match_queries_total_));
+  for (const auto& list_hits : list_hits_total_) {
+    auto dict = std::make_unique<base::DictionaryValue>();
+    dict->SetString("uuid", list_hits.first);
+    const auto catalog_entry = brave_shields::FindAdBlockFilterListByUUID(
+        regional_catalog_, list_hits.first);
+    if (catalog_entry != regional_catalog_.end())
+      dict->SetString("title", catalog_entry->title);
+    dict->SetDouble("hits", static_cast<double>(list_hits.second));
+    list_value->Append(std::move(dict));
+  }
+  report->SetList("list_hits", std::move(list_value));
+
+  return report;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 std::unique_ptr<AdBlockRegionalServiceManager>
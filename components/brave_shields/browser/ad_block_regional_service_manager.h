@@ -42,6 +42,10 @@ class AdBlockRegionalServiceManager {
 
   std::unique_ptr<base::ListValue> GetRegionalLists();
 
+  // Diagnostics for brave://adblock: per-list rule-match counts and the
+  // number of classified requests since browser start. UI thread.
+  std::unique_ptr<base::DictionaryValue> GetListHitReport();
+
   void SetRegionalCatalog(std::vector<adblock::FilterList> catalog);
   const std::vector<adblock::FilterList>& GetRegionalCatalog();
 
@@ -54,6 +58,8 @@ class AdBlockRegionalServiceManager {
                           bool* did_match_exception,
                           bool* did_match_important,
                           std::string* mock_data_url);
+  void ShouldStartRequestBatch(const std::vector<adblock::MatchQuery>& queries,
+                               std::vector<adblock::MatchResult>* results);
   absl::optional<std::string> GetCspDirectives(
       const GURL& url,
       blink::mojom::ResourceType resource_type,
@@ -73,12 +79,31 @@ class AdBlockRegionalServiceManager {
   void StartRegionalServices();
   void UpdateFilterListPrefs(const std::string& uuid, bool enabled);
 
+  // Demotes enabled regional lists that matched nothing over the last
+  // tiering window, except the list for the current locale, which is also
+  // restored here if an earlier locale left it demoted. Runs on the UI
+  // thread, scheduled from the matching path; only used when
+  // features::kBraveAdblockRegionalListTiering is enabled.
+  void EvaluateListTiers();
+
   brave_component_updater::BraveComponent::Delegate* delegate_;  // NOT OWNED
   bool initialized_;
   base::Lock regional_services_lock_;
   std::map<std::string, std::unique_ptr<AdBlockRegionalService>>
       regional_services_;
 
+  // Tiering bookkeeping, guarded by |regional_services_lock_|: classified
+  // requests and per-list rule matches observed since the last tier
+  // evaluation.
+  uint64_t tiering_queries_ = 0;
+  std::map<std::string, uint64_t> tiering_hits_;
+
+  // Cumulative since browser start, guarded by |regional_services_lock_|.
+  // Unlike the tiering counters these are never cleared; they feed the
+  // diagnostics on brave://adblock.
+  uint64_t match_queries_total_ = 0;
+  std::map<std::string, uint64_t> list_hits_total_;
+
   std::vector<adblock::FilterList> regional_catalog_;
 
   DISALLOW_COPY_AND_ASSIGN(AdBlockRegionalServiceManager);
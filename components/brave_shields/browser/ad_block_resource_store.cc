@@ -0,0 +1,65 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/ad_block_resource_store.h"
+
+#include <utility>
+
+#include "base/hash/hash.h"
+#include "base/logging.h"
+#include "third_party/zlib/google/compression_utils.h"
+
+namespace brave_shields {
+
+// static
+AdBlockResourceStore* AdBlockResourceStore::GetInstance() {
+  static base::NoDestructor<AdBlockResourceStore> instance;
+  return instance.get();
+}
+
+AdBlockResourceStore::AdBlockResourceStore() = default;
+
+AdBlockResourceStore::~AdBlockResourceStore() = default;
+
+void AdBlockResourceStore::SetResources(const std::string& resources) {
+  const size_t hash = base::FastHash(resources);
+
+  base::AutoLock lock(lock_);
+  if (resources.size() == resources_size_ && hash == resources_hash_) {
+    return;
+  }
+
+  std::string compressed;
+  if (!compression::GzipCompress(resources, &compressed)) {
+    LOG(ERROR) << "Failed to compress ad block resources";
+    return;
+  }
+
+  compressed_resources_ = std::move(compressed);
+  resources_size_ = resources.size();
+  resources_hash_ = hash;
+  inflated_resources_.reset();
+}
+
+std::shared_ptr<const std::string> AdBlockResourceStore::GetResources() {
+  base::AutoLock lock(lock_);
+  std::shared_ptr<const std::string> inflated = inflated_resources_.lock();
+  if (inflated) {
+    return inflated;
+  }
+
+  auto resources = std::make_shared<std::string>();
+  if (!compressed_resources_.empty() &&
+      !compression::GzipUncompress(compressed_resources_, resources.get())) {
+    LOG(ERROR) << "Failed to uncompress ad block resources";
+    resources->clear();
+  }
+
+  inflated = std::move(resources);
+  inflated_resources_ = inflated;
+  return inflated;
+}
+
+}  // namespace brave_shields
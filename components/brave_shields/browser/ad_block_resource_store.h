@@ -0,0 +1,64 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_STORE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_STORE_H_
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "base/no_destructor.h"
+#include "base/synchronization/lock.h"
+
+namespace brave_shields {
+
+// Holds the adblock scriptlet resources file compressed in memory. Every
+// adblock engine (default, custom filters and each enabled regional list) is
+// configured with the same resources JSON, and each service used to keep its
+// own inflated copy resident for the lifetime of the process. The store keeps
+// one gzip-compressed copy instead and inflates it on demand when an engine
+// is (re)configured, which only happens on component updates. Concurrent
+// engine updates share a single inflated snapshot; once the last engine has
+// consumed it the inflated memory is returned.
+//
+// All methods are thread-safe; services call them from their own task
+// runners.
+class AdBlockResourceStore {
+ public:
+  static AdBlockResourceStore* GetInstance();
+
+  AdBlockResourceStore(const AdBlockResourceStore&) = delete;
+  AdBlockResourceStore& operator=(const AdBlockResourceStore&) = delete;
+
+  // Compresses and stores |resources|. Storing the same contents again is
+  // detected and skipped, so every service can forward the resources file it
+  // observed without paying for recompression.
+  void SetResources(const std::string& resources);
+
+  // Returns the inflated resources, or an empty string when none are stored.
+  // The snapshot stays alive for as long as the caller holds the reference
+  // and is shared with any overlapping callers.
+  std::shared_ptr<const std::string> GetResources();
+
+ private:
+  friend class base::NoDestructor<AdBlockResourceStore>;
+  AdBlockResourceStore();
+  ~AdBlockResourceStore();
+
+  base::Lock lock_;
+  std::string compressed_resources_;
+  // Identifies the stored contents so redundant SetResources calls can be
+  // skipped without inflating for comparison
+  size_t resources_size_ = 0;
+  size_t resources_hash_ = 0;
+  // Shared inflated snapshot; alive only while at least one engine update is
+  // consuming it
+  std::weak_ptr<const std::string> inflated_resources_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_AD_BLOCK_RESOURCE_STORE_H_
@@ -15,6 +15,7 @@
 #include "base/logging.h"
 #include "base/macros.h"
 #include "base/memory/ptr_util.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/strings/utf_string_conversions.h"
 #include "base/threading/thread_restrictions.h"
@@ -70,6 +71,9 @@ void AdBlockService::ShouldStartRequest(
     bool* did_match_exception,
     bool* did_match_important,
     std::string* mock_data_url) {
+  // Covers the match across the default, regional and custom engines; the
+  // brave://performance page reports this histogram.
+  SCOPED_UMA_HISTOGRAM_TIMER("Brave.AdBlock.ShouldStartRequest");
   AdBlockBaseService::ShouldStartRequest(
       url, resource_type, tab_host, did_match_rule, did_match_exception,
       did_match_important, mock_data_url);
@@ -89,6 +93,14 @@ void AdBlockService::ShouldStartRequest(
       did_match_important, mock_data_url);
 }
 
+void AdBlockService::ShouldStartRequestBatch(
+    const std::vector<adblock::MatchQuery>& queries,
+    std::vector<adblock::MatchResult>* results) {
+  AdBlockBaseService::ShouldStartRequestBatch(queries, results);
+  regional_service_manager()->ShouldStartRequestBatch(queries, results);
+  custom_filters_service()->ShouldStartRequestBatch(queries, results);
+}
+
 absl::optional<std::string> AdBlockService::GetCspDirectives(
     const GURL& url,
     blink::mojom::ResourceType resource_type,
@@ -216,12 +228,39 @@ bool AdBlockService::Init() {
 
   Register(kAdBlockComponentName, g_ad_block_component_id_,
            g_ad_block_component_base64_public_key_);
+
+  // Warm start: load the DAT installed on a previous run before the component
+  // updater has finished its first check, so shields answer requests from the
+  // last known lists instead of passing them unexamined during startup. If
+  // the check installs a newer version, OnComponentReady reloads and swaps
+  // the engines as usual.
+  PrefService* local_state = component_delegate_->local_state();
+  if (local_state) {
+    const base::FilePath install_dir =
+        local_state->GetFilePath(prefs::kAdBlockInstallDir);
+    if (!install_dir.empty()) {
+      OnComponentReady(g_ad_block_component_id_, install_dir, "");
+    }
+  }
+
   return true;
 }
 
 void AdBlockService::OnComponentReady(const std::string& component_id,
                                       const base::FilePath& install_dir,
                                       const std::string& manifest) {
+  // The first component check usually lands on the version a warm start
+  // already loaded; reloading it would rebuild every engine for no change
+  if (install_dir == loaded_install_dir_) {
+    return;
+  }
+  loaded_install_dir_ = install_dir;
+
+  PrefService* local_state = component_delegate_->local_state();
+  if (local_state) {
+    local_state->SetFilePath(prefs::kAdBlockInstallDir, install_dir);
+  }
+
   // Regional service manager depends on regional catalog loading
   custom_filters_service()->Start();
 
@@ -277,6 +316,7 @@ std::unique_ptr<AdBlockService> AdBlockServiceFactory(
 
 void RegisterPrefsForAdBlockService(PrefRegistrySimple* registry) {
   registry->RegisterStringPref(prefs::kAdBlockCustomFilters, std::string());
+  registry->RegisterFilePathPref(prefs::kAdBlockInstallDir, base::FilePath());
   registry->RegisterDictionaryPref(prefs::kAdBlockRegionalFilters);
   registry->RegisterBooleanPref(prefs::kAdBlockCheckedDefaultRegion, false);
 }
@@ -44,6 +44,15 @@ const char kAdBlockComponentBase64PublicKey[] =
     "VwIDAQAB";
 
 // The brave shields service in charge of ad-block checking and init.
+//
+// The service and the engines it owns are browser-process globals reached
+// through BraveBrowserProcess, not keyed services: every profile shares one
+// engine per filter list, custom filters live in local state, and the DAT
+// backing each engine is additionally exposed as a read-only shared memory
+// region (see AdBlockBaseService::shared_dat_region) so other processes can
+// map the same physical pages. Adding a profile therefore does not add a
+// copy of engine memory; per-profile behaviour is applied at query time via
+// shields settings, not by instantiating another stack.
 class AdBlockService : public AdBlockBaseService {
  public:
   explicit AdBlockService(BraveComponent::Delegate* delegate);
@@ -56,6 +65,9 @@ class AdBlockService : public AdBlockBaseService {
                           bool* did_match_exception,
                           bool* did_match_important,
                           std::string* mock_data_url) override;
+  void ShouldStartRequestBatch(
+      const std::vector<adblock::MatchQuery>& queries,
+      std::vector<adblock::MatchResult>* results) override;
   absl::optional<std::string> GetCspDirectives(
       const GURL& url,
       blink::mojom::ResourceType resource_type,
@@ -95,6 +107,10 @@ class AdBlockService : public AdBlockBaseService {
 
   BraveComponent::Delegate* component_delegate_;
 
+  // The install directory the engines were last loaded from, either by a
+  // warm start or by a component update
+  base::FilePath loaded_install_dir_;
+
   base::WeakPtrFactory<AdBlockService> weak_factory_{this};
   DISALLOW_COPY_AND_ASSIGN(AdBlockService);
 };
@@ -12,9 +12,13 @@
 
 #include "base/values.h"
 #include "brave/components/adblock_rust_ffi/src/wrapper.h"
+#include "third_party/blink/public/mojom/loader/resource_load_info.mojom-shared.h"
 
 namespace brave_shields {
 
+// Maps a resource type to the corresponding adblock filter option string.
+std::string ResourceTypeToString(blink::mojom::ResourceType resource_type);
+
 std::vector<adblock::FilterList>::const_iterator FindAdBlockFilterListByUUID(
     const std::vector<adblock::FilterList>& region_lists,
     const std::string& uuid);
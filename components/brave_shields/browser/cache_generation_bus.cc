@@ -0,0 +1,33 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/cache_generation_bus.h"
+
+#include <stddef.h>
+
+#include <atomic>
+
+namespace brave_shields {
+
+namespace {
+
+std::atomic<uint64_t> g_generations[static_cast<size_t>(
+    CacheGenerationBus::Channel::kChannelCount)] = {};
+
+}  // namespace
+
+// static
+uint64_t CacheGenerationBus::Get(Channel channel) {
+  return g_generations[static_cast<size_t>(channel)].load(
+      std::memory_order_relaxed);
+}
+
+// static
+void CacheGenerationBus::Bump(Channel channel) {
+  g_generations[static_cast<size_t>(channel)].fetch_add(
+      1, std::memory_order_relaxed);
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,39 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_CACHE_GENERATION_BUS_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_CACHE_GENERATION_BUS_H_
+
+#include <stdint.h>
+
+namespace brave_shields {
+
+// Process-wide generation counters for invalidating derived caches without
+// locks or per-cache observer plumbing. A publisher bumps its channel when
+// the data it owns changes (an engine swap, a content settings write, a
+// ruleset reload); caches record the generation their entries were computed
+// against and compare it on read, so validation is one relaxed atomic load.
+// Bumping a channel over-invalidates by design: every cache on the channel
+// re-derives its entries, which is always safe.
+class CacheGenerationBus {
+ public:
+  enum class Channel {
+    // Any adblock engine (default, regional or custom) was swapped.
+    kAdBlockEngine = 0,
+    // A content setting changed in some profile.
+    kShieldsSettings,
+    // The HTTPSE ruleset was (re)loaded.
+    kHTTPSERules,
+
+    kChannelCount,
+  };
+
+  static uint64_t Get(Channel channel);
+  static void Bump(Channel channel);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_CACHE_GENERATION_BUS_H_
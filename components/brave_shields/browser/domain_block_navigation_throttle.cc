@@ -6,12 +6,19 @@
 #include "brave/components/brave_shields/browser/domain_block_navigation_throttle.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "base/bind.h"
+#include "base/containers/flat_map.h"
+#include "base/hash/hash.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/no_destructor.h"
 #include "base/task/post_task.h"
 #include "base/threading/thread_task_runner_handle.h"
+#include "base/time/time.h"
+#include "base/unguessable_token.h"
+#include "brave/components/brave_shields/browser/ad_block_base_service.h"
 #include "brave/components/brave_shields/browser/ad_block_custom_filters_service.h"
 #include "brave/components/brave_shields/browser/ad_block_service.h"
 #include "brave/components/brave_shields/browser/brave_shields_util.h"
@@ -32,6 +39,71 @@
 
 namespace {
 
+// The overwhelming majority of navigations hit hosts with no blocking rule,
+// so remember recently-allowed hosts and answer those on the UI thread
+// instead of bouncing every navigation start over the adblock task runner.
+// Hosts are stored as salted hashes so the cache doesn't accumulate a
+// plaintext browsing trail, and entries expire with the TTL or whenever any
+// adblock engine is swapped (list update, custom filter edit).
+class RecentlyAllowedDomains {
+ public:
+  static RecentlyAllowedDomains* GetInstance() {
+    static base::NoDestructor<RecentlyAllowedDomains> instance;
+    return instance.get();
+  }
+
+  bool Contains(const GURL& url) {
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    const uint64_t engine_generation =
+        brave_shields::AdBlockBaseService::engine_generation();
+    if (engine_generation != engine_generation_) {
+      // Filter rules changed; previous allow verdicts may no longer hold.
+      entries_.clear();
+      engine_generation_ = engine_generation;
+      return false;
+    }
+    const auto it = entries_.find(Key(url));
+    if (it == entries_.end())
+      return false;
+    if (base::TimeTicks::Now() - it->second > kEntryTTL) {
+      entries_.erase(it);
+      return false;
+    }
+    return true;
+  }
+
+  void Add(const GURL& url) {
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    if (brave_shields::AdBlockBaseService::engine_generation() !=
+        engine_generation_) {
+      return;
+    }
+    if (entries_.size() >= kMaxEntries)
+      entries_.clear();
+    entries_[Key(url)] = base::TimeTicks::Now();
+  }
+
+ private:
+  friend class base::NoDestructor<RecentlyAllowedDomains>;
+  RecentlyAllowedDomains() = default;
+
+  size_t Key(const GURL& url) const {
+    return base::FastHash(salt_ + url.host());
+  }
+
+  static constexpr base::TimeDelta kEntryTTL =
+      base::TimeDelta::FromMinutes(30);
+  static constexpr size_t kMaxEntries = 512;
+
+  // Per-session salt; hashes are meaningless across restarts.
+  const std::string salt_ = base::UnguessableToken::Create().ToString();
+  uint64_t engine_generation_ = 0;
+  base::flat_map<size_t, base::TimeTicks> entries_;
+};
+
+// static
+constexpr base::TimeDelta RecentlyAllowedDomains::kEntryTTL;
+
 bool ShouldBlockDomainOnTaskRunner(
     brave_shields::AdBlockService* ad_block_service,
     const GURL& url) {
@@ -111,6 +183,11 @@ DomainBlockNavigationThrottle::WillStartRequest() {
   if (tab_storage->IsProceeding())
     return content::NavigationThrottle::PROCEED;
 
+  // A host recently cleared by the ad block service can be answered
+  // synchronously, skipping the cross-sequence hop for the common allow case.
+  if (RecentlyAllowedDomains::GetInstance()->Contains(request_url))
+    return content::NavigationThrottle::PROCEED;
+
   // Otherwise, call the ad block service on a task runner to determine whether
   // this domain should be blocked.
   ad_block_service_->GetTaskRunner()->PostTaskAndReplyWithResult(
@@ -147,6 +224,7 @@ void DomainBlockNavigationThrottle::OnShouldBlockDomain(
   if (should_block_domain) {
     ShowInterstitial();
   } else {
+    RecentlyAllowedDomains::GetInstance()->Add(navigation_handle()->GetURL());
     // Navigation was deferred while we called the ad block service on a task
     // runner, but now we know that we want to allow navigation to continue.
     Resume();
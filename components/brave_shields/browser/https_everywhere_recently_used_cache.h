@@ -6,24 +6,37 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
 #define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
 
+#include <functional>
+#include <memory>
 #include <string>
 
 #include "base/containers/mru_cache.h"
 #include "base/synchronization/lock.h"
 
+// An MRU cache sharded by key hash so parallel request streams don't
+// serialize through a single lock. Each shard holds its own lock and MRU
+// list; eviction is per shard, so the total capacity is split evenly
+// between shards.
 template <class T> class HTTPSERecentlyUsedCache {
  public:
-  explicit HTTPSERecentlyUsedCache(size_t size = 100) : data_(size) {}
+  explicit HTTPSERecentlyUsedCache(size_t size = 100) {
+    for (size_t i = 0; i < kNumShards; i++) {
+      shards_[i] = std::make_unique<Shard>((size + kNumShards - 1) /
+                                           kNumShards);
+    }
+  }
 
   void add(const std::string& key, const T& value) {
-    base::AutoLock create(lock_);
-    data_.Put(key, value);
+    Shard* shard = ShardForKey(key);
+    base::AutoLock create(shard->lock);
+    shard->data.Put(key, value);
   }
 
   bool get(const std::string& key, T* value) {
-    base::AutoLock create(lock_);
-    auto it = data_.Get(key);
-    if (it != data_.end()) {
+    Shard* shard = ShardForKey(key);
+    base::AutoLock create(shard->lock);
+    auto it = shard->data.Get(key);
+    if (it != shard->data.end()) {
       *value = it->second;
       return true;
     }
@@ -31,15 +44,27 @@ template <class T> class HTTPSERecentlyUsedCache {
   }
 
   void remove(const std::string& key) {
-    base::AutoLock lock(lock_);
-    auto it = data_.Peek(key);
-    if (it != data_.end())
-      data_.Erase(it);
+    Shard* shard = ShardForKey(key);
+    base::AutoLock lock(shard->lock);
+    auto it = shard->data.Peek(key);
+    if (it != shard->data.end())
+      shard->data.Erase(it);
   }
 
  private:
-  base::MRUCache<std::string, T> data_;
-  base::Lock lock_;
+  static constexpr size_t kNumShards = 8;
+
+  struct Shard {
+    explicit Shard(size_t size) : data(size) {}
+    base::MRUCache<std::string, T> data;
+    base::Lock lock;
+  };
+
+  Shard* ShardForKey(const std::string& key) {
+    return shards_[std::hash<std::string>()(key) % kNumShards].get();
+  }
+
+  std::unique_ptr<Shard> shards_[kNumShards];
 };
 
 #endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_HTTPS_EVERYWHERE_RECENTLY_USED_CACHE_H_
@@ -17,8 +17,12 @@
 #include "base/macros.h"
 #include "base/memory/ptr_util.h"
 #include "base/strings/utf_string_conversions.h"
+#include "base/task/thread_pool.h"
 #include "base/threading/scoped_blocking_call.h"
+#include "base/trace_event/trace_event.h"
 #include "base/values.h"
+#include "brave/components/brave_shields/browser/cache_generation_bus.h"
+#include "brave/components/brave_shields/browser/shields_data_ready_barrier.h"
 #include "third_party/leveldatabase/src/include/leveldb/db.h"
 #include "third_party/re2/src/re2/re2.h"
 #include "third_party/zlib/google/zip.h"
@@ -65,16 +69,6 @@ std::vector<std::string> ExpandDomainForLookup(const std::string& domain) {
   }
   return resultDomains;
 }
-std::string leveldbGet(leveldb::DB* db, const std::string &key) {
-  if (!db) {
-    return "";
-  }
-
-  std::string value;
-  leveldb::Status s = db->Get(leveldb::ReadOptions(), key, &value);
-  return s.ok() ? value : "";
-}
-
 }  // namespace
 
 namespace brave_shields {
@@ -99,14 +93,11 @@ HTTPSEverywhereService::g_https_everywhere_component_base64_public_key_(
 
 HTTPSEverywhereService::HTTPSEverywhereService(
     BraveComponent::Delegate* delegate)
-    : BaseBraveShieldsService(delegate),
-      level_db_(nullptr) {
+    : BaseBraveShieldsService(delegate) {
   DETACH_FROM_SEQUENCE(sequence_checker_);
 }
 
-HTTPSEverywhereService::~HTTPSEverywhereService() {
-  GetTaskRunner()->DeleteSoon(FROM_HERE, level_db_);
-}
+HTTPSEverywhereService::~HTTPSEverywhereService() = default;
 
 bool HTTPSEverywhereService::Init() {
   Register(kHTTPSEverywhereComponentName,
@@ -115,41 +106,83 @@ bool HTTPSEverywhereService::Init() {
   return true;
 }
 
-void HTTPSEverywhereService::InitDB(const base::FilePath& install_dir) {
-  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+// static
+base::flat_map<std::string, std::string>
+HTTPSEverywhereService::LoadRulesOnThreadPool(
+    const base::FilePath& install_dir) {
+  base::flat_map<std::string, std::string> rules;
   base::FilePath zip_db_file_path =
       install_dir.AppendASCII(DAT_FILE_VERSION).AppendASCII(DAT_FILE);
-  base::FilePath unzipped_level_db_path = zip_db_file_path.RemoveExtension();
   base::FilePath destination = zip_db_file_path.DirName();
   if (!zip::Unzip(zip_db_file_path, destination)) {
     LOG(ERROR) << "Failed to unzip database file "
                << zip_db_file_path.value().c_str();
-    return;
+    return rules;
   }
 
-  CloseDatabase();
-
+  base::FilePath unzipped_level_db_path = zip_db_file_path.RemoveExtension();
+  leveldb::DB* level_db = nullptr;
   leveldb::Options options;
-  leveldb::Status status =
-      leveldb::DB::Open(options,
-                        unzipped_level_db_path.AsUTF8Unsafe(),
-                        &level_db_);
-  if (!status.ok() || !level_db_) {
+  leveldb::Status status = leveldb::DB::Open(
+      options, unzipped_level_db_path.AsUTF8Unsafe(), &level_db);
+  if (!status.ok() || !level_db) {
     LOG(ERROR) << "Level db open error "
                << unzipped_level_db_path.value().c_str()
                << ", error: " << status.ToString();
-    CloseDatabase();
-    return;
+    return rules;
+  }
+
+  // Hydrate the whole ruleset into a flat map so per-request lookups are
+  // pure memory reads with no leveldb locking or disk seeks. The database
+  // iterates in sorted key order, so the map can adopt the entries without
+  // re-sorting.
+  std::vector<std::pair<std::string, std::string>> entries;
+  std::unique_ptr<leveldb::Iterator> it(
+      level_db->NewIterator(leveldb::ReadOptions()));
+  for (it->SeekToFirst(); it->Valid(); it->Next()) {
+    entries.emplace_back(it->key().ToString(), it->value().ToString());
   }
+  it.reset();
+  delete level_db;
+
+  rules = base::flat_map<std::string, std::string>(base::sorted_unique,
+                                                   std::move(entries));
+  return rules;
 }
 
 void HTTPSEverywhereService::OnComponentReady(
     const std::string& component_id,
     const base::FilePath& install_dir,
     const std::string& manifest) {
-  GetTaskRunner()->PostTask(
-      FROM_HERE, base::BindOnce(&HTTPSEverywhereService::InitDB, AsWeakPtr(),
-                                install_dir));
+  // The unzip and leveldb scan are the expensive part of ruleset
+  // initialization; run them on the thread pool so they proceed in parallel
+  // with adblock DAT deserialization instead of queueing behind it on the
+  // shared component sequence. Only the final map swap happens on the task
+  // runner that serves lookups.
+  ShieldsDataReadyBarrier::GetInstance()->RegisterPendingSource();
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::MayBlock()},
+      base::BindOnce(&HTTPSEverywhereService::LoadRulesOnThreadPool,
+                     install_dir),
+      base::BindOnce(&HTTPSEverywhereService::OnRulesLoaded, AsWeakPtr()));
+}
+
+void HTTPSEverywhereService::OnRulesLoaded(
+    base::flat_map<std::string, std::string> rules) {
+  GetTaskRunner()->PostTaskAndReply(
+      FROM_HERE,
+      base::BindOnce(&HTTPSEverywhereService::InitRules, AsWeakPtr(),
+                     std::move(rules)),
+      base::BindOnce(&ShieldsDataReadyBarrier::SignalSourceReady,
+                     base::Unretained(ShieldsDataReadyBarrier::GetInstance())));
+}
+
+void HTTPSEverywhereService::InitRules(
+    base::flat_map<std::string, std::string> rules) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  httpse_rules_ = std::move(rules);
+  // Rewrites cached against the previous ruleset read as misses from now on.
+  CacheGenerationBus::Bump(CacheGenerationBus::Channel::kHTTPSERules);
 }
 
 bool HTTPSEverywhereService::GetHTTPSURL(
@@ -157,23 +190,41 @@ bool HTTPSEverywhereService::GetHTTPSURL(
     const uint64_t& request_identifier,
     std::string* new_url) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  TRACE_EVENT1("brave.shields", "HTTPSEverywhereService::GetHTTPSURL", "url",
+               url->possibly_invalid_spec());
 
   if (!url->is_valid())
     return false;
 
-  if (!IsInitialized() || !level_db_ || url->scheme() == url::kHttpsScheme) {
+  if (!IsInitialized() || httpse_rules_.empty() ||
+      url->scheme() == url::kHttpsScheme) {
     return false;
   }
   if (!ShouldHTTPSERedirect(request_identifier)) {
     return false;
   }
 
-  if (recently_used_cache_.get(url->spec(), new_url)) {
+  HTTPSECachedRewrite cached;
+  if (recently_used_cache_.get(url->spec(), &cached) &&
+      cached.rules_generation ==
+          CacheGenerationBus::Get(CacheGenerationBus::Channel::kHTTPSERules)) {
+    *new_url = cached.url;
+    TRACE_EVENT_INSTANT1("brave.shields", "HTTPSERewrite",
+                         TRACE_EVENT_SCOPE_THREAD, "new_url", *new_url);
+    AddHTTPSEUrlToRedirectList(request_identifier);
+    return true;
+  }
+
+  if (FindAndCacheRewrite(*url, new_url)) {
     AddHTTPSEUrlToRedirectList(request_identifier);
     return true;
   }
+  return false;
+}
 
-  GURL candidate_url(*url);
+bool HTTPSEverywhereService::FindAndCacheRewrite(const GURL& url,
+                                                 std::string* new_url) {
+  GURL candidate_url(url);
   if (g_ignore_port_for_test_ && candidate_url.has_port()) {
     GURL::Replacements replacements;
     replacements.ClearPort();
@@ -182,13 +233,18 @@ bool HTTPSEverywhereService::GetHTTPSURL(
 
   const std::vector<std::string> domains =
       ExpandDomainForLookup(candidate_url.host());
-  for (auto domain : domains) {
-    std::string value = leveldbGet(level_db_, domain);
-    if (!value.empty()) {
-      *new_url = ApplyHTTPSRule(candidate_url.spec(), value);
+  for (const auto& domain : domains) {
+    const auto it = httpse_rules_.find(domain);
+    if (it != httpse_rules_.end() && !it->second.empty()) {
+      *new_url = ApplyHTTPSRule(candidate_url.spec(), it->second);
       if (0 != new_url->length()) {
-        recently_used_cache_.add(candidate_url.spec(), *new_url);
-        AddHTTPSEUrlToRedirectList(request_identifier);
+        TRACE_EVENT_INSTANT1("brave.shields", "HTTPSERewrite",
+                             TRACE_EVENT_SCOPE_THREAD, "new_url", *new_url);
+        HTTPSECachedRewrite entry;
+        entry.url = *new_url;
+        entry.rules_generation = CacheGenerationBus::Get(
+            CacheGenerationBus::Channel::kHTTPSERules);
+        recently_used_cache_.add(candidate_url.spec(), entry);
         return true;
       }
     }
@@ -197,10 +253,32 @@ bool HTTPSEverywhereService::GetHTTPSURL(
   return false;
 }
 
+void HTTPSEverywhereService::PrewarmHTTPSURL(const GURL& url) {
+  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
+  TRACE_EVENT1("brave.shields", "HTTPSEverywhereService::PrewarmHTTPSURL",
+               "url", url.possibly_invalid_spec());
+
+  if (!url.is_valid() || !IsInitialized() || httpse_rules_.empty() ||
+      url.scheme() == url::kHttpsScheme) {
+    return;
+  }
+
+  HTTPSECachedRewrite cached;
+  if (!recently_used_cache_.get(url.spec(), &cached) ||
+      cached.rules_generation !=
+          CacheGenerationBus::Get(CacheGenerationBus::Channel::kHTTPSERules)) {
+    std::string unused;
+    FindAndCacheRewrite(url, &unused);
+  }
+}
+
 bool HTTPSEverywhereService::GetHTTPSURLFromCacheOnly(
     const GURL* url,
     const uint64_t& request_identifier,
     std::string* cached_url) {
+  TRACE_EVENT1("brave.shields",
+               "HTTPSEverywhereService::GetHTTPSURLFromCacheOnly", "url",
+               url->possibly_invalid_spec());
   if (!url->is_valid())
     return false;
 
@@ -211,7 +289,11 @@ bool HTTPSEverywhereService::GetHTTPSURLFromCacheOnly(
     return false;
   }
 
-  if (recently_used_cache_.get(url->spec(), cached_url)) {
+  HTTPSECachedRewrite cached;
+  if (recently_used_cache_.get(url->spec(), &cached) &&
+      cached.rules_generation ==
+          CacheGenerationBus::Get(CacheGenerationBus::Channel::kHTTPSERules)) {
+    *cached_url = cached.url;
     AddHTTPSEUrlToRedirectList(request_identifier);
     return true;
   }
@@ -372,14 +454,6 @@ std::string HTTPSEverywhereService::CorrecttoRuleToRE2Engine(
   return correctedto;
 }
 
-void HTTPSEverywhereService::CloseDatabase() {
-  DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-  if (level_db_) {
-    delete level_db_;
-    level_db_ = nullptr;
-  }
-}
-
 // static
 void HTTPSEverywhereService::SetComponentIdAndBase64PublicKeyForTest(
     const std::string& component_id,
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/files/file_path.h"
 #include "base/memory/weak_ptr.h"
 #include "base/sequence_checker.h"
@@ -17,10 +18,6 @@
 #include "brave/components/brave_shields/browser/base_brave_shields_service.h"
 #include "brave/components/brave_shields/browser/https_everywhere_recently_used_cache.h"
 
-namespace leveldb {
-class DB;
-}
-
 class HTTPSEverywhereServiceTest;
 
 using brave_component_updater::BraveComponent;
@@ -31,6 +28,14 @@ extern const char kHTTPSEverywhereComponentName[];
 extern const char kHTTPSEverywhereComponentId[];
 extern const char kHTTPSEverywhereComponentBase64PublicKey[];
 
+// A cached rewrite tagged with the HTTPSE ruleset generation it was computed
+// against (the kHTTPSERules channel of CacheGenerationBus); entries from a
+// previous ruleset read as misses.
+struct HTTPSECachedRewrite {
+  std::string url;
+  uint64_t rules_generation = 0;
+};
+
 struct HTTPSE_REDIRECTS_COUNT_ST {
  public:
   HTTPSE_REDIRECTS_COUNT_ST(uint64_t request_identifier,
@@ -55,6 +60,13 @@ class HTTPSEverywhereService : public BaseBraveShieldsService,
                                 const uint64_t& request_id,
                                 std::string* cached_url);
 
+  // Looks |url| up against the ruleset so the verdict is sitting in the
+  // recently used cache before a request for it reaches the network stack,
+  // where GetHTTPSURLFromCacheOnly can then answer on the UI thread without
+  // a hop to this service's task runner. Unlike GetHTTPSURL this does not
+  // touch the per-request redirect bookkeeping, as no request exists yet.
+  void PrewarmHTTPSURL(const GURL& url);
+
  protected:
   bool Init() override;
   void OnComponentReady(const std::string& component_id,
@@ -67,6 +79,11 @@ class HTTPSEverywhereService : public BaseBraveShieldsService,
       const std::string& rule);
   std::string CorrecttoRuleToRE2Engine(const std::string& to);
 
+  // Scans the ruleset for a rewrite of |url| and updates the recently used
+  // cache with the result. Returns true and sets |new_url| when a rule
+  // produced a rewrite.
+  bool FindAndCacheRewrite(const GURL& url, std::string* new_url);
+
  private:
   friend class ::HTTPSEverywhereServiceTest;
   static bool g_ignore_port_for_test_;
@@ -77,14 +94,15 @@ class HTTPSEverywhereService : public BaseBraveShieldsService,
       const std::string& component_id,
       const std::string& component_base64_public_key);
 
-  void CloseDatabase();
-
-  void InitDB(const base::FilePath& install_dir);
+  static base::flat_map<std::string, std::string> LoadRulesOnThreadPool(
+      const base::FilePath& install_dir);
+  void OnRulesLoaded(base::flat_map<std::string, std::string> rules);
+  void InitRules(base::flat_map<std::string, std::string> rules);
 
   base::Lock httpse_get_urls_redirects_count_mutex_;
   std::vector<HTTPSE_REDIRECTS_COUNT_ST> httpse_urls_redirects_count_;
-  HTTPSERecentlyUsedCache<std::string> recently_used_cache_;
-  leveldb::DB* level_db_;
+  HTTPSERecentlyUsedCache<HTTPSECachedRewrite> recently_used_cache_;
+  base::flat_map<std::string, std::string> httpse_rules_;
 
   SEQUENCE_CHECKER(sequence_checker_);
   DISALLOW_COPY_AND_ASSIGN(HTTPSEverywhereService);
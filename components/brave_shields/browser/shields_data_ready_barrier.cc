@@ -0,0 +1,58 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/shields_data_ready_barrier.h"
+
+#include <utility>
+
+#include "content/public/browser/browser_thread.h"
+
+namespace brave_shields {
+
+// static
+ShieldsDataReadyBarrier* ShieldsDataReadyBarrier::GetInstance() {
+  static base::NoDestructor<ShieldsDataReadyBarrier> instance;
+  return instance.get();
+}
+
+ShieldsDataReadyBarrier::ShieldsDataReadyBarrier() = default;
+ShieldsDataReadyBarrier::~ShieldsDataReadyBarrier() = default;
+
+void ShieldsDataReadyBarrier::RegisterPendingSource() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (signalled_)
+    return;
+  any_source_registered_ = true;
+  pending_sources_++;
+}
+
+void ShieldsDataReadyBarrier::SignalSourceReady() {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (signalled_)
+    return;
+  DCHECK_GT(pending_sources_, 0);
+  pending_sources_--;
+  MaybeSignal();
+}
+
+void ShieldsDataReadyBarrier::RunWhenReady(base::OnceClosure callback) {
+  DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+  if (signalled_) {
+    std::move(callback).Run();
+    return;
+  }
+  callbacks_.push_back(std::move(callback));
+}
+
+void ShieldsDataReadyBarrier::MaybeSignal() {
+  if (!any_source_registered_ || pending_sources_ > 0)
+    return;
+  signalled_ = true;
+  std::vector<base::OnceClosure> callbacks = std::move(callbacks_);
+  for (auto& callback : callbacks)
+    std::move(callback).Run();
+}
+
+}  // namespace brave_shields
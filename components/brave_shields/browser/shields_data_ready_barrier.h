@@ -0,0 +1,54 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_DATA_READY_BARRIER_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_DATA_READY_BARRIER_H_
+
+#include <vector>
+
+#include "base/callback.h"
+#include "base/no_destructor.h"
+
+namespace brave_shields {
+
+// Coordinates a single "shields are effective" signal across the
+// independently loaded shields data sources (the adblock engines and the
+// HTTPS Everywhere ruleset), which deserialize concurrently on the thread
+// pool. Each source registers before it starts loading and signals once its
+// data is queryable; callbacks queued with RunWhenReady run after every
+// registered source has signalled. Until then, request checks fall through
+// to the empty engines, exactly as before.
+//
+// All methods must be called on the UI thread. Once the barrier has fired,
+// later registrations and signals (e.g. from component updates) are no-ops
+// and queued callbacks run immediately.
+class ShieldsDataReadyBarrier {
+ public:
+  static ShieldsDataReadyBarrier* GetInstance();
+
+  ShieldsDataReadyBarrier(const ShieldsDataReadyBarrier&) = delete;
+  ShieldsDataReadyBarrier& operator=(const ShieldsDataReadyBarrier&) = delete;
+
+  void RegisterPendingSource();
+  void SignalSourceReady();
+  void RunWhenReady(base::OnceClosure callback);
+  bool is_ready() const { return signalled_; }
+
+ private:
+  friend class base::NoDestructor<ShieldsDataReadyBarrier>;
+  ShieldsDataReadyBarrier();
+  ~ShieldsDataReadyBarrier();
+
+  void MaybeSignal();
+
+  int pending_sources_ = 0;
+  bool any_source_registered_ = false;
+  bool signalled_ = false;
+  std::vector<base::OnceClosure> callbacks_;
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_SHIELDS_DATA_READY_BARRIER_H_
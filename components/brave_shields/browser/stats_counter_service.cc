@@ -0,0 +1,67 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "brave/components/brave_shields/browser/stats_counter_service.h"
+
+#include "base/bind.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "brave/common/pref_names.h"
+#include "brave/components/brave_shields/common/brave_shield_constants.h"
+#include "components/prefs/pref_service.h"
+
+namespace brave_shields {
+
+StatsCounterService::StatsCounterService(PrefService* prefs)
+    : prefs_(prefs), weak_factory_(this) {}
+
+StatsCounterService::~StatsCounterService() = default;
+
+void StatsCounterService::RecordBlockedEvent(const std::string& block_type) {
+  if (block_type == kAds) {
+    AddPendingCount(&pending_ads_blocked_);
+  } else if (block_type == kHTTPUpgradableResources) {
+    AddPendingCount(&pending_https_upgrades_);
+  } else if (block_type == kJavaScript) {
+    AddPendingCount(&pending_javascript_blocked_);
+  } else if (block_type == kFingerprintingV2) {
+    AddPendingCount(&pending_fingerprinting_blocked_);
+  }
+}
+
+void StatsCounterService::Shutdown() {
+  FlushPendingCounts();
+  weak_factory_.InvalidateWeakPtrs();
+}
+
+void StatsCounterService::AddPendingCount(uint64_t* pending_count) {
+  (*pending_count)++;
+  if (flush_scheduled_)
+    return;
+  flush_scheduled_ = true;
+  // Blocked events arrive as individual UI thread tasks, so a flush task
+  // queued behind the ones already pending turns a burst of events into a
+  // single write per counter.
+  base::SequencedTaskRunnerHandle::Get()->PostTask(
+      FROM_HERE, base::BindOnce(&StatsCounterService::FlushPendingCounts,
+                                weak_factory_.GetWeakPtr()));
+}
+
+void StatsCounterService::FlushCount(const char* pref_name,
+                                     uint64_t* pending_count) {
+  if (!*pending_count)
+    return;
+  prefs_->SetUint64(pref_name, prefs_->GetUint64(pref_name) + *pending_count);
+  *pending_count = 0;
+}
+
+void StatsCounterService::FlushPendingCounts() {
+  flush_scheduled_ = false;
+  FlushCount(kAdsBlocked, &pending_ads_blocked_);
+  FlushCount(kHttpsUpgrades, &pending_https_upgrades_);
+  FlushCount(kJavascriptBlocked, &pending_javascript_blocked_);
+  FlushCount(kFingerprintingBlocked, &pending_fingerprinting_blocked_);
+}
+
+}  // namespace brave_shields
@@ -0,0 +1,54 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_STATS_COUNTER_SERVICE_H_
+#define BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_STATS_COUNTER_SERVICE_H_
+
+#include <string>
+
+#include "base/macros.h"
+#include "base/memory/weak_ptr.h"
+#include "components/keyed_service/core/keyed_service.h"
+
+class PrefService;
+
+namespace brave_shields {
+
+// Aggregates blocked resource counts in memory and flushes them to the
+// profile prefs in batches. Updating the prefs for every blocked request
+// schedules a pref serialization and notifies pref observers dozens of
+// times per second on ad-heavy pages.
+class StatsCounterService : public KeyedService {
+ public:
+  explicit StatsCounterService(PrefService* prefs);
+  ~StatsCounterService() override;
+
+  // |block_type| is one of the resource types from brave_shield_constants.h.
+  void RecordBlockedEvent(const std::string& block_type);
+
+ private:
+  // KeyedService overrides:
+  void Shutdown() override;
+
+  void AddPendingCount(uint64_t* pending_count);
+  void FlushCount(const char* pref_name, uint64_t* pending_count);
+  void FlushPendingCounts();
+
+  PrefService* prefs_;  // not owned
+  // Counts recorded since the last flush. Blocked events are dispatched on
+  // the UI thread only, so plain counters suffice.
+  uint64_t pending_ads_blocked_ = 0;
+  uint64_t pending_https_upgrades_ = 0;
+  uint64_t pending_javascript_blocked_ = 0;
+  uint64_t pending_fingerprinting_blocked_ = 0;
+  bool flush_scheduled_ = false;
+  base::WeakPtrFactory<StatsCounterService> weak_factory_;
+
+  DISALLOW_COPY_AND_ASSIGN(StatsCounterService);
+};
+
+}  // namespace brave_shields
+
+#endif  // BRAVE_COMPONENTS_BRAVE_SHIELDS_BROWSER_STATS_COUNTER_SERVICE_H_
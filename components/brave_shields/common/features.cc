@@ -26,6 +26,20 @@ const base::Feature kBraveAdblockCosmeticFilteringNative{
     "BraveAdblockCosmeticFilteringNative", base::FEATURE_DISABLED_BY_DEFAULT};
 const base::Feature kBraveAdblockCspRules{
     "BraveAdblockCspRules", base::FEATURE_ENABLED_BY_DEFAULT};
+// When enabled, a filter list update delivered through the component
+// updater is benchmarked against a canned URL corpus before it replaces
+// the running engine, and is rejected (keeping the previous engine) when
+// its match latency exceeds the admission budget. Protects against
+// upstream list mistakes that would regress every request.
+const base::Feature kBraveAdblockListQuarantine{
+    "BraveAdblockListQuarantine", base::FEATURE_DISABLED_BY_DEFAULT};
+// When enabled, enabled regional filter lists that match nothing over a long
+// window of classified requests release their compiled engine and fall back
+// to the retained DAT, trading coverage of rarely-hit lists for memory on
+// low-memory devices. The list for the current locale is always kept
+// compiled.
+const base::Feature kBraveAdblockRegionalListTiering{
+    "BraveAdblockRegionalListTiering", base::FEATURE_DISABLED_BY_DEFAULT};
 // When enabled, Brave will block domains listed in the user's selected adblock
 // filters and present a security interstitial with choice to proceed and
 // optionally whitelist the domain.
@@ -17,6 +17,8 @@ extern const base::Feature kBraveAdblockCollapseBlockedElements;
 extern const base::Feature kBraveAdblockCosmeticFiltering;
 extern const base::Feature kBraveAdblockCosmeticFilteringNative;
 extern const base::Feature kBraveAdblockCspRules;
+extern const base::Feature kBraveAdblockListQuarantine;
+extern const base::Feature kBraveAdblockRegionalListTiering;
 extern const base::Feature kBraveDomainBlock;
 extern const base::Feature kBraveExtensionNetworkBlocking;
 }  // namespace features
@@ -11,6 +11,7 @@ namespace prefs {
 const char kAdBlockCheckedDefaultRegion[] =
     "brave.ad_block.checked_default_region";
 const char kAdBlockCustomFilters[] = "brave.ad_block.custom_filters";
+const char kAdBlockInstallDir[] = "brave.ad_block.install_dir";
 const char kAdBlockRegionalFilters[] = "brave.ad_block.regional_filters";
 const char kFBEmbedControlType[] = "brave.fb_embed_default";
 const char kTwitterEmbedControlType[] = "brave.twitter_embed_default";
@@ -11,6 +11,7 @@ namespace prefs {
 
 extern const char kAdBlockCheckedDefaultRegion[];
 extern const char kAdBlockCustomFilters[];
+extern const char kAdBlockInstallDir[];
 extern const char kAdBlockRegionalFilters[];
 extern const char kFBEmbedControlType[];
 extern const char kTwitterEmbedControlType[];
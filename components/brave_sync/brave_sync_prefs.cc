@@ -104,6 +104,8 @@ std::string Prefs::GetSeedPath() {
 
 std::string Prefs::GetSeed() const {
   const std::string encoded_seed = pref_service_->GetString(kSyncV2Seed);
+  if (!cached_encoded_seed_.empty() && encoded_seed == cached_encoded_seed_)
+    return cached_seed_;
   std::string encrypted_seed;
   if (!base::Base64Decode(encoded_seed, &encrypted_seed)) {
     LOG(ERROR) << "base64 decode sync seed failure";
@@ -114,11 +116,18 @@ std::string Prefs::GetSeed() const {
     LOG(ERROR) << "Decrypt sync seed failure";
     return std::string();
   }
+  cached_encoded_seed_ = encoded_seed;
+  cached_seed_ = seed;
   return seed;
 }
 
 bool Prefs::SetSeed(const std::string& seed) {
   DCHECK(!seed.empty());
+  // OSCrypt may produce a different ciphertext for the same plaintext, so
+  // compare decoded values; re-setting the current seed must not dirty the
+  // pref store.
+  if (!pref_service_->GetString(kSyncV2Seed).empty() && seed == GetSeed())
+    return true;
   std::string encrypted_seed;
   if (!OSCrypt::EncryptString(seed, &encrypted_seed)) {
     LOG(ERROR) << "Encrypt sync seed failure";
@@ -128,6 +137,8 @@ bool Prefs::SetSeed(const std::string& seed) {
   std::string encoded_seed;
   base::Base64Encode(encrypted_seed, &encoded_seed);
   pref_service_->SetString(kSyncV2Seed, encoded_seed);
+  cached_encoded_seed_ = encoded_seed;
+  cached_seed_ = seed;
   return true;
 }
 
@@ -167,6 +178,8 @@ void Prefs::SetDismissSyncMigrateNotice(bool is_dismissed) {
 
 void Prefs::Clear() {
   pref_service_->ClearPref(kSyncV2Seed);
+  cached_encoded_seed_.clear();
+  cached_seed_.clear();
 }
 
 void MigrateBraveSyncPrefs(PrefService* prefs) {
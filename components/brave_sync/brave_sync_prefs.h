@@ -31,7 +31,14 @@ class Prefs {
 
   static std::string GetSeedPath();
 
+  // Returns the decoded seed. The decoded value is cached against the
+  // encoded pref contents, so repeated calls (key derivation on every pref
+  // change notification, sync code queries) skip the base64 + OSCrypt round
+  // trip; the cache refreshes itself whenever the pref changes underneath.
   std::string GetSeed() const;
+  // Persists |seed| encrypted. Writing the current seed again is a no-op so
+  // repeated sets do not churn the profile prefs file with a fresh
+  // ciphertext for the same plaintext.
   bool SetSeed(const std::string& seed);
 
   bool IsSyncV1Migrated() const;
@@ -56,6 +63,12 @@ class Prefs {
  private:
   PrefService* const pref_service_;
 
+  // In-memory canonical copy of the seed, valid while the stored pref still
+  // equals |cached_encoded_seed_|. Mutable: refreshed from the const read
+  // path.
+  mutable std::string cached_encoded_seed_;
+  mutable std::string cached_seed_;
+
   DISALLOW_COPY_AND_ASSIGN(Prefs);
 };
 
@@ -8,7 +8,7 @@
 #include "base/logging.h"
 #include "base/notreached.h"
 #include "base/strings/utf_string_conversions.h"
-#include "base/task/post_task.h"
+#include "base/task/task_traits.h"
 #include "base/task/thread_pool.h"
 #include "brave/components/brave_vpn/utils_win.h"
 
@@ -24,26 +24,52 @@ using brave_vpn::internal::RemoveEntry;
 
 namespace brave_vpn {
 
+namespace {
+
+// The RAS helpers take raw string pointers, so bound strings are kept alive
+// in these wrappers until the task actually runs
+bool CreateEntryTask(const std::wstring& name,
+                     const std::wstring& host,
+                     const std::wstring& user,
+                     const std::wstring& password) {
+  return CreateEntry(name.c_str(), host.c_str(), user.c_str(),
+                     password.c_str());
+}
+
+bool ConnectEntryTask(const std::wstring& name) {
+  return ConnectEntry(name.c_str());
+}
+
+bool DisconnectEntryTask(const std::wstring& name) {
+  return DisconnectEntry(name.c_str());
+}
+
+bool RemoveEntryTask(const std::wstring& name) {
+  return RemoveEntry(name.c_str());
+}
+
+}  // namespace
+
 // static
 BraveVPNConnectionManager* BraveVPNConnectionManager::GetInstance() {
   static base::NoDestructor<BraveVPNConnectionManagerWin> s_manager;
   return s_manager.get();
 }
 
-BraveVPNConnectionManagerWin::BraveVPNConnectionManagerWin() = default;
+BraveVPNConnectionManagerWin::BraveVPNConnectionManagerWin()
+    : ras_task_runner_(base::ThreadPool::CreateSequencedTaskRunner(
+          {base::MayBlock(), base::TaskPriority::USER_BLOCKING})) {}
+
 BraveVPNConnectionManagerWin::~BraveVPNConnectionManagerWin() = default;
 
 void BraveVPNConnectionManagerWin::CreateVPNConnection(
     const BraveVPNConnectionInfo& info) {
-  const std::wstring name = base::UTF8ToWide(info.connection_name);
-  const std::wstring host = base::UTF8ToWide(info.hostname);
-  const std::wstring user = base::UTF8ToWide(info.username);
-  const std::wstring password = base::UTF8ToWide(info.password);
-
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&CreateEntry, name.c_str(), host.c_str(), user.c_str(),
-                     password.c_str()),
+  ras_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE,
+      base::BindOnce(&CreateEntryTask, base::UTF8ToWide(info.connection_name),
+                     base::UTF8ToWide(info.hostname),
+                     base::UTF8ToWide(info.username),
+                     base::UTF8ToWide(info.password)),
       base::BindOnce(&BraveVPNConnectionManagerWin::OnCreated,
                      weak_factory_.GetWeakPtr(), info.connection_name));
 }
@@ -54,32 +80,25 @@ void BraveVPNConnectionManagerWin::UpdateVPNConnection(
 }
 
 void BraveVPNConnectionManagerWin::Connect(const std::string& name) {
-  const std::wstring w_name = base::UTF8ToWide(name);
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&ConnectEntry, w_name.c_str()),
+  ras_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&ConnectEntryTask, base::UTF8ToWide(name)),
       base::BindOnce(&BraveVPNConnectionManagerWin::OnConnected,
                      weak_factory_.GetWeakPtr(), name));
 }
 
 void BraveVPNConnectionManagerWin::Disconnect(const std::string& name) {
-  const std::wstring w_name = base::UTF8ToWide(name);
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&DisconnectEntry, w_name.c_str()),
+  ras_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&DisconnectEntryTask, base::UTF8ToWide(name)),
       base::BindOnce(&BraveVPNConnectionManagerWin::OnDisconnected,
                      weak_factory_.GetWeakPtr(), name));
 }
 
 void BraveVPNConnectionManagerWin::RemoveVPNConnection(
     const std::string& name) {
-  const std::wstring w_name = base::UTF8ToWide(name);
-  base::ThreadPool::PostTaskAndReplyWithResult(
-      FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&RemoveEntry, w_name.c_str()),
+  ras_task_runner_->PostTaskAndReplyWithResult(
+      FROM_HERE, base::BindOnce(&RemoveEntryTask, base::UTF8ToWide(name)),
       base::BindOnce(&BraveVPNConnectionManagerWin::OnRemoved,
                      weak_factory_.GetWeakPtr(), name));
-  RemoveEntry(w_name.c_str());
 }
 
 void BraveVPNConnectionManagerWin::OnCreated(const std::string& name,
@@ -10,6 +10,7 @@
 
 #include "base/memory/weak_ptr.h"
 #include "base/no_destructor.h"
+#include "base/sequenced_task_runner.h"
 #include "brave/components/brave_vpn/brave_vpn_connection_manager.h"
 
 namespace brave_vpn {
@@ -39,6 +40,10 @@ class BraveVPNConnectionManagerWin : public BraveVPNConnectionManager {
   void OnDisconnected(const std::string& name, bool success);
   void OnRemoved(const std::string& name, bool success);
 
+  // RAS entry operations share the phonebook file, so they run in order on
+  // one sequence instead of racing each other in the thread pool
+  scoped_refptr<base::SequencedTaskRunner> ras_task_runner_;
+
   base::WeakPtrFactory<BraveVPNConnectionManagerWin> weak_factory_{this};
 };
 
@@ -16,6 +16,11 @@
 
 namespace {
 
+// Spot prices barely move within a refresh interval, while several UI
+// surfaces ask for the same assets at once; serve repeats from cache for
+// this long.
+constexpr base::TimeDelta kPriceCacheTTL = base::TimeDelta::FromMinutes(1);
+
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("asset_ratio_controller", R"(
       semantics {
@@ -103,29 +108,44 @@ GURL AssetRatioController::GetPriceHistoryURL(
 
 void AssetRatioController::GetPrice(const std::string& asset,
                                     GetPriceCallback callback) {
+  auto cached = price_cache_.find(asset);
+  if (cached != price_cache_.end() &&
+      base::Time::Now() - cached->second.first < kPriceCacheTTL) {
+    std::move(callback).Run(true, cached->second.second);
+    return;
+  }
+  // If a fetch for this asset is already on the wire, wait for it instead
+  // of firing an identical request.
+  auto pending = pending_price_requests_.find(asset);
+  if (pending != pending_price_requests_.end()) {
+    pending->second.push_back(std::move(callback));
+    return;
+  }
+  pending_price_requests_[asset].push_back(std::move(callback));
   auto internal_callback =
       base::BindOnce(&AssetRatioController::OnGetPrice,
-                     weak_ptr_factory_.GetWeakPtr(), std::move(callback));
+                     weak_ptr_factory_.GetWeakPtr(), asset);
   api_request_helper_.Request("GET", GetPriceURL(asset), "", "", true,
                               std::move(internal_callback));
 }
 
 void AssetRatioController::OnGetPrice(
-    GetPriceCallback callback,
+    const std::string& asset,
     const int status,
     const std::string& body,
     const std::map<std::string, std::string>& headers) {
-  if (status < 200 || status > 299) {
-    std::move(callback).Run(false, "");
-    return;
-  }
   std::string price;
-  if (!ParseAssetPrice(body, &price)) {
-    std::move(callback).Run(false, "");
-    return;
-  }
-
-  std::move(callback).Run(true, price);
+  bool success = status >= 200 && status <= 299;
+  if (success)
+    success = ParseAssetPrice(body, &price);
+  if (success)
+    price_cache_[asset] = std::make_pair(base::Time::Now(), price);
+
+  std::vector<GetPriceCallback> callbacks =
+      std::move(pending_price_requests_[asset]);
+  pending_price_requests_.erase(asset);
+  for (auto& callback : callbacks)
+    std::move(callback).Run(success, price);
 }
 
 void AssetRatioController::GetPriceHistory(
@@ -8,9 +8,11 @@
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/callback.h"
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
 #include "base/time/time.h"
 #include "brave/components/api_request_helper/api_request_helper.h"
@@ -32,6 +34,8 @@ class AssetRatioController {
 
   using GetPriceCallback =
       base::OnceCallback<void(bool status, const std::string& price)>;
+  // Prices are served from a short-lived cache when possible, and
+  // concurrent requests for the same asset share one network fetch.
   void GetPrice(const std::string& asset, GetPriceCallback callback);
 
   using GetPriceHistoryCallback = base::OnceCallback<void(
@@ -48,7 +52,7 @@ class AssetRatioController {
   static void SetBaseURLForTest(const GURL& base_url_for_test);
 
  private:
-  void OnGetPrice(GetPriceCallback callback,
+  void OnGetPrice(const std::string& asset,
                   const int status,
                   const std::string& body,
                   const std::map<std::string, std::string>& headers);
@@ -58,6 +62,11 @@ class AssetRatioController {
                          const std::map<std::string, std::string>& headers);
 
   static GURL base_url_for_test_;
+  // (asset, (fetch time, price))
+  base::flat_map<std::string, std::pair<base::Time, std::string>> price_cache_;
+  // (asset, callbacks waiting on the in-flight fetch for that asset)
+  base::flat_map<std::string, std::vector<GetPriceCallback>>
+      pending_price_requests_;
   api_request_helper::APIRequestHelper api_request_helper_;
   base::WeakPtrFactory<AssetRatioController> weak_ptr_factory_;
 };
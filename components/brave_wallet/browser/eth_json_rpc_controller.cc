@@ -226,6 +226,34 @@ void EthJsonRpcController::OnGetTransactionReceipt(
   std::move(callback).Run(true, receipt);
 }
 
+void EthJsonRpcController::GetTransactionReceipts(
+    const std::vector<std::string>& tx_hashes,
+    GetTxReceiptsCallback callback) {
+  auto internal_callback =
+      base::BindOnce(&EthJsonRpcController::OnGetTransactionReceipts,
+                     weak_ptr_factory_.GetWeakPtr(), std::move(callback));
+  return Request(eth_getTransactionReceipts(tx_hashes),
+                 std::move(internal_callback), true);
+}
+
+void EthJsonRpcController::OnGetTransactionReceipts(
+    GetTxReceiptsCallback callback,
+    const int status,
+    const std::string& body,
+    const std::map<std::string, std::string>& headers) {
+  std::map<int, TransactionReceipt> receipts;
+  if (status < 200 || status > 299) {
+    std::move(callback).Run(false, receipts);
+    return;
+  }
+  if (!ParseEthGetTransactionReceipts(body, &receipts)) {
+    std::move(callback).Run(false, receipts);
+    return;
+  }
+
+  std::move(callback).Run(true, receipts);
+}
+
 void EthJsonRpcController::SendRawTransaction(const std::string& signed_tx,
                                               SendRawTxCallback callback) {
   auto internal_callback =
@@ -56,6 +56,15 @@ class EthJsonRpcController {
   void GetTransactionReceipt(const std::string& tx_hash,
                              GetTxReceiptCallback callback);
 
+  using GetTxReceiptsCallback = base::OnceCallback<void(
+      bool status,
+      const std::map<int, TransactionReceipt>& receipts)>;
+  // Fetches the receipts for several transactions with one batched request.
+  // Receipts are keyed by the index of the hash they answer; hashes without
+  // a receipt yet are omitted from the map.
+  void GetTransactionReceipts(const std::vector<std::string>& tx_hashes,
+                              GetTxReceiptsCallback callback);
+
   using SendRawTxCallback =
       base::OnceCallback<void(bool status, const std::string& tx_hash)>;
   void SendRawTransaction(const std::string& signed_tx,
@@ -113,6 +122,11 @@ class EthJsonRpcController {
       const int status,
       const std::string& body,
       const std::map<std::string, std::string>& headers);
+  void OnGetTransactionReceipts(
+      GetTxReceiptsCallback callback,
+      const int status,
+      const std::string& body,
+      const std::map<std::string, std::string>& headers);
   void OnSendRawTransaction(SendRawTxCallback callback,
                             const int status,
                             const std::string& body,
@@ -31,17 +31,24 @@ void EthPendingTxTracker::UpdatePendingTransactions() {
   auto pending_transactions = tx_state_manager_->GetTransactionsByStatus(
       EthTxStateManager::TransactionStatus::SUBMITTED,
       base::Optional<EthAddress>());
+  std::vector<std::string> ids;
+  std::vector<std::string> tx_hashes;
   for (const auto& pending_transaction : pending_transactions) {
     if (IsNonceTaken(pending_transaction)) {
       DropTransaction(pending_transaction);
       nonce_lock->Release();
       return;
     }
-    std::string id = pending_transaction.id;
-    rpc_controller_->GetTransactionReceipt(
-        pending_transaction.tx_hash,
-        base::BindOnce(&EthPendingTxTracker::OnGetTxReceipt,
-                       weak_factory_.GetWeakPtr(), std::move(id)));
+    ids.push_back(pending_transaction.id);
+    tx_hashes.push_back(pending_transaction.tx_hash);
+  }
+  // Poll all pending receipts with one batched request instead of one
+  // round trip per transaction. Receipts come back keyed by the index of
+  // the hash they answer.
+  if (!tx_hashes.empty()) {
+    rpc_controller_->GetTransactionReceipts(
+        tx_hashes, base::BindOnce(&EthPendingTxTracker::OnGetTxReceipts,
+                                  weak_factory_.GetWeakPtr(), std::move(ids)));
   }
 
   nonce_lock->Release();
@@ -89,6 +96,19 @@ void EthPendingTxTracker::OnGetTxReceipt(std::string id,
   nonce_lock->Release();
 }
 
+void EthPendingTxTracker::OnGetTxReceipts(
+    std::vector<std::string> ids,
+    bool status,
+    const std::map<int, TransactionReceipt>& receipts) {
+  if (!status)
+    return;
+  for (const auto& receipt : receipts) {
+    if (receipt.first < 0 || static_cast<size_t>(receipt.first) >= ids.size())
+      continue;
+    OnGetTxReceipt(ids[receipt.first], true, receipt.second);
+  }
+}
+
 void EthPendingTxTracker::OnGetNetworkNonce(std::string address,
                                             bool status,
                                             uint256_t result) {
@@ -6,7 +6,9 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_PENDING_TX_TRACKER_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_PENDING_TX_TRACKER_H_
 
+#include <map>
 #include <string>
+#include <vector>
 
 #include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
@@ -32,6 +34,9 @@ class EthPendingTxTracker {
 
  private:
   void OnGetTxReceipt(std::string id, bool status, TransactionReceipt receipt);
+  void OnGetTxReceipts(std::vector<std::string> ids,
+                       bool status,
+                       const std::map<int, TransactionReceipt>& receipts);
   void OnGetNetworkNonce(std::string address, bool status, uint256_t result);
   void OnSendRawTransaction(bool status, const std::string& tx_hash);
 
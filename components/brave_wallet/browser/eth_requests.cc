@@ -13,14 +13,16 @@
 namespace {
 
 base::Value GetJsonRpcDictionary(const std::string& method,
-                                 base::Value* params) {
+                                 base::Value* params,
+                                 int id = 1) {
   base::Value dictionary(base::Value::Type::DICTIONARY);
   dictionary.SetKey("jsonrpc", base::Value("2.0"));
   dictionary.SetKey("method", base::Value(method));
   dictionary.SetKey("params", std::move(*params));
-  // I don't think we need to use this param, but it is required,
-  // so always set it to 1 for now..
-  dictionary.SetKey("id", base::Value(1));
+  // Single requests don't need a meaningful id, but it is required, so it
+  // defaults to 1.  Batch requests pass distinct ids so responses can be
+  // matched back to their entries.
+  dictionary.SetKey("id", base::Value(id));
   return dictionary;
 }
 
@@ -306,6 +308,18 @@ std::string eth_getTransactionReceipt(const std::string& transaction_hash) {
   return GetJsonRpc1Param("eth_getTransactionReceipt", transaction_hash);
 }
 
+std::string eth_getTransactionReceipts(
+    const std::vector<std::string>& transaction_hashes) {
+  base::Value batch(base::Value::Type::LIST);
+  for (size_t i = 0; i < transaction_hashes.size(); i++) {
+    base::Value params(base::Value::Type::LIST);
+    params.Append(base::Value(transaction_hashes[i]));
+    batch.Append(GetJsonRpcDictionary("eth_getTransactionReceipt", &params,
+                                      static_cast<int>(i)));
+  }
+  return GetJSON(batch);
+}
+
 std::string eth_getUncleByBlockHashAndIndex(const std::string& transaction_hash,
                                             const std::string& uncle_index) {
   return GetJsonRpc2Params("eth_getUncleByBlockHashAndIndex", transaction_hash,
@@ -7,6 +7,8 @@
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_REQUESTS_H_
 
 #include <string>
+#include <vector>
+
 #include "base/values.h"
 
 namespace brave_wallet {
@@ -133,6 +135,12 @@ std::string eth_getTransactionByBlockNumberAndIndex(
     const std::string& transaction_index);
 // Returns the receipt of a transaction by transaction hash.
 std::string eth_getTransactionReceipt(const std::string& transaction_hash);
+// Returns the receipts of multiple transactions as a JSON-RPC 2.0 batch
+// with one eth_getTransactionReceipt entry per hash. Entries get sequential
+// ids starting at 0 so responses, which may come back in any order, can be
+// matched to hashes by index.
+std::string eth_getTransactionReceipts(
+    const std::vector<std::string>& transaction_hashes);
 // Returns information about a uncle of a block by hash and uncle index
 // position.
 std::string eth_getUncleByBlockHashAndIndex(
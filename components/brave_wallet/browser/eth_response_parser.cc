@@ -39,48 +39,10 @@ bool ParseResult(const std::string& json, base::Value* result) {
   return true;
 }
 
-bool ParseSingleStringResult(const std::string& json, std::string* result) {
-  DCHECK(result);
-
-  base::Value result_v;
-  if (!ParseResult(json, &result_v))
-    return false;
-
-  const std::string* result_str = result_v.GetIfString();
-  if (!result_str)
-    return false;
-
-  *result = *result_str;
-
-  return true;
-}
-
-}  // namespace
-
-namespace brave_wallet {
-
-bool ParseEthGetBalance(const std::string& json, std::string* hex_balance) {
-  return ParseSingleStringResult(json, hex_balance);
-}
-
-bool ParseEthGetTransactionCount(const std::string& json, uint256_t* count) {
-  std::string count_str;
-  if (!ParseSingleStringResult(json, &count_str))
-    return false;
-
-  if (!HexValueToUint256(count_str, count))
-    return false;
-
-  return true;
-}
-
-bool ParseEthGetTransactionReceipt(const std::string& json,
-                                   TransactionReceipt* receipt) {
+bool ParseTransactionReceipt(const base::Value& result,
+                             brave_wallet::TransactionReceipt* receipt) {
   DCHECK(receipt);
 
-  base::Value result;
-  if (!ParseResult(json, &result))
-    return false;
   const base::DictionaryValue* result_dict = nullptr;
   if (!result.GetAsDictionary(&result_dict))
     return false;
@@ -91,13 +53,14 @@ bool ParseEthGetTransactionReceipt(const std::string& json,
   std::string transaction_index;
   if (!result_dict->GetString("transactionIndex", &transaction_index))
     return false;
-  if (!HexValueToUint256(transaction_index, &receipt->transaction_index))
+  if (!brave_wallet::HexValueToUint256(transaction_index,
+                                       &receipt->transaction_index))
     return false;
 
   std::string block_number;
   if (!result_dict->GetString("blockNumber", &block_number))
     return false;
-  if (!HexValueToUint256(block_number, &receipt->block_number))
+  if (!brave_wallet::HexValueToUint256(block_number, &receipt->block_number))
     return false;
 
   if (!result_dict->GetString("blockHash", &receipt->block_hash))
@@ -106,13 +69,14 @@ bool ParseEthGetTransactionReceipt(const std::string& json,
   std::string cumulative_gas_used;
   if (!result_dict->GetString("cumulativeGasUsed", &cumulative_gas_used))
     return false;
-  if (!HexValueToUint256(cumulative_gas_used, &receipt->cumulative_gas_used))
+  if (!brave_wallet::HexValueToUint256(cumulative_gas_used,
+                                       &receipt->cumulative_gas_used))
     return false;
 
   std::string gas_used;
   if (!result_dict->GetString("gasUsed", &gas_used))
     return false;
-  if (!HexValueToUint256(gas_used, &receipt->gas_used))
+  if (!brave_wallet::HexValueToUint256(gas_used, &receipt->gas_used))
     return false;
 
   // contractAddress can be null
@@ -141,6 +105,89 @@ bool ParseEthGetTransactionReceipt(const std::string& json,
   return true;
 }
 
+bool ParseSingleStringResult(const std::string& json, std::string* result) {
+  DCHECK(result);
+
+  base::Value result_v;
+  if (!ParseResult(json, &result_v))
+    return false;
+
+  const std::string* result_str = result_v.GetIfString();
+  if (!result_str)
+    return false;
+
+  *result = *result_str;
+
+  return true;
+}
+
+}  // namespace
+
+namespace brave_wallet {
+
+bool ParseEthGetBalance(const std::string& json, std::string* hex_balance) {
+  return ParseSingleStringResult(json, hex_balance);
+}
+
+bool ParseEthGetTransactionCount(const std::string& json, uint256_t* count) {
+  std::string count_str;
+  if (!ParseSingleStringResult(json, &count_str))
+    return false;
+
+  if (!HexValueToUint256(count_str, count))
+    return false;
+
+  return true;
+}
+
+bool ParseEthGetTransactionReceipt(const std::string& json,
+                                   TransactionReceipt* receipt) {
+  DCHECK(receipt);
+
+  base::Value result;
+  if (!ParseResult(json, &result))
+    return false;
+
+  return ParseTransactionReceipt(result, receipt);
+}
+
+bool ParseEthGetTransactionReceipts(
+    const std::string& json,
+    std::map<int, TransactionReceipt>* receipts) {
+  DCHECK(receipts);
+
+  base::JSONReader::ValueWithError value_with_error =
+      base::JSONReader::ReadAndReturnValueWithError(
+          json, base::JSONParserOptions::JSON_PARSE_RFC);
+  absl::optional<base::Value>& records_v = value_with_error.value;
+  if (!records_v) {
+    LOG(ERROR) << "Invalid response, could not parse JSON, JSON is: " << json;
+    return false;
+  }
+
+  if (!records_v->is_list())
+    return false;
+
+  for (const base::Value& entry : records_v->GetList()) {
+    if (!entry.is_dict())
+      return false;
+    absl::optional<int> id = entry.FindIntKey("id");
+    if (!id)
+      return false;
+    // Transactions which are pending or unknown answer with a null result;
+    // skip those entries the same way a single lookup would fail to parse.
+    const base::Value* result = entry.FindKey("result");
+    if (!result || result->is_none())
+      continue;
+    TransactionReceipt receipt;
+    if (!ParseTransactionReceipt(*result, &receipt))
+      return false;
+    (*receipts)[*id] = receipt;
+  }
+
+  return true;
+}
+
 bool ParseEthSendRawTransaction(const std::string& json, std::string* tx_hash) {
   return ParseSingleStringResult(json, tx_hash);
 }
@@ -6,6 +6,7 @@
 #ifndef BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_RESPONSE_PARSER_H_
 #define BRAVE_COMPONENTS_BRAVE_WALLET_BROWSER_ETH_RESPONSE_PARSER_H_
 
+#include <map>
 #include <string>
 #include "base/values.h"
 
@@ -18,6 +19,12 @@ bool ParseEthGetBalance(const std::string& json, std::string* hex_balance);
 bool ParseEthGetTransactionCount(const std::string& json, uint256_t* count);
 bool ParseEthGetTransactionReceipt(const std::string& json,
                                    TransactionReceipt* receipt);
+// Parses a JSON-RPC 2.0 batch response of eth_getTransactionReceipt replies,
+// keyed by the id of the batch entry each reply answers. Entries with a null
+// result (pending or unknown transactions) are omitted.
+bool ParseEthGetTransactionReceipts(
+    const std::string& json,
+    std::map<int, TransactionReceipt>* receipts);
 bool ParseEthSendRawTransaction(const std::string& json, std::string* tx_hash);
 bool ParseEthCall(const std::string& json, std::string* result);
 
@@ -3,6 +3,7 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this file,
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <map>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -126,4 +127,48 @@ TEST(EthResponseParserUnitTest, ParseEthGetTransactionReceiptNullContractAddr) {
   EXPECT_TRUE(receipt.status);
 }
 
+TEST(EthResponseParserUnitTest, ParseEthGetTransactionReceipts) {
+  std::string json(
+      R"([{
+      "id": 1,
+      "jsonrpc": "2.0",
+      "result": {
+        "transactionHash": "0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238",
+        "transactionIndex":  "0x1",
+        "blockNumber": "0xb",
+        "blockHash": "0xc6ef2fc5426d6ad6fd9e2a26abeab0aa2411b7ab17f30a99d3cb96aed1d1055b",
+        "cumulativeGasUsed": "0x33bc",
+        "gasUsed": "0x4dc",
+        "contractAddress": "0xb60e8dd61c5d32be8058bb8eb970870f07233155",
+        "logs": [],
+        "logsBloom": "0x00...0",
+        "status": "0x1"
+      }
+    }, {
+      "id": 0,
+      "jsonrpc": "2.0",
+      "result": null
+    }])");
+  std::map<int, TransactionReceipt> receipts;
+  ASSERT_TRUE(ParseEthGetTransactionReceipts(json, &receipts));
+  // The pending transaction answered with a null result and is omitted.
+  ASSERT_EQ(receipts.size(), 1UL);
+  ASSERT_EQ(receipts.count(1), 1UL);
+  const TransactionReceipt& receipt = receipts[1];
+  EXPECT_EQ(
+      receipt.transaction_hash,
+      "0xb903239f8543d04b5dc1ba6579132b143087c68db1b2168786408fcbce568238");
+  EXPECT_EQ(receipt.transaction_index, (uint256_t)1);
+  EXPECT_EQ(receipt.block_number, (uint256_t)11);
+  EXPECT_EQ(
+      receipt.block_hash,
+      "0xc6ef2fc5426d6ad6fd9e2a26abeab0aa2411b7ab17f30a99d3cb96aed1d1055b");
+  EXPECT_EQ(receipt.cumulative_gas_used, (uint256_t)13244);
+  EXPECT_EQ(receipt.gas_used, (uint256_t)1244);
+  EXPECT_EQ(receipt.contract_address,
+            "0xb60e8dd61c5d32be8058bb8eb970870f07233155");
+  EXPECT_EQ(receipt.logs_bloom, "0x00...0");
+  EXPECT_TRUE(receipt.status);
+}
+
 }  // namespace brave_wallet
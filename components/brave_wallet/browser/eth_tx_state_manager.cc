@@ -5,6 +5,8 @@
 
 #include "brave/components/brave_wallet/browser/eth_tx_state_manager.h"
 
+#include <algorithm>
+
 #include "base/guid.h"
 #include "base/logging.h"
 #include "base/util/values/values_util.h"
@@ -29,7 +31,9 @@ EthTxStateManager::EthTxStateManager(PrefService* prefs) : prefs_(prefs) {
       LOG(ERROR) << "invalid TxMeta, id=" << id;
       continue;
     }
+    meta->id = id;
     tx_meta_map_[id] = *meta;
+    AddToStatusIndex(*meta);
   }
 }
 EthTxStateManager::~EthTxStateManager() = default;
@@ -148,6 +152,13 @@ void EthTxStateManager::AddOrUpdateTx(const TxMeta& meta) {
   DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
   base::DictionaryValue* dict = update.Get();
   dict->SetKey(meta.id, TxMetaToValue(meta));
+  auto iter = tx_meta_map_.find(meta.id);
+  if (iter == tx_meta_map_.end()) {
+    AddToStatusIndex(meta);
+  } else if (iter->second.status != meta.status) {
+    RemoveFromStatusIndex(iter->second);
+    AddToStatusIndex(meta);
+  }
   tx_meta_map_[meta.id] = meta;
 }
 
@@ -167,26 +178,46 @@ void EthTxStateManager::DeleteTx(const std::string& id) {
   DictionaryPrefUpdate update(prefs_, kBraveWalletTransactions);
   base::DictionaryValue* dict = update.Get();
   dict->RemoveKey(id);
-  tx_meta_map_.erase(id);
+  auto iter = tx_meta_map_.find(id);
+  if (iter != tx_meta_map_.end()) {
+    RemoveFromStatusIndex(iter->second);
+    tx_meta_map_.erase(iter);
+  }
 }
 
 void EthTxStateManager::WipeTxs() {
   prefs_->ClearPref(kBraveWalletTransactions);
   tx_meta_map_.clear();
+  status_index_.clear();
 }
 
 std::vector<EthTxStateManager::TxMeta>
 EthTxStateManager::GetTransactionsByStatus(TransactionStatus status,
                                            base::Optional<EthAddress> from) {
   std::vector<EthTxStateManager::TxMeta> result;
-  for (auto& tx_meta : tx_meta_map_) {
-    if (tx_meta.second.status == status) {
-      if (from.has_value() && tx_meta.second.from != *from)
-        continue;
-      result.push_back(tx_meta.second);
-    }
+  auto index_iter = status_index_.find(status);
+  if (index_iter == status_index_.end())
+    return result;
+  for (const auto& id : index_iter->second) {
+    auto meta_iter = tx_meta_map_.find(id);
+    DCHECK(meta_iter != tx_meta_map_.end());
+    if (from.has_value() && meta_iter->second.from != *from)
+      continue;
+    result.push_back(meta_iter->second);
   }
   return result;
 }
 
+void EthTxStateManager::AddToStatusIndex(const TxMeta& meta) {
+  status_index_[meta.status].push_back(meta.id);
+}
+
+void EthTxStateManager::RemoveFromStatusIndex(const TxMeta& meta) {
+  auto iter = status_index_.find(meta.status);
+  if (iter == status_index_.end())
+    return;
+  std::vector<std::string>& ids = iter->second;
+  ids.erase(std::remove(ids.begin(), ids.end(), meta.id), ids.end());
+}
+
 }  // namespace brave_wallet
@@ -73,8 +73,14 @@ class EthTxStateManager {
                                               base::Optional<EthAddress> from);
 
  private:
+  void AddToStatusIndex(const TxMeta& meta);
+  void RemoveFromStatusIndex(const TxMeta& meta);
+
   PrefService* prefs_;
   base::flat_map<std::string, TxMeta> tx_meta_map_;
+  // (status, ids) kept in sync with tx_meta_map_ so status queries don't
+  // scan every transaction ever recorded.
+  base::flat_map<TransactionStatus, std::vector<std::string>> status_index_;
 };
 
 }  // namespace brave_wallet
@@ -12,6 +12,7 @@
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/third_party/bitcoin-core/src/src/base58.h"
 #include "brave/third_party/bitcoin-core/src/src/crypto/ripemd160.h"
+#include "brave/third_party/bitcoin-core/src/src/secp256k1/include/secp256k1.h"
 #include "brave/third_party/bitcoin-core/src/src/secp256k1/include/secp256k1_recovery.h"
 #include "crypto/sha2.h"
 #include "third_party/boringssl/src/include/openssl/hmac.h"
@@ -24,6 +25,20 @@ constexpr char kMasterSecret[] = "Bitcoin seed";
 #define HARDENED_OFFSET 0x80000000
 #define MAINNET_PUBLIC 0x0488B21E
 #define MAINNET_PRIVATE 0x0488ADE4
+
+// Creating a signing context precomputes large multiplication tables, so
+// it is far more expensive than any single sign or derive call. All
+// secp256k1 API calls made here only read the context, which is safe to
+// share, so every HDKey uses this one process-wide context instead of
+// building its own. Deriving a path creates one HDKey per path element and
+// used to pay the table setup for each of them.
+secp256k1_context* GetSecp256k1Ctx() {
+  static secp256k1_context* ctx =
+      secp256k1_context_create(SECP256K1_CONTEXT_SIGN |
+                               SECP256K1_CONTEXT_VERIFY);
+  return ctx;
+}
+
 }  // namespace
 
 HDKey::HDKey()
@@ -34,9 +49,7 @@ HDKey::HDKey()
       identifier_(20),
       private_key_(0),
       public_key_(33),
-      chain_code_(32),
-      secp256k1_ctx_(secp256k1_context_create(SECP256K1_CONTEXT_SIGN |
-                                              SECP256K1_CONTEXT_VERIFY)) {}
+      chain_code_(32) {}
 HDKey::HDKey(uint8_t depth, uint32_t parent_fingerprint, uint32_t index)
     : depth_(depth),
       fingerprint_(0),
@@ -45,12 +58,9 @@ HDKey::HDKey(uint8_t depth, uint32_t parent_fingerprint, uint32_t index)
       identifier_(20),
       private_key_(0),
       public_key_(33),
-      chain_code_(32),
-      secp256k1_ctx_(secp256k1_context_create(SECP256K1_CONTEXT_SIGN |
-                                              SECP256K1_CONTEXT_VERIFY)) {}
+      chain_code_(32) {}
 
 HDKey::~HDKey() {
-  secp256k1_context_destroy(secp256k1_ctx_);
   SecureZeroData(private_key_.data(), private_key_.size());
 }
 
@@ -153,7 +163,7 @@ void HDKey::SetPublicKey(const std::vector<uint8_t>& value) {
   }
   // Verify public key
   secp256k1_pubkey pubkey;
-  if (!secp256k1_ec_pubkey_parse(secp256k1_ctx_, &pubkey, value.data(),
+  if (!secp256k1_ec_pubkey_parse(GetSecp256k1Ctx(), &pubkey, value.data(),
                                  value.size())) {
     LOG(ERROR) << __func__ << ": not a valid public key";
     return;
@@ -174,12 +184,12 @@ std::vector<uint8_t> HDKey::GetUncompressedPublicKey() const {
   size_t public_key_len = 65;
   std::vector<uint8_t> public_key(public_key_len);
   secp256k1_pubkey pubkey;
-  if (!secp256k1_ec_pubkey_parse(secp256k1_ctx_, &pubkey, public_key_.data(),
-                                 public_key_.size())) {
+  if (!secp256k1_ec_pubkey_parse(GetSecp256k1Ctx(), &pubkey,
+                                 public_key_.data(), public_key_.size())) {
     LOG(ERROR) << __func__ << ": secp256k1_ec_pubkey_parse failed";
     return public_key;
   }
-  if (!secp256k1_ec_pubkey_serialize(secp256k1_ctx_, public_key.data(),
+  if (!secp256k1_ec_pubkey_serialize(GetSecp256k1Ctx(), public_key.data(),
                                      &public_key_len, &pubkey,
                                      SECP256K1_EC_UNCOMPRESSED)) {
     LOG(ERROR) << __func__ << ": secp256k1_ec_pubkey_serialize failed";
@@ -233,7 +243,7 @@ std::unique_ptr<HDKey> HDKey::DeriveChild(uint32_t index) {
     // Also Private parent key -> public child key because we always create
     // public key.
     std::vector<uint8_t> private_key = private_key_;
-    if (!secp256k1_ec_seckey_tweak_add(secp256k1_ctx_, private_key.data(),
+    if (!secp256k1_ec_seckey_tweak_add(GetSecp256k1Ctx(), private_key.data(),
                                        IL.data())) {
       LOG(ERROR) << __func__ << ": secp256k1_ec_seckey_tweak_add failed";
       return nullptr;
@@ -243,19 +253,19 @@ std::unique_ptr<HDKey> HDKey::DeriveChild(uint32_t index) {
     // Public parent key -> public child key (Normal only)
     DCHECK(!is_hardened);
     secp256k1_pubkey pubkey;
-    if (!secp256k1_ec_pubkey_parse(secp256k1_ctx_, &pubkey, public_key_.data(),
-                                   public_key_.size())) {
+    if (!secp256k1_ec_pubkey_parse(GetSecp256k1Ctx(), &pubkey,
+                                   public_key_.data(), public_key_.size())) {
       LOG(ERROR) << __func__ << ": secp256k1_ec_pubkey_parse failed";
       return nullptr;
     }
 
-    if (!secp256k1_ec_pubkey_tweak_add(secp256k1_ctx_, &pubkey, IL.data())) {
+    if (!secp256k1_ec_pubkey_tweak_add(GetSecp256k1Ctx(), &pubkey, IL.data())) {
       LOG(ERROR) << __func__ << ": secp256k1_ec_pubkey_tweak_add failed";
       return nullptr;
     }
     size_t public_key_len = 33;
     std::vector<uint8_t> public_key(public_key_len);
-    if (!secp256k1_ec_pubkey_serialize(secp256k1_ctx_, public_key.data(),
+    if (!secp256k1_ec_pubkey_serialize(GetSecp256k1Ctx(), public_key.data(),
                                        &public_key_len, &pubkey,
                                        SECP256K1_EC_COMPRESSED)) {
       LOG(ERROR) << __func__ << ": secp256k1_ec_pubkey_serialize failed";
@@ -330,28 +340,28 @@ std::vector<uint8_t> HDKey::Sign(const std::vector<uint8_t>& msg, int* recid) {
   }
   if (!recid) {
     secp256k1_ecdsa_signature ecdsa_sig;
-    if (!secp256k1_ecdsa_sign(secp256k1_ctx_, &ecdsa_sig, msg.data(),
+    if (!secp256k1_ecdsa_sign(GetSecp256k1Ctx(), &ecdsa_sig, msg.data(),
                               private_key_.data(),
                               secp256k1_nonce_function_rfc6979, nullptr)) {
       LOG(ERROR) << __func__ << ": secp256k1_ecdsa_sign failed";
       return sig;
     }
 
-    if (!secp256k1_ecdsa_signature_serialize_compact(secp256k1_ctx_, sig.data(),
-                                                     &ecdsa_sig)) {
+    if (!secp256k1_ecdsa_signature_serialize_compact(GetSecp256k1Ctx(),
+                                                     sig.data(), &ecdsa_sig)) {
       LOG(ERROR) << __func__
                  << ": secp256k1_ecdsa_signature_serialize_compact failed";
     }
   } else {
     secp256k1_ecdsa_recoverable_signature ecdsa_sig;
     if (!secp256k1_ecdsa_sign_recoverable(
-            secp256k1_ctx_, &ecdsa_sig, msg.data(), private_key_.data(),
+            GetSecp256k1Ctx(), &ecdsa_sig, msg.data(), private_key_.data(),
             secp256k1_nonce_function_rfc6979, nullptr)) {
       LOG(ERROR) << __func__ << ": secp256k1_ecdsa_sign_recoverable failed";
       return sig;
     }
     if (!secp256k1_ecdsa_recoverable_signature_serialize_compact(
-            secp256k1_ctx_, sig.data(), recid, &ecdsa_sig)) {
+            GetSecp256k1Ctx(), sig.data(), recid, &ecdsa_sig)) {
       LOG(ERROR)
           << __func__
           << ": secp256k1_ecdsa_recoverable_signature_serialize_compact failed";
@@ -369,19 +379,19 @@ bool HDKey::Verify(const std::vector<uint8_t>& msg,
   }
 
   secp256k1_ecdsa_signature ecdsa_sig;
-  if (!secp256k1_ecdsa_signature_parse_compact(secp256k1_ctx_, &ecdsa_sig,
+  if (!secp256k1_ecdsa_signature_parse_compact(GetSecp256k1Ctx(), &ecdsa_sig,
                                                sig.data())) {
     LOG(ERROR) << __func__
                << ": secp256k1_ecdsa_signature_parse_compact failed";
     return false;
   }
   secp256k1_pubkey pubkey;
-  if (!secp256k1_ec_pubkey_parse(secp256k1_ctx_, &pubkey, public_key_.data(),
-                                 public_key_.size())) {
+  if (!secp256k1_ec_pubkey_parse(GetSecp256k1Ctx(), &pubkey,
+                                 public_key_.data(), public_key_.size())) {
     LOG(ERROR) << __func__ << ": secp256k1_ec_pubkey_parse failed";
     return false;
   }
-  if (!secp256k1_ecdsa_verify(secp256k1_ctx_, &ecdsa_sig, msg.data(),
+  if (!secp256k1_ecdsa_verify(GetSecp256k1Ctx(), &ecdsa_sig, msg.data(),
                               &pubkey)) {
     LOG(ERROR) << __func__ << ": secp256k1_ecdsa_verify failed";
     return false;
@@ -405,7 +415,7 @@ std::vector<uint8_t> HDKey::Recover(const std::vector<uint8_t>& msg,
 
   secp256k1_ecdsa_recoverable_signature ecdsa_sig;
   if (!secp256k1_ecdsa_recoverable_signature_parse_compact(
-          secp256k1_ctx_, &ecdsa_sig, sig.data(), recid)) {
+          GetSecp256k1Ctx(), &ecdsa_sig, sig.data(), recid)) {
     LOG(ERROR)
         << __func__
         << ": secp256k1_ecdsa_recoverable_signature_parse_compact failed";
@@ -413,13 +423,13 @@ std::vector<uint8_t> HDKey::Recover(const std::vector<uint8_t>& msg,
   }
 
   secp256k1_pubkey pubkey;
-  if (!secp256k1_ecdsa_recover(secp256k1_ctx_, &pubkey, &ecdsa_sig,
+  if (!secp256k1_ecdsa_recover(GetSecp256k1Ctx(), &pubkey, &ecdsa_sig,
                                msg.data())) {
     LOG(ERROR) << __func__ << ": secp256k1_ecdsa_recover failed";
     return public_key;
   }
 
-  if (!secp256k1_ec_pubkey_serialize(secp256k1_ctx_, public_key.data(),
+  if (!secp256k1_ec_pubkey_serialize(GetSecp256k1Ctx(), public_key.data(),
                                      &public_key_len, &pubkey,
                                      SECP256K1_EC_COMPRESSED)) {
     LOG(ERROR) << "secp256k1_ec_pubkey_serialize failed";
@@ -430,13 +440,13 @@ std::vector<uint8_t> HDKey::Recover(const std::vector<uint8_t>& msg,
 
 void HDKey::GeneratePublicKey() {
   secp256k1_pubkey public_key;
-  if (!secp256k1_ec_pubkey_create(secp256k1_ctx_, &public_key,
+  if (!secp256k1_ec_pubkey_create(GetSecp256k1Ctx(), &public_key,
                                   private_key_.data())) {
     LOG(ERROR) << "secp256k1_ec_pubkey_create failed";
     return;
   }
   size_t public_key_len = 33;
-  if (!secp256k1_ec_pubkey_serialize(secp256k1_ctx_, public_key_.data(),
+  if (!secp256k1_ec_pubkey_serialize(GetSecp256k1Ctx(), public_key_.data(),
                                      &public_key_len, &public_key,
                                      SECP256K1_EC_COMPRESSED)) {
     LOG(ERROR) << "secp256k1_ec_pubkey_serialize failed";
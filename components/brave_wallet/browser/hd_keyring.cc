@@ -27,6 +27,7 @@ void HDKeyring::ClearData() {
   root_.reset();
   master_key_.reset();
   accounts_.clear();
+  address_cache_.clear();
 }
 
 void HDKeyring::ConstructRootHDKey(const std::vector<uint8_t>& seed,
@@ -60,6 +61,8 @@ void HDKeyring::RemoveAccount(const std::string& address) {
   for (size_t i = 0; i < accounts_.size(); ++i) {
     if (GetAddress(i) == address) {
       accounts_.erase(accounts_.begin() + i);
+      if (i < address_cache_.size())
+        address_cache_.erase(address_cache_.begin() + i);
     }
   }
 }
@@ -67,6 +70,13 @@ void HDKeyring::RemoveAccount(const std::string& address) {
 std::string HDKeyring::GetAddress(size_t index) {
   if (accounts_.empty() || index >= accounts_.size())
     return std::string();
+  // GetHDKeyFromAddress walks every account per signing call, so cache the
+  // checksum address instead of recomputing the uncompressed public key and
+  // Keccak hashes each time.
+  if (address_cache_.size() != accounts_.size())
+    address_cache_.resize(accounts_.size());
+  if (!address_cache_[index].empty())
+    return address_cache_[index];
   const std::vector<uint8_t> public_key =
       accounts_[index]->GetUncompressedPublicKey();
   // trim the header byte 0x04
@@ -75,7 +85,8 @@ std::string HDKeyring::GetAddress(size_t index) {
   EthAddress addr = EthAddress::FromPublicKey(pubkey_no_header);
 
   // TODO(darkdh): chain id
-  return addr.ToChecksumAddress();
+  address_cache_[index] = addr.ToChecksumAddress();
+  return address_cache_[index];
 }
 
 void HDKeyring::SignTransaction(const std::string& address,
@@ -54,6 +54,8 @@ class HDKeyring {
   std::unique_ptr<HDKey> root_;
   std::unique_ptr<HDKey> master_key_;
   std::vector<std::unique_ptr<HDKey>> accounts_;
+  // Lazily computed checksum address per account, parallel to accounts_.
+  std::vector<std::string> address_cache_;
 
  private:
   FRIEND_TEST_ALL_PREFIXES(HDKeyringUnitTest, ConstructRootHDKey);
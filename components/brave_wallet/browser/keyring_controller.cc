@@ -6,7 +6,9 @@
 #include "brave/components/brave_wallet/browser/keyring_controller.h"
 
 #include "base/base64.h"
+#include "base/bind.h"
 #include "base/logging.h"
+#include "base/task/thread_pool.h"
 #include "brave/components/brave_wallet/browser/brave_wallet_utils.h"
 #include "brave/components/brave_wallet/browser/hd_keyring.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
@@ -17,13 +19,26 @@ namespace brave_wallet {
 namespace {
 const size_t kSaltSize = 32;
 const size_t kNonceSize = 12;
+const size_t kPbkdf2Iterations = 100000;
+const size_t kPbkdf2KeySize = 256;
 
 static base::span<const uint8_t> ToSpan(base::StringPiece sp) {
   return base::as_bytes(base::make_span(sp));
 }
+
+// Runs on the thread pool for Unlock; the bound password and salt copies
+// keep it self-contained.
+std::unique_ptr<PasswordEncryptor> DeriveEncryptor(
+    const std::string& password,
+    const std::vector<uint8_t>& salt) {
+  return PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
+      password, salt, kPbkdf2Iterations, kPbkdf2KeySize);
+}
+
 }  // namespace
 
-KeyringController::KeyringController(PrefService* prefs) : prefs_(prefs) {
+KeyringController::KeyringController(PrefService* prefs)
+    : prefs_(prefs), weak_factory_(this) {
   DCHECK(prefs);
 }
 
@@ -47,22 +62,18 @@ HDKeyring* KeyringController::CreateDefaultKeyring(
   return default_keyring_.get();
 }
 
-HDKeyring* KeyringController::ResumeDefaultKeyring(
-    const std::string& password) {
-  if (!CreateEncryptor(password)) {
-    return nullptr;
-  }
-
+bool KeyringController::ResumeDefaultKeyring() {
+  DCHECK(encryptor_);
   const std::string mnemonic = GetMnemonicForDefaultKeyring();
   if (mnemonic.empty() || !CreateDefaultKeyringInternal(mnemonic)) {
-    return nullptr;
+    return false;
   }
   size_t account_no =
       (size_t)prefs_->GetInteger(kBraveWalletDefaultKeyringAccountNum);
   if (account_no)
     default_keyring_->AddAccounts(account_no);
 
-  return default_keyring_.get();
+  return true;
 }
 
 HDKeyring* KeyringController::RestoreDefaultKeyring(
@@ -124,8 +135,27 @@ void KeyringController::Lock() {
   encryptor_.reset();
 }
 
+void KeyringController::Unlock(const std::string& password,
+                               UnlockCallback callback) {
+  if (password.empty()) {
+    std::move(callback).Run(false);
+    return;
+  }
+  // Key derivation deliberately burns CPU for the full PBKDF2 iteration
+  // count, so run it on the thread pool and resume the keyring when the
+  // derived key comes back instead of freezing the calling sequence.
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_BLOCKING},
+      base::BindOnce(&DeriveEncryptor, password, GetOrCreateSalt()),
+      base::BindOnce(&KeyringController::OnEncryptorDerived,
+                     weak_factory_.GetWeakPtr(), std::move(callback)));
+}
+
 bool KeyringController::Unlock(const std::string& password) {
-  if (!ResumeDefaultKeyring(password)) {
+  if (password.empty())
+    return false;
+  encryptor_ = DeriveEncryptor(password, GetOrCreateSalt());
+  if (!encryptor_ || !ResumeDefaultKeyring()) {
     encryptor_.reset();
     return false;
   }
@@ -134,6 +164,20 @@ bool KeyringController::Unlock(const std::string& password) {
   return true;
 }
 
+void KeyringController::OnEncryptorDerived(
+    UnlockCallback callback,
+    std::unique_ptr<PasswordEncryptor> encryptor) {
+  encryptor_ = std::move(encryptor);
+  if (!encryptor_ || !ResumeDefaultKeyring()) {
+    encryptor_.reset();
+    std::move(callback).Run(false);
+    return;
+  }
+
+  UpdateLastUnlockPref(prefs_);
+  std::move(callback).Run(true);
+}
+
 void KeyringController::Reset() {
   prefs_->ClearPref(kBraveWalletPasswordEncryptorSalt);
   prefs_->ClearPref(kBraveWalletPasswordEncryptorNonce);
@@ -176,16 +220,19 @@ std::vector<uint8_t> KeyringController::GetOrCreateNonce() {
   return nonce;
 }
 
-bool KeyringController::CreateEncryptor(const std::string& password) {
-  if (password.empty())
-    return false;
+std::vector<uint8_t> KeyringController::GetOrCreateSalt() {
   std::vector<uint8_t> salt(kSaltSize);
   if (!GetPrefsInBytes(kBraveWalletPasswordEncryptorSalt, &salt)) {
     crypto::RandBytes(salt);
     SetPrefsInBytes(kBraveWalletPasswordEncryptorSalt, salt);
   }
-  encryptor_ = PasswordEncryptor::DeriveKeyFromPasswordUsingPbkdf2(
-      password, salt, 100000, 256);
+  return salt;
+}
+
+bool KeyringController::CreateEncryptor(const std::string& password) {
+  if (password.empty())
+    return false;
+  encryptor_ = DeriveEncryptor(password, GetOrCreateSalt());
   return encryptor_ != nullptr;
 }
 
@@ -10,7 +10,9 @@
 #include <string>
 #include <vector>
 
+#include "base/callback.h"
 #include "base/gtest_prod_util.h"
+#include "base/memory/weak_ptr.h"
 #include "brave/components/brave_wallet/browser/password_encryptor.h"
 
 class PrefService;
@@ -47,8 +49,17 @@ class KeyringController {
   HDKeyring* GetDefaultKeyring();
   bool IsDefaultKeyringCreated();
 
+  using UnlockCallback = base::OnceCallback<void(bool)>;
+
   bool IsLocked() const;
   void Lock();
+  // Key derivation runs its full PBKDF2 iteration count, so it is posted to
+  // the thread pool; the callback is run on the calling sequence once the
+  // keyring has been resumed (or derivation/decryption failed).
+  void Unlock(const std::string& password, UnlockCallback callback);
+  // Synchronous form for the platform bridges (Android JNI, iOS) whose API
+  // surface needs the result immediately. Blocks the calling sequence for
+  // the full key derivation; desktop callers should use the async form.
   bool Unlock(const std::string& password);
 
   /* TODO(darkdh): For other keyrings support
@@ -74,10 +85,14 @@ class KeyringController {
   void SetPrefsInBytes(const std::string& path,
                        base::span<const uint8_t> bytes);
   std::vector<uint8_t> GetOrCreateNonce();
+  std::vector<uint8_t> GetOrCreateSalt();
   bool CreateEncryptor(const std::string& password);
   bool CreateDefaultKeyringInternal(const std::string& mnemonic);
   // It's used to reconstruct same default keyring between browser relaunch
-  HDKeyring* ResumeDefaultKeyring(const std::string& password);
+  // Requires the encryptor to be created first.
+  bool ResumeDefaultKeyring();
+  void OnEncryptorDerived(UnlockCallback callback,
+                          std::unique_ptr<PasswordEncryptor> encryptor);
 
   std::unique_ptr<PasswordEncryptor> encryptor_;
   std::unique_ptr<HDKeyring> default_keyring_;
@@ -87,6 +102,8 @@ class KeyringController {
 
   PrefService* prefs_;
 
+  base::WeakPtrFactory<KeyringController> weak_factory_;
+
   KeyringController(const KeyringController&) = delete;
   KeyringController& operator=(const KeyringController&) = delete;
 };
@@ -6,6 +6,8 @@
 #include "brave/components/brave_wallet/browser/keyring_controller.h"
 
 #include "base/base64.h"
+#include "base/run_loop.h"
+#include "base/test/bind.h"
 #include "brave/components/brave_wallet/browser/hd_keyring.h"
 #include "brave/components/brave_wallet/browser/pref_names.h"
 #include "chrome/browser/profiles/profile_manager.h"
@@ -32,6 +34,19 @@ class KeyringControllerUnitTest : public testing::Test {
     return ProfileManager::GetActiveUserProfile()->GetPrefs();
   }
 
+  // Unlock derives the key on the thread pool; pump it back synchronously.
+  bool Unlock(KeyringController* controller, const std::string& password) {
+    bool result = false;
+    base::RunLoop run_loop;
+    controller->Unlock(password,
+                       base::BindLambdaForTesting([&](bool success) {
+                         result = success;
+                         run_loop.Quit();
+                       }));
+    run_loop.Run();
+    return result;
+  }
+
  private:
   content::BrowserTaskEnvironment task_environment_;
   TestingProfileManager testing_profile_manager_;
@@ -277,7 +292,7 @@ TEST_F(KeyringControllerUnitTest, UnlockResumesDefaultKeyring) {
   {
     // KeyringController is now destructed, simlulating relaunch
     KeyringController controller(GetPrefs());
-    ASSERT_TRUE(controller.Unlock("brave"));
+    ASSERT_TRUE(Unlock(&controller, "brave"));
     HDKeyring* keyring = controller.GetDefaultKeyring();
     EXPECT_EQ(GetPrefs()->GetString(kBraveWalletPasswordEncryptorSalt), salt);
     EXPECT_EQ(GetPrefs()->GetString(kBraveWalletPasswordEncryptorNonce), nonce);
@@ -288,9 +303,9 @@ TEST_F(KeyringControllerUnitTest, UnlockResumesDefaultKeyring) {
   {
     KeyringController controller(GetPrefs());
     // wrong password
-    ASSERT_FALSE(controller.Unlock("brave123"));
+    ASSERT_FALSE(Unlock(&controller, "brave123"));
     // empty password
-    ASSERT_FALSE(controller.Unlock(""));
+    ASSERT_FALSE(Unlock(&controller, ""));
   }
 }
 
@@ -312,10 +327,10 @@ TEST_F(KeyringControllerUnitTest, GetMnemonicForDefaultKeyring) {
   EXPECT_TRUE(controller.GetMnemonicForDefaultKeyring().empty());
 
   // unlock with wrong password
-  EXPECT_FALSE(controller.Unlock("brave123"));
+  EXPECT_FALSE(Unlock(&controller, "brave123"));
   EXPECT_TRUE(controller.GetMnemonicForDefaultKeyring().empty());
 
-  EXPECT_TRUE(controller.Unlock("brave"));
+  EXPECT_TRUE(Unlock(&controller, "brave"));
   EXPECT_EQ(controller.GetMnemonicForDefaultKeyring(), mnemonic);
 }
 
@@ -331,7 +346,7 @@ TEST_F(KeyringControllerUnitTest, GetDefaultKeyring) {
   controller.Lock();
   EXPECT_EQ(controller.GetDefaultKeyring(), nullptr);
 
-  EXPECT_TRUE(controller.Unlock("brave"));
+  EXPECT_TRUE(Unlock(&controller, "brave"));
   ASSERT_NE(controller.GetDefaultKeyring(), nullptr);
   EXPECT_EQ(controller.GetDefaultKeyring()->GetAddress(0), address);
 }
@@ -361,10 +376,10 @@ TEST_F(KeyringControllerUnitTest, LockAndUnlock) {
     EXPECT_EQ(GetPrefs()->GetInteger(kBraveWalletDefaultKeyringAccountNum), 1);
     EXPECT_TRUE(controller.default_keyring_->empty());
 
-    EXPECT_FALSE(controller.Unlock("abc"));
+    EXPECT_FALSE(Unlock(&controller, "abc"));
     EXPECT_TRUE(controller.IsLocked());
 
-    EXPECT_TRUE(controller.Unlock("brave"));
+    EXPECT_TRUE(Unlock(&controller, "brave"));
     EXPECT_FALSE(controller.IsLocked());
     controller.default_keyring_->AddAccounts(1);
 
@@ -374,7 +389,7 @@ TEST_F(KeyringControllerUnitTest, LockAndUnlock) {
     EXPECT_TRUE(controller.default_keyring_->empty());
 
     // Simulate unlock shutdown
-    EXPECT_TRUE(controller.Unlock("brave"));
+    EXPECT_TRUE(Unlock(&controller, "brave"));
     controller.default_keyring_->AddAccounts(1);
   }
   EXPECT_EQ(GetPrefs()->GetInteger(kBraveWalletDefaultKeyringAccountNum), 3);
@@ -6,30 +6,90 @@
 #include "brave/components/brave_wallet/browser/rlp_encode.h"
 
 #include <algorithm>
-#include <utility>
 
 namespace {
 
-std::string RLPToBinary(size_t x) {
-  if (x == 0) {
-    return "";
+// Number of bytes in the minimal big-endian representation of |x|.
+size_t RLPBinaryLength(size_t x) {
+  size_t length = 0;
+  for (; x; x /= 256)
+    ++length;
+  return length;
+}
+
+// Number of bytes RLPWriteLength will produce for a payload of |length|.
+size_t RLPLengthPrefixSize(size_t length) {
+  return length < 56 ? 1 : 1 + RLPBinaryLength(length);
+}
+
+// First pass: the exact number of bytes the encoding of |val| takes, so
+// the output buffer can be sized once up front instead of reallocating
+// and re-copying at every nesting level.
+size_t RLPEncodedSize(const base::Value& val) {
+  if (val.is_int()) {
+    return RLPEncodedSize(base::Value(brave_wallet::RLPUint256ToBlobValue(
+        (brave_wallet::uint256_t)val.GetInt())));
+  } else if (val.is_blob()) {
+    const base::Value::BlobStorage& blob = val.GetBlob();
+    if (blob.size() == 1 && static_cast<uint8_t>(blob[0]) < 0x80)
+      return 1;
+    return RLPLengthPrefixSize(blob.size()) + blob.size();
+  } else if (val.is_string()) {
+    const std::string& s = val.GetString();
+    if (s.size() == 1 && static_cast<uint8_t>(s[0]) < 0x80)
+      return 1;
+    return RLPLengthPrefixSize(s.size()) + s.size();
+  } else if (val.is_list()) {
+    size_t payload = 0;
+    for (const auto& item : val.GetList())
+      payload += RLPEncodedSize(item);
+    return RLPLengthPrefixSize(payload) + payload;
   }
-  std::string ret = RLPToBinary(x / 256);
-  ret.push_back(x % 256);
-  return ret;
+  return 0;
 }
 
-std::string RLPEncodeLength(size_t length, size_t offset) {
-  char sz[2] = {0};
+void RLPWriteLength(size_t length, size_t offset, std::string* output) {
   if (length < 56) {
-    sz[0] = length + offset;
-    return sz;
+    output->push_back(static_cast<char>(length + offset));
+    return;
+  }
+  size_t length_of_length = RLPBinaryLength(length);
+  output->push_back(static_cast<char>(length_of_length + offset + 55));
+  for (size_t i = length_of_length; i > 0; --i)
+    output->push_back(static_cast<char>((length >> (8 * (i - 1))) & 0xFF));
+}
+
+// Second pass: serialize |val| into |output|, which has already been
+// reserved to the full encoded size, so appends never reallocate.
+void RLPWrite(const base::Value& val, std::string* output) {
+  if (val.is_int()) {
+    RLPWrite(base::Value(brave_wallet::RLPUint256ToBlobValue(
+                 (brave_wallet::uint256_t)val.GetInt())),
+             output);
+  } else if (val.is_blob()) {
+    const base::Value::BlobStorage& blob = val.GetBlob();
+    if (blob.size() == 1 && static_cast<uint8_t>(blob[0]) < 0x80) {
+      output->push_back(static_cast<char>(blob[0]));
+      return;
+    }
+    RLPWriteLength(blob.size(), 0x80, output);
+    output->append(blob.begin(), blob.end());
+  } else if (val.is_string()) {
+    const std::string& s = val.GetString();
+    if (s.size() == 1 && static_cast<uint8_t>(s[0]) < 0x80) {
+      output->push_back(s[0]);
+      return;
+    }
+    RLPWriteLength(s.size(), 0x80, output);
+    output->append(s);
+  } else if (val.is_list()) {
+    size_t payload = 0;
+    for (const auto& item : val.GetList())
+      payload += RLPEncodedSize(item);
+    RLPWriteLength(payload, 0xc0, output);
+    for (const auto& item : val.GetList())
+      RLPWrite(item, output);
   }
-  std::string BL = RLPToBinary(length);
-  sz[0] = BL.length() + offset + 55;
-  std::string ret(sz);
-  ret.append(BL);
-  return ret;
 }
 
 }  // namespace
@@ -49,29 +109,10 @@ base::Value RLPUint256ToBlobValue(uint256_t input) {
 }
 
 std::string RLPEncode(base::Value val) {
-  if (val.is_int()) {
-    int i;
-    val.GetAsInteger(&i);
-    return RLPEncode(base::Value(RLPUint256ToBlobValue((uint256_t)i)));
-  } else if (val.is_blob()) {
-    base::Value::BlobStorage blob = val.GetBlob();
-    std::string s(blob.begin(), blob.end());
-    if (blob.size() == 1 && static_cast<uint8_t>(blob[0]) < 0x80) {
-      return s;
-    }
-    return RLPEncodeLength(blob.size(), 0x80) + s;
-  } else if (val.is_string()) {
-    std::string s;
-    val.GetAsString(&s);
-    return RLPEncode(base::Value(base::Value::BlobStorage(s.begin(), s.end())));
-  } else if (val.is_list()) {
-    std::string output;
-    for (auto& item : val.GetList()) {
-      output += RLPEncode(std::move(item));
-    }
-    return RLPEncodeLength(output.length(), 0xc0) + output;
-  }
-  return "";
+  std::string output;
+  output.reserve(RLPEncodedSize(val));
+  RLPWrite(val, &output);
+  return output;
 }
 
 }  // namespace brave_wallet
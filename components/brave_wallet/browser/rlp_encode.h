@@ -17,7 +17,8 @@ namespace brave_wallet {
 base::Value RLPUint256ToBlobValue(uint256_t input);
 
 // Recursive Length Prefix (RLP) encoding of base::Values consisting of string,
-// blob, or int data
+// blob, or int data. The encoded size is computed first and the result is
+// serialized into a single preallocated buffer.
 std::string RLPEncode(base::Value val);
 
 }  // namespace brave_wallet
@@ -5,10 +5,15 @@
 
 #include "brave/components/brave_wayback_machine/wayback_machine_url_fetcher.h"
 
+#include <string>
 #include <utility>
 
 #include "base/bind.h"
+#include "base/containers/flat_map.h"
 #include "base/json/json_reader.h"
+#include "base/no_destructor.h"
+#include "base/threading/sequenced_task_runner_handle.h"
+#include "base/time/time.h"
 #include "brave/components/brave_wayback_machine/brave_wayback_machine_utils.h"
 #include "brave/components/brave_wayback_machine/url_constants.h"
 #include "net/base/load_flags.h"
@@ -23,6 +28,32 @@ namespace {
 
 constexpr int kMaxBodySize = 1024 * 1024;
 
+// Fetched availability answers change rarely, so remember them briefly and
+// serve repeat lookups without another archive.org round trip. Successful
+// snapshot urls are cached per original url; a "no snapshot" answer is cached
+// per host because a site that isn't archived usually isn't archived for any
+// of its pages. Network failures are never cached so a retry can succeed.
+constexpr base::TimeDelta kPositiveCacheTTL = base::TimeDelta::FromMinutes(10);
+constexpr base::TimeDelta kNegativeCacheTTL = base::TimeDelta::FromMinutes(5);
+constexpr size_t kMaxCacheEntries = 64;
+
+struct CachedWaybackURL {
+  GURL url;
+  base::TimeTicks fetched_at;
+};
+
+base::flat_map<std::string, CachedWaybackURL>& GetPositiveCache() {
+  static base::NoDestructor<base::flat_map<std::string, CachedWaybackURL>>
+      cache;
+  return *cache;
+}
+
+base::flat_map<std::string, base::TimeTicks>& GetNegativeHostCache() {
+  static base::NoDestructor<base::flat_map<std::string, base::TimeTicks>>
+      cache;
+  return *cache;
+}
+
 const net::NetworkTrafficAnnotationTag& GetNetworkTrafficAnnotationTag() {
   static const net::NetworkTrafficAnnotationTag network_traffic_annotation_tag =
       net::DefineNetworkTrafficAnnotation("wayback_machine_infobar", R"(
@@ -56,6 +87,35 @@ WaybackMachineURLFetcher::WaybackMachineURLFetcher(
 WaybackMachineURLFetcher::~WaybackMachineURLFetcher() = default;
 
 void WaybackMachineURLFetcher::Fetch(const GURL& url) {
+  const base::TimeTicks now = base::TimeTicks::Now();
+  auto& positive_cache = GetPositiveCache();
+  const auto cached = positive_cache.find(url.spec());
+  if (cached != positive_cache.end()) {
+    if (now - cached->second.fetched_at < kPositiveCacheTTL) {
+      // Keep the client's async contract - it expects to return from Fetch()
+      // before the result callback runs.
+      base::SequencedTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE,
+          base::BindOnce(&WaybackMachineURLFetcher::RespondFromCache,
+                         weak_factory_.GetWeakPtr(), cached->second.url));
+      return;
+    }
+    positive_cache.erase(cached);
+  }
+
+  auto& negative_cache = GetNegativeHostCache();
+  const auto cached_host = negative_cache.find(url.host());
+  if (cached_host != negative_cache.end()) {
+    if (now - cached_host->second < kNegativeCacheTTL) {
+      base::SequencedTaskRunnerHandle::Get()->PostTask(
+          FROM_HERE,
+          base::BindOnce(&WaybackMachineURLFetcher::RespondFromCache,
+                         weak_factory_.GetWeakPtr(), GURL::EmptyGURL()));
+      return;
+    }
+    negative_cache.erase(cached_host);
+  }
+
   auto request = std::make_unique<network::ResourceRequest>();
   const GURL wayback_fetch_url(std::string(kWaybackQueryURL) + url.spec());
   request->url = FixupWaybackQueryURL(wayback_fetch_url);
@@ -82,10 +142,23 @@ void WaybackMachineURLFetcher::OnWaybackURLFetched(
   std::string wayback_response_json = std::move(*response_body);
   const auto result = base::JSONReader::Read(wayback_response_json);
   if (!result || !result->FindPath("archived_snapshots.closest.url")) {
+    auto& negative_cache = GetNegativeHostCache();
+    if (negative_cache.size() >= kMaxCacheEntries)
+      negative_cache.clear();
+    negative_cache[original_url.host()] = base::TimeTicks::Now();
     client_->OnWaybackURLFetched(GURL::EmptyGURL());
     return;
   }
 
-  client_->OnWaybackURLFetched(
-      GURL(result->FindPath("archived_snapshots.closest.url")->GetString()));
+  const GURL wayback_url(
+      result->FindPath("archived_snapshots.closest.url")->GetString());
+  auto& positive_cache = GetPositiveCache();
+  if (positive_cache.size() >= kMaxCacheEntries)
+    positive_cache.clear();
+  positive_cache[original_url.spec()] = {wayback_url, base::TimeTicks::Now()};
+  client_->OnWaybackURLFetched(wayback_url);
+}
+
+void WaybackMachineURLFetcher::RespondFromCache(const GURL& wayback_url) {
+  client_->OnWaybackURLFetched(wayback_url);
 }
@@ -10,6 +10,7 @@
 #include <string>
 
 #include "base/memory/scoped_refptr.h"
+#include "base/memory/weak_ptr.h"
 
 namespace network {
 class SharedURLLoaderFactory;
@@ -43,10 +44,14 @@ class WaybackMachineURLFetcher final {
  private:
   void OnWaybackURLFetched(const GURL& orignal_url,
                            std::unique_ptr<std::string> response_body);
+  // Delivers a cached availability answer with the same async contract as a
+  // network response.
+  void RespondFromCache(const GURL& wayback_url);
 
   Client* client_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   std::unique_ptr<network::SimpleURLLoader> wayback_url_loader_;
+  base::WeakPtrFactory<WaybackMachineURLFetcher> weak_factory_{this};
 };
 
 #endif  // BRAVE_COMPONENTS_BRAVE_WAYBACK_MACHINE_WAYBACK_MACHINE_URL_FETCHER_H_
@@ -6,6 +6,7 @@ import { Torrent } from 'webtorrent'
 import * as throttle from 'throttleit'
 
 import webtorrentActions from '../actions/webtorrentActions'
+import { recordActivity } from '../pieceMemoryBudget'
 import { createServer } from '../webtorrent'
 
 interface TorrentExtended extends Torrent {
@@ -29,6 +30,10 @@ export const addTorrentEvents = (torrent: TorrentExtended) => {
     webtorrentActions.progressUpdated(torrent)
   }, 500)
 
+  // Only real piece traffic counts as activity for the memory budget;
+  // progress updates also fire on stalls and uploads.
+  torrent.on('download', () => recordActivity(torrent))
+
   torrent.on('download', progressUpdatedThrottled)
   torrent.on('upload', progressUpdatedThrottled)
   torrent.on('done', progressUpdatedThrottled)
@@ -0,0 +1,111 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import { Torrent } from 'webtorrent'
+
+// Every torrent in this extension is backed by webtorrent's in-memory chunk
+// store, so the bytes downloaded across all active torrents sit in this
+// process' heap until the torrents are removed. This module keeps that total
+// under a global budget: when the sum of downloaded bytes crosses the cap,
+// the least-recently-active torrents are throttled (paused and deselected)
+// so the client stops requesting new pieces, and they are resumed
+// most-recently-active first once the total drops back under the resume
+// mark. Throttling is backpressure, not eviction - pieces already held by a
+// torrent are only released when the user removes it, because the chunk
+// store has no per-piece eviction hook.
+export const DEFAULT_BUDGET_BYTES = 256 * 1024 * 1024
+
+// Resume below 7/8 of the budget so torrents don't flap around the cap.
+const RESUME_FRACTION = 7 / 8
+
+interface TorrentWithSelection extends Torrent {
+  deselect (start: number, end: number, priority: number): void
+  select (start: number, end: number, priority: number): void
+}
+
+const lastActiveAt: { [infoHash: string]: number } = {}
+const throttledHashes: Set<string> = new Set()
+
+export const recordActivity = (torrent: Torrent) => {
+  if (torrent.infoHash) {
+    lastActiveAt[torrent.infoHash] = Date.now()
+  }
+}
+
+export const forgetTorrent = (infoHash: string) => {
+  delete lastActiveAt[infoHash]
+  throttledHashes.delete(infoHash)
+}
+
+export const isThrottled = (infoHash: string) => {
+  return throttledHashes.has(infoHash)
+}
+
+const totalDownloadedBytes = (torrents: Torrent[]) => {
+  return torrents.reduce((total, torrent) => {
+    return total + (torrent.downloaded || 0)
+  }, 0)
+}
+
+const selectWholeTorrent = (torrent: Torrent, selected: boolean) => {
+  const pieces = torrent.pieces ? torrent.pieces.length : 0
+  if (pieces === 0) return
+  const torrentWithSelection = torrent as TorrentWithSelection
+  if (selected) {
+    torrentWithSelection.select(0, pieces - 1, 0)
+  } else {
+    torrentWithSelection.deselect(0, pieces - 1, 0)
+  }
+}
+
+const throttleTorrent = (torrent: Torrent) => {
+  throttledHashes.add(torrent.infoHash)
+  // pause() stops new peer connections; deselecting the pieces stops
+  // requests on the wires that are already open.
+  torrent.pause()
+  selectWholeTorrent(torrent, false)
+}
+
+const resumeTorrent = (torrent: Torrent) => {
+  throttledHashes.delete(torrent.infoHash)
+  selectWholeTorrent(torrent, true)
+  torrent.resume()
+}
+
+// Sorted so the least-recently-active torrent comes first. Torrents with no
+// recorded activity sort oldest of all.
+const byLeastRecentActivity = (torrents: Torrent[]) => {
+  return torrents.slice().sort((a, b) => {
+    return (lastActiveAt[a.infoHash] || 0) - (lastActiveAt[b.infoHash] || 0)
+  })
+}
+
+export const enforceBudget = (
+    torrents: Torrent[],
+    budgetBytes: number = DEFAULT_BUDGET_BYTES) => {
+  const total = totalDownloadedBytes(torrents)
+
+  if (total > budgetBytes) {
+    for (const torrent of byLeastRecentActivity(torrents)) {
+      // The last active torrent keeps downloading even when it alone exceeds
+      // the budget; throttling every torrent would stall the user's current
+      // stream without freeing anything.
+      if (throttledHashes.size >= torrents.length - 1) break
+      if (torrent.done || throttledHashes.has(torrent.infoHash)) continue
+      throttleTorrent(torrent)
+    }
+    return
+  }
+
+  if (total < budgetBytes * RESUME_FRACTION && throttledHashes.size > 0) {
+    const resumable = torrents.filter(
+      torrent => throttledHashes.has(torrent.infoHash))
+    const mostRecentFirst = byLeastRecentActivity(resumable).reverse()
+    // Resume one torrent per pass; the next pass sees the bytes it pulled in
+    // before letting another one go.
+    if (mostRecentFirst.length > 0) {
+      resumeTorrent(mostRecentFirst[0])
+    }
+  }
+}
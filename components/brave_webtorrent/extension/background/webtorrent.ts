@@ -5,18 +5,25 @@
 import * as WebTorrent from 'webtorrent'
 import { addTorrentEvents, removeTorrentEvents } from './events/torrentEvents'
 import { addWebtorrentEvents } from './events/webtorrentEvents'
+import { enforceBudget, forgetTorrent } from './pieceMemoryBudget'
 import { AddressInfo } from 'net'
 import { Instance } from 'parse-torrent'
 import { basename, extname } from 'path'
 import * as JSZip from 'jszip'
 
+const BUDGET_ENFORCE_INTERVAL_MS = 5000
+
 let webTorrent: WebTorrent.Instance | undefined
 let servers: { [key: string]: any } = { }
+let budgetInterval: number | undefined
 
 export const getWebTorrent = () => {
   if (!webTorrent) {
     webTorrent = new WebTorrent({ tracker: { wrtc: false } })
     addWebtorrentEvents(webTorrent)
+    budgetInterval = setInterval(
+      () => webTorrent && enforceBudget(webTorrent.torrents),
+      BUDGET_ENFORCE_INTERVAL_MS)
   }
 
   return webTorrent
@@ -63,6 +70,8 @@ export const findTorrent = (infoHash: string) => {
 
 const maybeDestroyWebTorrent = () => {
   if (!webTorrent || webTorrent.torrents.length !== 0) return
+  clearInterval(budgetInterval)
+  budgetInterval = undefined
   webTorrent.destroy()
   webTorrent = undefined
 }
@@ -73,6 +82,7 @@ export const delTorrent = (infoHash: string) => {
     removeTorrentEvents(torrent)
     torrent.destroy()
   }
+  forgetTorrent(infoHash)
 
   if (servers[infoHash]) {
     servers[infoHash].close()
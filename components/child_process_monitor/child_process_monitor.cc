@@ -16,15 +16,20 @@
 #include <windows.h>
 #endif
 
+#include <map>
 #include <utility>
+#include <vector>
 
+#include "base/bind.h"
 #include "base/bind_post_task.h"
 #include "base/logging.h"
+#include "base/no_destructor.h"
 #include "base/process/kill.h"
-#include "base/single_thread_task_runner.h"
+#include "base/synchronization/lock.h"
 #include "base/task/task_traits.h"
 #include "base/task/thread_pool.h"
 #include "base/threading/sequenced_task_runner_handle.h"
+#include "base/threading/thread.h"
 
 namespace brave {
 
@@ -78,76 +83,148 @@ void SetupPipeHack() {
   action.sa_flags = SA_RESTART;
   sigaction(SIGCHLD, &action, NULL);
 }
+#endif
 
-void TearDownPipeHack() {
-  struct sigaction action;
-  memset(&action, 0, sizeof(action));
-  action.sa_handler = SIG_DFL;
-  action.sa_flags = SA_RESTART;
-  sigaction(SIGCHLD, &action, NULL);
-  close(pipehack[0]);
-  close(pipehack[1]);
-}
+// Single monitor thread shared by every ChildProcessMonitor in the process.
+// Monitored children used to get a dedicated thread each blocked in waitpid
+// (or WaitForSingleObject); with tor, ipfs and other helpers all monitored
+// this multiplexes them onto one wait loop instead. On POSIX the SIGCHLD
+// pipe wakes the loop and every registered child is polled with WNOHANG; on
+// Windows the loop blocks in WaitForMultipleObjects on the child handles
+// plus a wake event signaled when the set of children changes.
+class SharedChildMonitor {
+ public:
+  static SharedChildMonitor* GetInstance() {
+    static base::NoDestructor<SharedChildMonitor> instance;
+    return instance.get();
+  }
+
+  SharedChildMonitor(const SharedChildMonitor&) = delete;
+  SharedChildMonitor& operator=(const SharedChildMonitor&) = delete;
+
+  void Register(base::ProcessHandle handle,
+                base::OnceCallback<void(base::ProcessId)> callback) {
+    DCHECK(callback);
+    {
+      base::AutoLock lock(lock_);
+      children_[handle] = std::move(callback);
+    }
+    Wake();
+  }
+
+  void Unregister(base::ProcessHandle handle) {
+    {
+      base::AutoLock lock(lock_);
+      children_.erase(handle);
+    }
+    Wake();
+  }
+
+ private:
+  friend class base::NoDestructor<SharedChildMonitor>;
+
+  SharedChildMonitor() : thread_("child_monitor_thread") {
+#if defined(OS_POSIX)
+    SetupPipeHack();
+#elif defined(OS_WIN)
+    wake_event_ = ::CreateEvent(nullptr, FALSE, FALSE, nullptr);
 #endif
+    if (!thread_.Start()) {
+      NOTREACHED();
+    }
+    thread_.task_runner()->PostTask(
+        FROM_HERE, base::BindOnce(&SharedChildMonitor::MonitorLoop,
+                                  base::Unretained(this)));
+  }
 
-void MonitorChild(base::ProcessHandle p_handle,
-                  base::OnceCallback<void(base::ProcessId)> callback) {
-  DCHECK(callback);
+  void Wake() {
 #if defined(OS_POSIX)
-  char buf[PIPE_BUF];
-
-  while (1) {
-    if (read(pipehack[0], buf, sizeof(buf)) > 0) {
-      pid_t pid;
-      int status;
-
-      if ((pid = waitpid(base::GetProcId(p_handle), &status, WNOHANG)) != -1) {
-        if (WIFSIGNALED(status)) {
-          VLOG(0) << "child(" << pid << ") got terminated by signal "
-                  << WTERMSIG(status);
-        } else if (WCOREDUMP(status)) {
-          VLOG(0) << "child(" << pid << ") coredumped";
-        } else if (WIFEXITED(status)) {
-          VLOG(0) << "child(" << pid << ") exit (" << WEXITSTATUS(status)
-                  << ")";
+    char ch = 0;
+    (void)write(pipehack[1], &ch, 1);
+#elif defined(OS_WIN)
+    ::SetEvent(wake_event_);
+#endif
+  }
+
+  void MonitorLoop() {
+#if defined(OS_POSIX)
+    char buf[PIPE_BUF];
+
+    while (read(pipehack[0], buf, sizeof(buf)) > 0) {
+      base::AutoLock lock(lock_);
+      for (auto it = children_.begin(); it != children_.end();) {
+        pid_t pid;
+        int status;
+
+        if ((pid = waitpid(base::GetProcId(it->first), &status, WNOHANG)) >
+            0) {
+          if (WIFSIGNALED(status)) {
+            VLOG(0) << "child(" << pid << ") got terminated by signal "
+                    << WTERMSIG(status);
+          } else if (WCOREDUMP(status)) {
+            VLOG(0) << "child(" << pid << ") coredumped";
+          } else if (WIFEXITED(status)) {
+            VLOG(0) << "child(" << pid << ") exit (" << WEXITSTATUS(status)
+                    << ")";
+          }
+          std::move(it->second).Run(pid);
+          it = children_.erase(it);
+        } else {
+          ++it;
         }
-        std::move(callback).Run(pid);
-        break;
       }
-    } else {
-      // pipes closed
-      break;
     }
-  }
 #elif defined(OS_WIN)
-  WaitForSingleObject(p_handle, INFINITE);
-  std::move(callback).Run(base::GetProcId(p_handle));
+    while (1) {
+      std::vector<HANDLE> handles;
+      handles.push_back(wake_event_);
+      {
+        base::AutoLock lock(lock_);
+        for (const auto& child : children_)
+          handles.push_back(child.first);
+      }
+      DWORD result = ::WaitForMultipleObjects(handles.size(), handles.data(),
+                                              FALSE, INFINITE);
+      if (result == WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + handles.size())
+        continue;
+
+      HANDLE handle = handles[result - WAIT_OBJECT_0];
+      base::OnceCallback<void(base::ProcessId)> callback;
+      {
+        base::AutoLock lock(lock_);
+        auto it = children_.find(handle);
+        if (it == children_.end())
+          continue;
+        callback = std::move(it->second);
+        children_.erase(it);
+      }
+      std::move(callback).Run(base::GetProcId(handle));
+    }
 #else
 #error unsupported platforms
 #endif
-}
+  }
+
+  base::Thread thread_;
+  base::Lock lock_;
+  std::map<base::ProcessHandle, base::OnceCallback<void(base::ProcessId)>>
+      children_;
+#if defined(OS_WIN)
+  HANDLE wake_event_;
+#endif
+};
 
 }  // namespace
 
-ChildProcessMonitor::ChildProcessMonitor()
-    : child_monitor_thread_(
-          std::make_unique<base::Thread>("child_monitor_thread")) {
+ChildProcessMonitor::ChildProcessMonitor() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-#if defined(OS_POSIX)
-  SetupPipeHack();
-#endif
-  if (!child_monitor_thread_->Start()) {
-    NOTREACHED();
-  }
 }
 
 ChildProcessMonitor::~ChildProcessMonitor() {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
-#if defined(OS_POSIX)
-  TearDownPipeHack();
-#endif
 
   if (child_process_.IsValid()) {
+    SharedChildMonitor::GetInstance()->Unregister(child_process_.Handle());
     child_process_.Terminate(0, true);
 #if defined(OS_MAC)
     // TODO(https://crbug.com/806451): The Mac implementation currently blocks
@@ -168,15 +245,12 @@ void ChildProcessMonitor::Start(
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   child_process_ = std::move(child);
 
-  DCHECK(child_monitor_thread_);
-  child_monitor_thread_->task_runner()->PostTask(
-      FROM_HERE,
-      base::BindOnce(
-          &MonitorChild, child_process_.Handle(),
-          base::BindPostTask(base::SequencedTaskRunnerHandle::Get(),
-                             base::BindOnce(&ChildProcessMonitor::OnChildCrash,
-                                            weak_ptr_factory_.GetWeakPtr(),
-                                            std::move(callback)))));
+  SharedChildMonitor::GetInstance()->Register(
+      child_process_.Handle(),
+      base::BindPostTask(base::SequencedTaskRunnerHandle::Get(),
+                         base::BindOnce(&ChildProcessMonitor::OnChildCrash,
+                                        weak_ptr_factory_.GetWeakPtr(),
+                                        std::move(callback))));
 }
 
 void ChildProcessMonitor::OnChildCrash(
@@ -6,18 +6,16 @@
 #ifndef BRAVE_COMPONENTS_CHILD_PROCESS_MONITOR_CHILD_PROCESS_MONITOR_H_
 #define BRAVE_COMPONENTS_CHILD_PROCESS_MONITOR_CHILD_PROCESS_MONITOR_H_
 
-#include <memory>
-
 #include "base/callback.h"
 #include "base/memory/weak_ptr.h"
 #include "base/process/process.h"
 #include "base/sequence_checker.h"
-#include "base/threading/thread.h"
 
 namespace brave {
 
-// This class can only be used once per utility process to monitor the lifetime
-// of external process, ex. IpfsServiceImpl and TorLauncherImpl
+// Monitors the lifetime of an external process, ex. IpfsServiceImpl and
+// TorLauncherImpl. All instances in a process share one monitor thread
+// which multiplexes the waits, so each instance is cheap.
 class ChildProcessMonitor {
  public:
   ChildProcessMonitor();
@@ -33,7 +31,6 @@ class ChildProcessMonitor {
                     base::ProcessId pid);
 
   base::Process child_process_;
-  std::unique_ptr<base::Thread> child_monitor_thread_;
 
   SEQUENCE_CHECKER(sequence_checker_);
 
@@ -5,10 +5,14 @@
 
 #include "brave/components/content_settings/core/browser/brave_content_settings_pref_provider.h"
 
+#include <map>
 #include <memory>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/bind.h"
+#include "base/no_destructor.h"
 #include "base/task/post_task.h"
 #include "brave/common/network_constants.h"
 #include "brave/common/pref_names.h"
@@ -40,6 +44,13 @@ const char kSessionModelPath[] = "model";
 const char kSettingPath[] = "setting";
 const char kPerResourcePath[] = "per_resource";
 
+// Parsed once as cloning runs for every rule on every query.
+const ContentSettingsPattern& FirstPartyPattern() {
+  static const base::NoDestructor<ContentSettingsPattern> pattern(
+      ContentSettingsPattern::FromString("https://firstParty/*"));
+  return *pattern;
+}
+
 Rule CloneRule(const Rule& rule, bool reverse_patterns = false) {
   // brave plugin rules incorrectly use first party url as primary
   auto primary_pattern = reverse_patterns ? rule.secondary_pattern
@@ -47,8 +58,7 @@ Rule CloneRule(const Rule& rule, bool reverse_patterns = false) {
   auto secondary_pattern = reverse_patterns ? rule.primary_pattern
                                             : rule.secondary_pattern;
 
-  if (primary_pattern ==
-      ContentSettingsPattern::FromString("https://firstParty/*")) {
+  if (primary_pattern == FirstPartyPattern()) {
     DCHECK(reverse_patterns);  // we should only hit this for brave plugin rules
     if (!secondary_pattern.MatchesAllHosts()) {
       primary_pattern = ContentSettingsPattern::FromString(
@@ -78,29 +88,81 @@ class BraveShieldsRuleIterator : public RuleIterator {
   }
 
   Rule Next() override {
-    return CloneRule(*(iterator_++));
+    // The rules were already cloned into this iterator, so each one can be
+    // handed out by move instead of cloning its value a second time.
+    return std::move(*(iterator_++));
   }
 
  private:
   std::vector<Rule> rules_;
-  std::vector<Rule>::const_iterator iterator_;
+  std::vector<Rule>::iterator iterator_;
 
   DISALLOW_COPY_AND_ASSIGN(BraveShieldsRuleIterator);
 };
 
 
-bool IsActive(const Rule& cookie_rule,
-              const std::vector<Rule>& shield_rules) {
+std::string GetRegistrableDomainForPattern(
+    const ContentSettingsPattern& pattern) {
+  return net::registry_controlled_domains::GetDomainAndRegistry(
+      pattern.GetHost(),
+      net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES);
+}
+
+// Shield rules indexed by the registrable domain of their primary pattern,
+// so that each cookie rule is only compared against the shield rules that
+// can possibly cover it. A pattern can only cover hosts under its own
+// registrable domain, so rules whose pattern host has none (IP addresses,
+// single-label hosts) go into the unkeyed list and are always compared.
+// Both the buckets and the unkeyed list keep the original rule order.
+struct ShieldRuleIndex {
+  explicit ShieldRuleIndex(const std::vector<Rule>& rules) : rules(rules) {
+    for (size_t i = 0; i < rules.size(); ++i) {
+      const std::string domain =
+          GetRegistrableDomainForPattern(rules[i].primary_pattern);
+      if (domain.empty()) {
+        unkeyed.push_back(i);
+      } else {
+        by_domain[domain].push_back(i);
+      }
+    }
+  }
+
+  const std::vector<Rule>& rules;
+  std::map<std::string, std::vector<size_t>> by_domain;
+  std::vector<size_t> unkeyed;
+};
+
+bool IsActive(const Rule& cookie_rule, const ShieldRuleIndex& shield_rules) {
   // don't include default rules in the iterator
   if (cookie_rule.primary_pattern == ContentSettingsPattern::Wildcard() &&
       (cookie_rule.secondary_pattern == ContentSettingsPattern::Wildcard() ||
-       cookie_rule.secondary_pattern ==
-          ContentSettingsPattern::FromString("https://firstParty/*"))) {
+       cookie_rule.secondary_pattern == FirstPartyPattern())) {
     return false;
   }
 
-  bool default_value = true;
-  for (const auto& shield_rule : shield_rules) {
+  const std::vector<size_t> no_rules;
+  const std::string domain =
+      GetRegistrableDomainForPattern(cookie_rule.primary_pattern);
+  const auto bucket_it = shield_rules.by_domain.find(domain);
+  const std::vector<size_t>& bucket =
+      bucket_it != shield_rules.by_domain.end() ? bucket_it->second : no_rules;
+  const std::vector<size_t>& unkeyed = shield_rules.unkeyed;
+
+  // Walk the domain bucket and the unkeyed rules merged in original rule
+  // order, since the first shield rule that covers the cookie rule decides.
+  size_t bucket_pos = 0;
+  size_t unkeyed_pos = 0;
+  while (bucket_pos < bucket.size() || unkeyed_pos < unkeyed.size()) {
+    size_t index;
+    if (unkeyed_pos == unkeyed.size() ||
+        (bucket_pos < bucket.size() &&
+         bucket[bucket_pos] < unkeyed[unkeyed_pos])) {
+      index = bucket[bucket_pos++];
+    } else {
+      index = unkeyed[unkeyed_pos++];
+    }
+
+    const Rule& shield_rule = shield_rules.rules[index];
     auto primary_compare =
         shield_rule.primary_pattern.Compare(cookie_rule.primary_pattern);
     // TODO(bridiver) - verify that SUCCESSOR is correct and not PREDECESSOR
@@ -112,7 +174,7 @@ bool IsActive(const Rule& cookie_rule,
     }
   }
 
-  return default_value;
+  return true;
 }
 
 }  // namespace
@@ -498,6 +560,10 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
 
   brave_shields_iterator.reset();
 
+  // Index the shield rules by registrable domain once, rather than comparing
+  // every cookie rule against every shield rule below.
+  const ShieldRuleIndex shield_rule_index(shield_rules);
+
   // add brave cookies after checking shield status
   auto brave_cookies_iterator = PrefProvider::GetRuleIterator(
       ContentSettingsType::BRAVE_COOKIES, incognito);
@@ -505,7 +571,7 @@ void BravePrefProvider::UpdateCookieRules(ContentSettingsType content_type,
   // Matching cookie rules against shield rules.
   while (brave_cookies_iterator && brave_cookies_iterator->HasNext()) {
     auto rule = brave_cookies_iterator->Next();
-    if (IsActive(rule, shield_rules)) {
+    if (IsActive(rule, shield_rule_index)) {
       rules.emplace_back(CloneRule(rule, true));
       brave_cookie_rules_[incognito].emplace_back(CloneRule(rule, true));
     }
@@ -90,6 +90,10 @@ void BraveContentSettingsAgentImpl::DidCommitProvisionalLoad(
     ui::PageTransition transition) {
   temporarily_allowed_scripts_ =
       std::move(preloaded_temporarily_allowed_scripts_);
+  cached_shields_down_.clear();
+  cached_farbling_level_.reset();
+  cached_frame_origin_url_.reset();
+  cached_frame_shields_down_.reset();
   ContentSettingsAgentImpl::DidCommitProvisionalLoad(transition);
 }
 
@@ -114,12 +118,9 @@ bool BraveContentSettingsAgentImpl::AllowScript(bool enabled_per_settings) {
   // without calling `AllowScriptFromSource` first
   blocked_script_url_ = GURL::EmptyGURL();
 
-  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
-  const GURL secondary_url(url::Origin(frame->GetSecurityOrigin()).GetURL());
-
   bool allow = ContentSettingsAgentImpl::AllowScript(enabled_per_settings);
-  allow = allow || IsBraveShieldsDown(frame, secondary_url) ||
-          IsScriptTemporilyAllowed(secondary_url);
+  allow = allow || IsBraveShieldsDownForFrameOrigin() ||
+          IsScriptTemporilyAllowed(GetFrameOriginURL());
 
   return allow;
 }
@@ -206,18 +207,48 @@ bool BraveContentSettingsAgentImpl::AllowScriptFromSource(
 bool BraveContentSettingsAgentImpl::IsBraveShieldsDown(
     const blink::WebFrame* frame,
     const GURL& secondary_url) {
-  return !content_setting_rules_ ||
-         ::content_settings::IsBraveShieldsDown(
-             frame, secondary_url, content_setting_rules_->brave_shields_rules);
+  if (!content_setting_rules_)
+    return true;
+
+  const std::string key = secondary_url.possibly_invalid_spec();
+  const auto cached = cached_shields_down_.find(key);
+  if (cached != cached_shields_down_.end())
+    return cached->second;
+
+  const bool shields_down = ::content_settings::IsBraveShieldsDown(
+      frame, secondary_url, content_setting_rules_->brave_shields_rules);
+  cached_shields_down_[key] = shields_down;
+  return shields_down;
+}
+
+const GURL& BraveContentSettingsAgentImpl::GetFrameOriginURL() {
+  if (!cached_frame_origin_url_) {
+    blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
+    cached_frame_origin_url_ =
+        url::Origin(frame->GetSecurityOrigin()).GetURL();
+  }
+  return *cached_frame_origin_url_;
+}
+
+bool BraveContentSettingsAgentImpl::IsBraveShieldsDownForFrameOrigin() {
+  if (!content_setting_rules_)
+    return true;
+
+  if (cached_frame_shields_down_)
+    return *cached_frame_shields_down_;
+
+  const bool shields_down = ::content_settings::IsBraveShieldsDown(
+      render_frame()->GetWebFrame(), GetFrameOriginURL(),
+      content_setting_rules_->brave_shields_rules);
+  cached_frame_shields_down_ = shields_down;
+  return shields_down;
 }
 
 bool BraveContentSettingsAgentImpl::AllowFingerprinting(
     bool enabled_per_settings) {
   if (!enabled_per_settings)
     return false;
-  blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
-  const GURL secondary_url(url::Origin(frame->GetSecurityOrigin()).GetURL());
-  if (IsBraveShieldsDown(frame, secondary_url)) {
+  if (IsBraveShieldsDownForFrameOrigin()) {
     return true;
   }
 
@@ -225,12 +256,14 @@ bool BraveContentSettingsAgentImpl::AllowFingerprinting(
 }
 
 BraveFarblingLevel BraveContentSettingsAgentImpl::GetBraveFarblingLevel() {
+  if (cached_farbling_level_)
+    return *cached_farbling_level_;
+
   blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
 
   ContentSetting setting = CONTENT_SETTING_DEFAULT;
   if (content_setting_rules_) {
-    if (IsBraveShieldsDown(frame,
-                           url::Origin(frame->GetSecurityOrigin()).GetURL())) {
+    if (IsBraveShieldsDownForFrameOrigin()) {
       setting = CONTENT_SETTING_ALLOW;
     } else {
       setting = GetBraveFPContentSettingFromRules(
@@ -238,16 +271,22 @@ BraveFarblingLevel BraveContentSettingsAgentImpl::GetBraveFarblingLevel() {
     }
   }
 
+  BraveFarblingLevel level = BraveFarblingLevel::BALANCED;
   if (setting == CONTENT_SETTING_BLOCK) {
     VLOG(1) << "farbling level MAXIMUM";
-    return BraveFarblingLevel::MAXIMUM;
+    level = BraveFarblingLevel::MAXIMUM;
   } else if (setting == CONTENT_SETTING_ALLOW) {
     VLOG(1) << "farbling level OFF";
-    return BraveFarblingLevel::OFF;
+    level = BraveFarblingLevel::OFF;
   } else {
     VLOG(1) << "farbling level BALANCED";
-    return BraveFarblingLevel::BALANCED;
   }
+
+  // Only remember the answer once rules have been pushed; before that the
+  // default must not stick for the rest of the document
+  if (content_setting_rules_)
+    cached_farbling_level_ = level;
+  return level;
 }
 
 bool BraveContentSettingsAgentImpl::AllowAutoplay(bool play_requested) {
@@ -21,6 +21,7 @@
 #include "mojo/public/cpp/bindings/associated_receiver_set.h"
 #include "mojo/public/cpp/bindings/associated_remote.h"
 #include "mojo/public/cpp/bindings/pending_associated_receiver.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 #include "url/gurl.h"
 
@@ -67,6 +68,16 @@ class BraveContentSettingsAgentImpl
       const blink::WebFrame* frame,
       const GURL& secondary_url);
 
+  // Returns the frame's own origin as a URL, serializing it only on the
+  // first call per document. Most policy checks (scripts, fingerprinting,
+  // cookie access) ask about the frame's own origin, so this avoids
+  // re-serializing the security origin on every one of them.
+  const GURL& GetFrameOriginURL();
+
+  // IsBraveShieldsDown() for the frame's own origin, answered from a
+  // dedicated per-document verdict without building a string key.
+  bool IsBraveShieldsDownForFrameOrigin();
+
   // RenderFrameObserver
   void DidCommitProvisionalLoad(ui::PageTransition transition) override;
 
@@ -98,6 +109,15 @@ class BraveContentSettingsAgentImpl
   using StoragePermissionsKey = std::pair<url::Origin, StorageType>;
   base::flat_map<StoragePermissionsKey, bool> cached_storage_permissions_;
 
+  // Per-document decision caches. Shields and farbling state cannot change
+  // for a committed document without a reload, and these checks run for
+  // every script element, so the pattern matching is done once per origin
+  // and reused. Cleared on commit.
+  base::flat_map<std::string, bool> cached_shields_down_;
+  absl::optional<BraveFarblingLevel> cached_farbling_level_;
+  absl::optional<GURL> cached_frame_origin_url_;
+  absl::optional<bool> cached_frame_shields_down_;
+
   mojo::AssociatedRemote<brave_shields::mojom::BraveShieldsHost>
       brave_shields_remote_;
 
@@ -94,7 +94,9 @@ void CosmeticFiltersResources::ShouldDoCosmeticFiltering(
   bool first_party_enabled =
       brave_shields::IsFirstPartyCosmeticFilteringEnabled(settings_map_,
                                                           GURL(url));
-  std::move(callback).Run(enabled, first_party_enabled);
+  std::move(callback).Run(
+      enabled, first_party_enabled,
+      brave_shields::AdBlockBaseService::engine_generation());
 }
 
 void CosmeticFiltersResources::UrlCosmeticResources(
@@ -8,6 +8,7 @@
 #include <utility>
 
 #include "base/bind.h"
+#include "base/containers/mru_cache.h"
 #include "base/json/json_writer.h"
 #include "base/no_destructor.h"
 #include "base/strings/stringprintf.h"
@@ -163,6 +164,23 @@ std::string LoadDataResource(const int id) {
   return std::string(resource_bundle.GetRawDataResource(id));
 }
 
+// Cosmetic resources for recently visited URLs, shared across frames in this
+// renderer process. Entries are only reused while the adblock engine
+// generation they were computed against is still current.
+struct CachedUrlResources {
+  uint64_t generation = 0;
+  base::Value resources;
+};
+
+constexpr size_t kUrlResourcesCacheSize = 32;
+
+base::HashingMRUCache<std::string, CachedUrlResources>& GetUrlResourcesCache() {
+  static base::NoDestructor<
+      base::HashingMRUCache<std::string, CachedUrlResources>>
+      cache(kUrlResourcesCacheSize);
+  return *cache;
+}
+
 bool IsVettedSearchEngine(const GURL& url) {
   std::string domain_and_registry =
       net::registry_controlled_domains::GetDomainAndRegistry(
@@ -292,11 +310,26 @@ void CosmeticFiltersJSHandler::ProcessURL(const GURL& url,
 void CosmeticFiltersJSHandler::OnShouldDoCosmeticFiltering(
     base::OnceClosure callback,
     bool enabled,
-    bool first_party_enabled) {
+    bool first_party_enabled,
+    uint64_t generation) {
   if (!enabled || !EnsureConnected())
     return;
 
   enabled_1st_party_cf_ = first_party_enabled;
+
+  // Repeat navigations hit the renderer-side cache and skip the browser
+  // round trip entirely, as long as no engine update happened since the
+  // entry was stored.
+  auto it = GetUrlResourcesCache().Get(url_.spec());
+  if (it != GetUrlResourcesCache().end() &&
+      it->second.generation == generation) {
+    resources_dict_ = base::DictionaryValue::From(
+        base::Value::ToUniquePtrValue(it->second.resources.Clone()));
+    std::move(callback).Run();
+    return;
+  }
+
+  pending_generation_ = generation;
   cosmetic_filters_resources_->UrlCosmeticResources(
       url_.spec(),
       base::BindOnce(&CosmeticFiltersJSHandler::OnUrlCosmeticResources,
@@ -306,6 +339,12 @@ void CosmeticFiltersJSHandler::OnShouldDoCosmeticFiltering(
 void CosmeticFiltersJSHandler::OnUrlCosmeticResources(
     base::OnceClosure callback,
     base::Value result) {
+  if (result.is_dict()) {
+    CachedUrlResources entry;
+    entry.generation = pending_generation_;
+    entry.resources = result.Clone();
+    GetUrlResourcesCache().Put(url_.spec(), std::move(entry));
+  }
   resources_dict_ = base::DictionaryValue::From(
       base::Value::ToUniquePtrValue(std::move(result)));
   std::move(callback).Run();
@@ -54,7 +54,8 @@ class CosmeticFiltersJSHandler {
 
   void OnShouldDoCosmeticFiltering(base::OnceClosure callback,
                                    bool enabled,
-                                   bool first_party_enabled);
+                                   bool first_party_enabled,
+                                   uint64_t generation);
   void OnUrlCosmeticResources(base::OnceClosure callback, base::Value result);
   void CSSRulesRoutine(base::DictionaryValue* resources_dict);
   void OnHiddenClassIdSelectors(base::Value result);
@@ -67,6 +68,9 @@ class CosmeticFiltersJSHandler {
   std::vector<std::string> exceptions_;
   GURL url_;
   std::unique_ptr<base::DictionaryValue> resources_dict_;
+  // Engine generation reported for the in-flight UrlCosmeticResources query;
+  // recorded with the cached result so stale entries are detected.
+  uint64_t pending_generation_ = 0;
 };
 
 // static
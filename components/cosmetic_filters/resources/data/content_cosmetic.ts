@@ -109,6 +109,21 @@ const fetchNewClassIdRules = () => {
   notYetQueriedIds = []
 }
 
+// Mutation bursts (e.g. infinite scrollers appending many nodes per frame)
+// are coalesced over an animation frame so at most one selector query is
+// issued per frame instead of one per MutationObserver callback.
+let fetchScheduled = false
+const scheduleFetchNewClassIdRules = () => {
+  if (fetchScheduled) {
+    return
+  }
+  fetchScheduled = true
+  window.requestAnimationFrame(() => {
+    fetchScheduled = false
+    fetchNewClassIdRules()
+  })
+}
+
 const handleMutations: MutationCallback = (mutations: MutationRecord[]) => {
   for (const aMutation of mutations) {
     if (aMutation.type === 'attributes') {
@@ -157,7 +172,7 @@ const handleMutations: MutationCallback = (mutations: MutationRecord[]) => {
     }
   }
 
-  fetchNewClassIdRules()
+  scheduleFetchNewClassIdRules()
 }
 
 const _parseDomainCache = Object.create(null)
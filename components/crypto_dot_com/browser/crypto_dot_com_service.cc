@@ -35,6 +35,13 @@ const char root_host[] = "crypto.com";
 const char api_host[] = "api.crypto.com";
 const unsigned int kRetriesCountOnNetworkChange = 1;
 
+// Market data moves quickly, but every open NTP refires the same fetches, so
+// decoded responses are shared across instances for a short window. The
+// instrument list changes rarely and can be reused much longer.
+constexpr base::TimeDelta kMarketDataCacheTtl =
+    base::TimeDelta::FromSeconds(30);
+constexpr base::TimeDelta kPairsCacheTtl = base::TimeDelta::FromHours(1);
+
 net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
   return net::DefineNetworkTrafficAnnotation("crypto_dot_com_service", R"(
       semantics {
@@ -79,8 +86,21 @@ CryptoDotComService::~CryptoDotComService() {
 
 bool CryptoDotComService::GetTickerInfo(const std::string& asset,
                                         GetTickerInfoCallback callback) {
+  auto cached = ticker_cache_.find(asset);
+  if (cached != ticker_cache_.end() &&
+      base::TimeTicks::Now() - cached->second.first < kMarketDataCacheTtl) {
+    std::move(callback).Run(cached->second.second);
+    return true;
+  }
+
+  auto& pending = pending_ticker_requests_[asset];
+  pending.push_back(std::move(callback));
+  if (pending.size() > 1) {
+    return true;
+  }
+
   auto internal_callback = base::BindOnce(&CryptoDotComService::OnTickerInfo,
-      base::Unretained(this), std::move(callback));
+      base::Unretained(this), asset);
   GURL url = GetURLWithPath(api_host, get_ticker_info_path);
   url = net::AppendQueryParameter(url, "instrument_name", asset);
   return NetworkRequest(
@@ -88,21 +108,40 @@ bool CryptoDotComService::GetTickerInfo(const std::string& asset,
 }
 
 void CryptoDotComService::OnTickerInfo(
-  GetTickerInfoCallback callback,
+  const std::string& asset,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   CryptoDotComTickerInfo info;
   if (status >= 200 && status <= 299) {
     const std::string json_body = GetFormattedResponseBody(body);
     CryptoDotComJSONParser::GetTickerInfoFromJSON(json_body, &info);
+    ticker_cache_[asset] = std::make_pair(base::TimeTicks::Now(), info);
+  }
+
+  auto callbacks = std::move(pending_ticker_requests_[asset]);
+  pending_ticker_requests_.erase(asset);
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(info);
   }
-  std::move(callback).Run(info);
 }
 
 bool CryptoDotComService::GetChartData(const std::string& asset,
                                        GetChartDataCallback callback) {
+  auto cached = chart_cache_.find(asset);
+  if (cached != chart_cache_.end() &&
+      base::TimeTicks::Now() - cached->second.first < kMarketDataCacheTtl) {
+    std::move(callback).Run(cached->second.second);
+    return true;
+  }
+
+  auto& pending = pending_chart_requests_[asset];
+  pending.push_back(std::move(callback));
+  if (pending.size() > 1) {
+    return true;
+  }
+
   auto internal_callback = base::BindOnce(&CryptoDotComService::OnChartData,
-      base::Unretained(this), std::move(callback));
+      base::Unretained(this), asset);
   GURL url = GetURLWithPath(api_host, get_chart_data_path);
   url = net::AppendQueryParameter(url, "instrument_name", asset);
   url = net::AppendQueryParameter(url, "timeframe", "4h");
@@ -112,59 +151,99 @@ bool CryptoDotComService::GetChartData(const std::string& asset,
 }
 
 void CryptoDotComService::OnChartData(
-  GetChartDataCallback callback,
+  const std::string& asset,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   CryptoDotComChartData data;
   if (status >= 200 && status <= 299) {
     const std::string json_body = GetFormattedResponseBody(body);
     CryptoDotComJSONParser::GetChartDataFromJSON(json_body, &data);
+    chart_cache_[asset] = std::make_pair(base::TimeTicks::Now(), data);
+  }
+
+  auto callbacks = std::move(pending_chart_requests_[asset]);
+  pending_chart_requests_.erase(asset);
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(data);
   }
-  std::move(callback).Run(data);
 }
 
 bool CryptoDotComService::GetSupportedPairs(
     GetSupportedPairsCallback callback) {
+  if (!pairs_cache_.empty() &&
+      base::TimeTicks::Now() - pairs_fetched_at_ < kPairsCacheTtl) {
+    std::move(callback).Run(pairs_cache_);
+    return true;
+  }
+
+  pending_pairs_requests_.push_back(std::move(callback));
+  if (pending_pairs_requests_.size() > 1) {
+    return true;
+  }
+
   auto internal_callback = base::BindOnce(
       &CryptoDotComService::OnSupportedPairs,
-      base::Unretained(this), std::move(callback));
+      base::Unretained(this));
   GURL url = GetURLWithPath(api_host, get_pairs_path);
   return NetworkRequest(
       url, "GET", "", std::move(internal_callback));
 }
 
 void CryptoDotComService::OnSupportedPairs(
-  GetSupportedPairsCallback callback,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   CryptoDotComSupportedPairs pairs;
   if (status >= 200 && status <= 299) {
     const std::string json_body = GetFormattedResponseBody(body);
     CryptoDotComJSONParser::GetPairsFromJSON(json_body, &pairs);
+    pairs_cache_ = pairs;
+    pairs_fetched_at_ = base::TimeTicks::Now();
+  }
+
+  auto callbacks = std::move(pending_pairs_requests_);
+  pending_pairs_requests_.clear();
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(pairs);
   }
-  std::move(callback).Run(pairs);
 }
 
 bool CryptoDotComService::GetAssetRankings(
     GetAssetRankingsCallback callback) {
+  if (!rankings_cache_.empty() &&
+      base::TimeTicks::Now() - rankings_fetched_at_ < kMarketDataCacheTtl) {
+    std::move(callback).Run(rankings_cache_);
+    return true;
+  }
+
+  pending_rankings_requests_.push_back(std::move(callback));
+  if (pending_rankings_requests_.size() > 1) {
+    return true;
+  }
+
   auto internal_callback = base::BindOnce(
       &CryptoDotComService::OnAssetRankings,
-      base::Unretained(this), std::move(callback));
+      base::Unretained(this));
   GURL url = GetURLWithPath(root_host, get_gainers_losers_path);
   return NetworkRequest(
       url, "GET", "", std::move(internal_callback));
 }
 
 void CryptoDotComService::OnAssetRankings(
-    GetAssetRankingsCallback callback,
     const int status, const std::string& body,
     const std::map<std::string, std::string>& headers) {
   CryptoDotComAssetRankings rankings;
   if (status >= 200 && status <= 299) {
     const std::string json_body = GetFormattedResponseBody(body);
     CryptoDotComJSONParser::GetRankingsFromJSON(json_body, &rankings);
+    rankings_cache_ = rankings;
+    rankings_fetched_at_ = base::TimeTicks::Now();
+  }
+
+  auto callbacks = std::move(pending_rankings_requests_);
+  pending_rankings_requests_.clear();
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(rankings);
   }
-  std::move(callback).Run(rankings);
 }
 
 bool CryptoDotComService::NetworkRequest(const GURL &url,
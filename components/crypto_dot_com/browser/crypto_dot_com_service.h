@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/callback_forward.h"
@@ -18,6 +19,7 @@
 #include "base/macros.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "url/gurl.h"
 
@@ -79,17 +81,15 @@ class CryptoDotComService : public KeyedService {
 
   base::SequencedTaskRunner* io_task_runner();
 
-  void OnTickerInfo(GetTickerInfoCallback callback,
+  void OnTickerInfo(const std::string& asset,
                     const int status, const std::string& body,
                     const std::map<std::string, std::string>& headers);
-  void OnChartData(GetChartDataCallback callback,
+  void OnChartData(const std::string& asset,
                    const int status, const std::string& body,
                    const std::map<std::string, std::string>& headers);
-  void OnSupportedPairs(GetSupportedPairsCallback callback,
-                        const int status, const std::string& body,
+  void OnSupportedPairs(const int status, const std::string& body,
                         const std::map<std::string, std::string>& headers);
-  void OnAssetRankings(GetAssetRankingsCallback callback,
-                       const int status, const std::string& body,
+  void OnAssetRankings(const int status, const std::string& body,
                        const std::map<std::string, std::string>& headers);
 
   bool NetworkRequest(const GURL& url, const std::string& method,
@@ -101,6 +101,24 @@ class CryptoDotComService : public KeyedService {
 
   scoped_refptr<base::SequencedTaskRunner> io_task_runner_;
 
+  // Decoded responses are cached on this profile-wide service so every open
+  // NTP shares one fetch per endpoint, and concurrent requests for the same
+  // data are coalesced onto the in-flight one
+  std::map<std::string, std::pair<base::TimeTicks, CryptoDotComTickerInfo>>
+      ticker_cache_;
+  std::map<std::string, std::vector<GetTickerInfoCallback>>
+      pending_ticker_requests_;
+  std::map<std::string, std::pair<base::TimeTicks, CryptoDotComChartData>>
+      chart_cache_;
+  std::map<std::string, std::vector<GetChartDataCallback>>
+      pending_chart_requests_;
+  base::TimeTicks pairs_fetched_at_;
+  CryptoDotComSupportedPairs pairs_cache_;
+  std::vector<GetSupportedPairsCallback> pending_pairs_requests_;
+  base::TimeTicks rankings_fetched_at_;
+  CryptoDotComAssetRankings rankings_cache_;
+  std::vector<GetAssetRankingsCallback> pending_rankings_requests_;
+
   content::BrowserContext* context_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   SimpleURLLoaderList url_loaders_;
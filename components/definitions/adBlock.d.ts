@@ -8,6 +8,25 @@ declare namespace AdBlock {
       customFilters: string
       regionalLists: FilterList[]
     }
+    stats?: EngineStats
+  }
+
+  export interface EngineStats {
+    verdictCacheHits: number
+    verdictCacheMisses: number
+    coalescedRequests: number
+    matchSampleCount: number
+    matchMeanTimeMs: number
+    listHitReport: {
+      total_queries: number
+      list_hits: ListHitCount[]
+    }
+  }
+
+  export interface ListHitCount {
+    uuid: string
+    title?: string
+    hits: number
   }
 
   export interface FilterList {
@@ -0,0 +1,18 @@
+declare namespace BravePerformance {
+  export interface ApplicationState {
+    performanceData: State | undefined
+  }
+
+  export interface State {
+    timingStats: TimingStat[]
+  }
+
+  export interface TimingStat {
+    histogram: string,
+    subsystem: string,
+    description: string,
+    sampleCount: number,
+    meanTimeMs: number,
+    totalTimeMs: number
+  }
+}
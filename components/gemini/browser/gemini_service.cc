@@ -43,6 +43,16 @@ namespace {
   const char oauth_scope[] = "addresses:read,balances:read,orders:create";
   const char oauth_url[] = "https://exchange.gemini.com/auth";
   const unsigned int kRetriesCountOnNetworkChange = 1;
+  // How long a fetched ticker price answers later requests for the same
+  // symbol. Widget refreshes from other open NTPs inside this window reuse
+  // the price instead of pulling another snapshot.
+  constexpr base::TimeDelta kTickerPriceExpiration =
+      base::TimeDelta::FromSeconds(30);
+  // How long a freshly obtained access token answers later refresh
+  // requests without another OAuth round trip. Widgets ask for a refresh
+  // on every load, far more often than the token actually expires.
+  constexpr base::TimeDelta kAccessTokenFreshness =
+      base::TimeDelta::FromMinutes(10);
 
   net::NetworkTrafficAnnotationTag GetNetworkTrafficAnnotationTag() {
     return net::DefineNetworkTrafficAnnotation("gemini_service", R"(
@@ -189,8 +199,23 @@ bool GeminiService::GetAccessToken(AccessTokenCallback callback) {
 }
 
 bool GeminiService::RefreshAccessToken(AccessTokenCallback callback) {
-  auto internal_callback = base::BindOnce(&GeminiService::OnGetAccessToken,
-      base::Unretained(this), std::move(callback));
+  // A token refreshed inside the freshness window is still good; answer
+  // from here so widget refreshes never block on a token round trip.
+  if (!access_token_.empty() && !access_token_refreshed_at_.is_null() &&
+      base::TimeTicks::Now() - access_token_refreshed_at_ <
+          kAccessTokenFreshness) {
+    std::move(callback).Run(true);
+    return true;
+  }
+
+  pending_refresh_callbacks_.push_back(std::move(callback));
+  if (pending_refresh_callbacks_.size() > 1) {
+    // A refresh is already on its way; share its result.
+    return true;
+  }
+
+  auto internal_callback = base::BindOnce(&GeminiService::OnRefreshAccessToken,
+      base::Unretained(this));
   GURL base_url = GetURLWithPath(oauth_host_, auth_path_access_token);
 
   base::Value dict(base::Value::Type::DICTIONARY);
@@ -201,9 +226,13 @@ bool GeminiService::RefreshAccessToken(AccessTokenCallback callback) {
   std::string request_body = CreateJSONRequestBody(dict);
 
   auth_token_.clear();
-  return OAuthRequest(
-      base_url, "POST", request_body,
-      std::move(internal_callback), true, false, "");
+  if (!OAuthRequest(
+          base_url, "POST", request_body,
+          std::move(internal_callback), true, false, "")) {
+    pending_refresh_callbacks_.clear();
+    return false;
+  }
+  return true;
 }
 
 void GeminiService::OnGetAccessToken(
@@ -216,28 +245,76 @@ void GeminiService::OnGetAccessToken(
     GeminiJSONParser::GetTokensFromJSON(body, &access_token, &refresh_token);
     SetAccessTokens(access_token, refresh_token);
   }
-  std::move(callback).Run(!access_token.empty() && !refresh_token.empty());
+  const bool success = !access_token.empty() && !refresh_token.empty();
+  if (success) {
+    access_token_refreshed_at_ = base::TimeTicks::Now();
+  }
+  std::move(callback).Run(success);
+}
+
+void GeminiService::OnRefreshAccessToken(
+    const int status, const std::string& body,
+    const std::map<std::string, std::string>& headers) {
+  std::string access_token;
+  std::string refresh_token;
+  if (status >= 200 && status <= 299) {
+    GeminiJSONParser::GetTokensFromJSON(body, &access_token, &refresh_token);
+    SetAccessTokens(access_token, refresh_token);
+  }
+  const bool success = !access_token.empty() && !refresh_token.empty();
+  if (success) {
+    access_token_refreshed_at_ = base::TimeTicks::Now();
+  }
+  auto callbacks = std::move(pending_refresh_callbacks_);
+  pending_refresh_callbacks_.clear();
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(success);
+  }
 }
 
 bool GeminiService::GetTickerPrice(const std::string& asset,
                                    GetTickerPriceCallback callback) {
+  auto cached = ticker_price_cache_.find(asset);
+  if (cached != ticker_price_cache_.end() &&
+      base::TimeTicks::Now() - cached->second.fetched_at <
+          kTickerPriceExpiration) {
+    std::move(callback).Run(cached->second.price);
+    return true;
+  }
+
+  auto& pending = pending_ticker_price_callbacks_[asset];
+  pending.push_back(std::move(callback));
+  if (pending.size() > 1) {
+    // A fetch for this symbol is already on its way.
+    return true;
+  }
+
   auto internal_callback = base::BindOnce(&GeminiService::OnTickerPrice,
-      base::Unretained(this), std::move(callback));
+      base::Unretained(this), asset);
   GURL url = GetURLWithPath(api_host_,
     std::string(api_path_ticker_price) + "/" + asset);
-  return OAuthRequest(
-      url, "GET", "", std::move(internal_callback), true, false, "");
+  if (!OAuthRequest(
+          url, "GET", "", std::move(internal_callback), true, false, "")) {
+    pending_ticker_price_callbacks_.erase(asset);
+    return false;
+  }
+  return true;
 }
 
 void GeminiService::OnTickerPrice(
-  GetTickerPriceCallback callback,
+  const std::string& asset,
   const int status, const std::string& body,
   const std::map<std::string, std::string>& headers) {
   std::string price;
   if (status >= 200 && status <= 299) {
     GeminiJSONParser::GetTickerPriceFromJSON(body, &price);
+    ticker_price_cache_[asset] = {price, base::TimeTicks::Now()};
+  }
+  auto callbacks = std::move(pending_ticker_price_callbacks_[asset]);
+  pending_ticker_price_callbacks_.erase(asset);
+  for (auto& callback : callbacks) {
+    std::move(callback).Run(price);
   }
-  std::move(callback).Run(price);
 }
 
 bool GeminiService::GetAccountBalances(GetAccountBalancesCallback callback) {
@@ -429,6 +506,7 @@ bool GeminiService::LoadTokensFromPrefs() {
 void GeminiService::ResetAccessTokens() {
   access_token_ = "";
   refresh_token_ = "";
+  access_token_refreshed_at_ = base::TimeTicks();
 
   PrefService* prefs = user_prefs::UserPrefs::Get(context_);
   prefs->SetString(kGeminiAccessToken, access_token_);
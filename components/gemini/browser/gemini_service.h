@@ -13,11 +13,13 @@
 #include <vector>
 
 #include "base/callback_forward.h"
+#include "base/containers/flat_map.h"
 #include "base/containers/queue.h"
 #include "base/files/file_path.h"
 #include "base/macros.h"
 #include "base/memory/scoped_refptr.h"
 #include "base/memory/weak_ptr.h"
+#include "base/time/time.h"
 #include "components/keyed_service/core/keyed_service.h"
 #include "url/gurl.h"
 
@@ -111,7 +113,9 @@ class GeminiService : public KeyedService {
   void OnGetAccessToken(AccessTokenCallback callback,
                         const int status, const std::string& body,
                         const std::map<std::string, std::string>& headers);
-  void OnTickerPrice(GetTickerPriceCallback callback,
+  void OnRefreshAccessToken(const int status, const std::string& body,
+                            const std::map<std::string, std::string>& headers);
+  void OnTickerPrice(const std::string& asset,
                      const int status, const std::string& body,
                      const std::map<std::string, std::string>& headers);
   void OnGetAccountBalances(GetAccountBalancesCallback callback,
@@ -155,6 +159,23 @@ class GeminiService : public KeyedService {
   content::BrowserContext* context_;
   scoped_refptr<network::SharedURLLoaderFactory> url_loader_factory_;
   SimpleURLLoaderList url_loaders_;
+
+  // Ticker prices are public data which every open NTP polls for every
+  // widget symbol. Recently fetched prices are answered from here, and
+  // concurrent requests for the same symbol share one network fetch.
+  struct TickerPriceEntry {
+    std::string price;
+    base::TimeTicks fetched_at;
+  };
+  base::flat_map<std::string, TickerPriceEntry> ticker_price_cache_;
+  base::flat_map<std::string, std::vector<GetTickerPriceCallback>>
+      pending_ticker_price_callbacks_;
+
+  // Refreshes requested while a token round trip is in flight share its
+  // result, and a token obtained recently answers refreshes directly.
+  std::vector<AccessTokenCallback> pending_refresh_callbacks_;
+  base::TimeTicks access_token_refreshed_at_;
+
   base::WeakPtrFactory<GeminiService> weak_factory_;
 
   FRIEND_TEST_ALL_PREFIXES(GeminiAPIBrowserTest, GetOAuthClientURL);
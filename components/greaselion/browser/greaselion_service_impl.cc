@@ -208,6 +208,8 @@ GreaselionServiceImpl::GreaselionServiceImpl(
       update_in_progress_(false),
       update_pending_(false),
       pending_installs_(0),
+      installed_rules_generation_(0),
+      converted_rules_generation_(0),
       task_runner_(std::move(task_runner)),
       browser_version_(
           version_info::GetBraveVersionWithoutChromiumMajorVersion()),
@@ -233,11 +235,36 @@ GreaselionServiceImpl::GetExtensionIdsForTesting() {
   return greaselion_extensions_;
 }
 
+std::vector<std::string> GreaselionServiceImpl::GetMatchingRuleNames() {
+  std::vector<std::string> rule_names;
+  for (const std::unique_ptr<GreaselionRule>& rule :
+       *download_service_->rules()) {
+    if (rule->Matches(state_, browser_version_) &&
+        rule->has_unknown_preconditions() == false) {
+      rule_names.push_back(rule->name());
+    }
+  }
+  return rule_names;
+}
+
 void GreaselionServiceImpl::UpdateInstalledExtensions() {
   if (update_in_progress_) {
     update_pending_ = true;
     return;
   }
+  // Skip the uninstall/reinstall cycle if the set of matching rules is
+  // unchanged since the last update. This is the common case when a feature
+  // toggles without affecting any rule preconditions, e.g. for users with
+  // rewards disabled.
+  std::vector<std::string> matching_rule_names = GetMatchingRuleNames();
+  if (download_service_->rules_generation() == installed_rules_generation_ &&
+      matching_rule_names == installed_rule_names_) {
+    for (Observer& observer : observers_)
+      observer.OnExtensionsReady(this, all_rules_installed_successfully_);
+    return;
+  }
+  installed_rules_generation_ = download_service_->rules_generation();
+  installed_rule_names_ = std::move(matching_rule_names);
   update_in_progress_ = true;
   if (greaselion_extensions_.empty()) {
     // No Greaselion extensions are currently installed, so we can move on to
@@ -277,9 +304,27 @@ void GreaselionServiceImpl::CreateAndInstallExtensions() {
     MaybeNotifyObservers();
     return;
   }
+  if (converted_rules_generation_ != download_service_->rules_generation()) {
+    // Cached extension directories contain copies of scripts from a previous
+    // rules generation, so they cannot be reused.
+    converted_extensions_.clear();
+    converted_rules_generation_ = download_service_->rules_generation();
+  }
   for (const std::unique_ptr<GreaselionRule>& rule : *rules) {
     if (rule->Matches(state_, browser_version_) &&
         rule->has_unknown_preconditions() == false) {
+      auto cached_extension = converted_extensions_.find(rule->name());
+      if (cached_extension != converted_extensions_.end()) {
+        // This rule was already converted and its unpacked extension
+        // directory is still on disk, so it can be reinstalled without
+        // copying the script files again.
+        greaselion_extensions_.push_back(cached_extension->second.first->id());
+        extension_system_->ready().Post(
+            FROM_HERE, base::BindOnce(&GreaselionServiceImpl::Install,
+                                      weak_factory_.GetWeakPtr(),
+                                      cached_extension->second.first));
+        continue;
+      }
       // Convert script file to component extension. This must run on extension
       // file task runner, which was passed in in the constructor.
       GreaselionRule rule_copy(*rule);
@@ -301,12 +346,14 @@ void GreaselionServiceImpl::PostConvert(
     MaybeNotifyObservers();
     LOG(ERROR) << "Could not load Greaselion script";
   } else {
-    greaselion_extensions_.push_back(converted_extension->first->id());
-    extension_dirs_.push_back(std::move(converted_extension->second));
+    scoped_refptr<extensions::Extension> extension = converted_extension->first;
+    greaselion_extensions_.push_back(extension->id());
+    converted_extensions_[extension->name()] = std::make_pair(
+        extension, std::move(converted_extension->second));
     extension_system_->ready().Post(
         FROM_HERE, base::BindOnce(&GreaselionServiceImpl::Install,
                                   weak_factory_.GetWeakPtr(),
-                                  std::move(converted_extension->first)));
+                                  std::move(extension)));
   }
 }
 
@@ -6,6 +6,8 @@
 #ifndef BRAVE_COMPONENTS_GREASELION_BROWSER_GREASELION_SERVICE_IMPL_H_
 #define BRAVE_COMPONENTS_GREASELION_BROWSER_GREASELION_SERVICE_IMPL_H_
 
+#include <stdint.h>
+
 #include <map>
 #include <memory>
 #include <string>
@@ -69,6 +71,7 @@ class GreaselionServiceImpl : public GreaselionService {
 
  private:
   void SetBrowserVersionForTesting(const base::Version& version) override;
+  std::vector<std::string> GetMatchingRuleNames();
   void CreateAndInstallExtensions();
   void PostConvert(
       absl::optional<GreaselionConvertedExtension> converted_extension);
@@ -85,10 +88,20 @@ class GreaselionServiceImpl : public GreaselionService {
   bool update_in_progress_;
   bool update_pending_;
   int pending_installs_;
+  // Fingerprint of the last update cycle, used to skip the uninstall and
+  // reinstall churn when a feature toggle or a repeated rules notification
+  // does not change the set of matching rules.
+  uint64_t installed_rules_generation_;
+  std::vector<std::string> installed_rule_names_;
+  // Extensions already converted from rules, keyed by rule name and valid
+  // for a single rules generation. Reinstalling a cached rule reuses the
+  // unpacked extension directory on disk instead of copying the script
+  // files again.
+  uint64_t converted_rules_generation_;
+  std::map<std::string, GreaselionConvertedExtension> converted_extensions_;
   scoped_refptr<base::SequencedTaskRunner> task_runner_;
   base::ObserverList<Observer> observers_;
   std::vector<extensions::ExtensionId> greaselion_extensions_;
-  std::vector<base::ScopedTempDir> extension_dirs_;
   base::Version browser_version_;
   base::WeakPtrFactory<GreaselionServiceImpl> weak_factory_;
 
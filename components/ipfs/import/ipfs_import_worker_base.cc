@@ -11,6 +11,7 @@
 #include "base/files/file_util.h"
 #include "base/guid.h"
 #include "base/strings/strcat.h"
+#include "base/strings/string_piece.h"
 #include "base/strings/string_split.h"
 #include "base/strings/string_util.h"
 #include "base/strings/stringprintf.h"
@@ -143,15 +144,20 @@ void IpfsImportWorkerBase::UploadData(
 bool IpfsImportWorkerBase::ParseResponseBody(const std::string& response_body,
                                              ipfs::ImportedData* data) {
   DCHECK(data);
-  std::vector<std::string> parts = base::SplitString(
+  // The add response is newline-delimited JSON, one object per imported
+  // file, so a directory import of many files produces a large body.
+  // Split it into pieces without copying and only materialize the lines
+  // that look like JSON objects for the parser.
+  std::vector<base::StringPiece> parts = base::SplitStringPiece(
       response_body, "\n", base::KEEP_WHITESPACE, base::SPLIT_WANT_ALL);
   if (!parts.size())
     return IPFSJSONParser::GetImportResponseFromJSON(response_body, data);
   for (const auto& item : parts) {
-    if (item.front() != '{' || item.back() != '}')
+    if (item.empty() || item.front() != '{' || item.back() != '}')
       continue;
     ipfs::ImportedData imported_item;
-    if (IPFSJSONParser::GetImportResponseFromJSON(item, &imported_item)) {
+    if (IPFSJSONParser::GetImportResponseFromJSON(std::string(item),
+                                                  &imported_item)) {
       if (imported_item.filename != data->filename)
         continue;
       data->hash = imported_item.hash;
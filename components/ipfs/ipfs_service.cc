@@ -80,6 +80,16 @@ class ReentrancyCheck {
 const int kMinimalPeersRetryIntervalMs = 350;
 const int kPeersRetryRate = 3;
 
+// Parses a swarm/peers response off the UI thread.  Peer lists grow to
+// megabytes on well-connected nodes, and parsing them inline would jank
+// the UI thread on every poll.
+std::pair<bool, std::vector<std::string>> ParseConnectedPeers(
+    std::unique_ptr<std::string> response_body) {
+  std::vector<std::string> peers;
+  bool success = IPFSJSONParser::GetPeersFromJSON(*response_body, &peers);
+  return std::make_pair(success, std::move(peers));
+}
+
 std::pair<bool, std::string> LoadConfigFileOnFileTaskRunner(
     const base::FilePath& path) {
   std::string data;
@@ -535,21 +545,30 @@ void IpfsService::OnGetConnectedPeers(
     return;
   }
 
-  std::vector<std::string> peers;
   bool success = (error_code == net::OK && response_code == net::HTTP_OK);
   if (!success) {
     VLOG(1) << "Fail to get connected peers, error_code = " << error_code
             << " response_code = " << response_code;
+    OnConnectedPeersParsed(std::move(callback),
+                           std::make_pair(false, std::vector<std::string>()));
+    return;
   }
 
-  if (success)
-    success = IPFSJSONParser::GetPeersFromJSON(*response_body, &peers);
+  base::ThreadPool::PostTaskAndReplyWithResult(
+      FROM_HERE, {base::TaskPriority::USER_VISIBLE},
+      base::BindOnce(&ParseConnectedPeers, std::move(response_body)),
+      base::BindOnce(&IpfsService::OnConnectedPeersParsed,
+                     weak_factory_.GetWeakPtr(), std::move(callback)));
+}
 
+void IpfsService::OnConnectedPeersParsed(
+    GetConnectedPeersCallback callback,
+    std::pair<bool, std::vector<std::string>> result) {
   if (callback)
-    std::move(callback).Run(success, peers);
+    std::move(callback).Run(result.first, result.second);
 
   for (auto& observer : observers_) {
-    observer.OnGetConnectedPeers(success, peers);
+    observer.OnGetConnectedPeers(result.first, result.second);
   }
 }
 
@@ -181,6 +181,8 @@ class IpfsService : public KeyedService,
                            GetConnectedPeersCallback,
                            int retries,
                            std::unique_ptr<std::string> response_body);
+  void OnConnectedPeersParsed(GetConnectedPeersCallback callback,
+                              std::pair<bool, std::vector<std::string>> result);
   void OnGetAddressesConfig(SimpleURLLoaderList::iterator iter,
                             GetAddressesConfigCallback callback,
                             std::unique_ptr<std::string> response_body);
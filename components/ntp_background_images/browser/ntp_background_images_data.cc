@@ -224,7 +224,7 @@ bool NTPBackgroundImagesData::IsSuperReferral() const {
 }
 
 base::Value NTPBackgroundImagesData::GetBackgroundAt(size_t index) {
-  DCHECK(index >= 0 && index < wallpaper_image_urls().size());
+  DCHECK(index >= 0 && index < backgrounds.size());
 
   base::Value data(base::Value::Type::DICTIONARY);
   if (!IsValid())
@@ -233,7 +233,7 @@ base::Value NTPBackgroundImagesData::GetBackgroundAt(size_t index) {
   data.SetStringKey(kThemeNameKey, theme_name);
   data.SetBoolKey(kIsSponsoredKey, !IsSuperReferral());
   data.SetStringKey(kWallpaperImageURLKey,
-                    wallpaper_image_urls()[index]);
+                    wallpaper_image_url_at(index));
   data.SetStringKey(kWallpaperImagePathKey,
                     backgrounds[index].image_file.AsUTF8Unsafe());
   data.SetIntKey(kWallpaperFocalPointXKey, backgrounds[index].focal_point.x());
@@ -271,12 +271,15 @@ std::vector<TopSite> NTPBackgroundImagesData::GetTopSitesForWebUI() const {
 
 std::vector<std::string> NTPBackgroundImagesData::wallpaper_image_urls() const {
   std::vector<std::string> wallpaper_image_urls;
-  for (size_t i = 0; i < backgrounds.size(); i++) {
-    const std::string wallpaper_image_url = GetURLPrefix() + base::StringPrintf(
-        "%s%zu.jpg", kWallpaperPathPrefix, i);
-    wallpaper_image_urls.push_back(wallpaper_image_url);
-  }
+  for (size_t i = 0; i < backgrounds.size(); i++)
+    wallpaper_image_urls.push_back(wallpaper_image_url_at(i));
   return wallpaper_image_urls;
 }
 
+std::string NTPBackgroundImagesData::wallpaper_image_url_at(
+    size_t index) const {
+  return GetURLPrefix() + base::StringPrintf(
+      "%s%zu.jpg", kWallpaperPathPrefix, index);
+}
+
 }  // namespace ntp_background_images
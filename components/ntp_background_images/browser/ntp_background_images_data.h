@@ -84,6 +84,8 @@ struct NTPBackgroundImagesData {
   std::string GetURLPrefix() const;
 
   std::vector<std::string> wallpaper_image_urls() const;
+  // Url for a single wallpaper w/o materializing the whole list.
+  std::string wallpaper_image_url_at(size_t index) const;
 
   Logo default_logo;
   std::string theme_name;
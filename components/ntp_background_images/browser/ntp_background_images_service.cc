@@ -6,6 +6,7 @@
 #include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
 
 #include <algorithm>
+#include <memory>
 #include <utility>
 
 #include "base/bind.h"
@@ -81,6 +82,18 @@ std::string HandleComponentData(const base::FilePath& installed_dir) {
   return contents;
 }
 
+// Reads and parses the component manifest in one thread pool task so the
+// JSON decode and campaign object construction happen off the UI thread.
+// The raw json string is returned alongside the parsed data because the
+// super referral path caches it to local state prefs.
+std::pair<std::string, std::unique_ptr<NTPBackgroundImagesData>>
+ReadAndParseComponentData(const base::FilePath& installed_dir) {
+  std::string contents = HandleComponentData(installed_dir);
+  auto data =
+      std::make_unique<NTPBackgroundImagesData>(contents, installed_dir);
+  return {std::move(contents), std::move(data)};
+}
+
 }  // namespace
 
 // static
@@ -435,20 +448,34 @@ void NTPBackgroundImagesService::OnComponentReady(
 
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
-      base::BindOnce(&HandleComponentData, installed_dir),
-      base::BindOnce(&NTPBackgroundImagesService::OnGetComponentJsonData,
+      base::BindOnce(&ReadAndParseComponentData, installed_dir),
+      base::BindOnce(&NTPBackgroundImagesService::OnGetParsedComponentData,
                      weak_factory_.GetWeakPtr(), is_super_referral));
 }
 
 void NTPBackgroundImagesService::OnGetComponentJsonData(
     bool is_super_referral,
     const std::string& json_string) {
+  // Direct json injection (tests and local data overrides) parses here, on
+  // the caller's thread. The component path goes through
+  // OnGetParsedComponentData with the parse already done on the thread pool.
+  OnGetParsedComponentData(
+      is_super_referral,
+      {json_string,
+       std::make_unique<NTPBackgroundImagesData>(
+           json_string,
+           is_super_referral ? sr_installed_dir_ : si_installed_dir_)});
+}
+
+void NTPBackgroundImagesService::OnGetParsedComponentData(
+    bool is_super_referral,
+    std::pair<std::string, std::unique_ptr<NTPBackgroundImagesData>> parsed) {
+  const std::string& json_string = parsed.first;
   if (is_super_referral) {
     local_pref_->SetBoolean(
           prefs::kNewTabPageGetInitialSRComponentInProgress,
           false);
-    sr_images_data_.reset(
-        new NTPBackgroundImagesData(json_string, sr_installed_dir_));
+    sr_images_data_ = std::move(parsed.second);
     // |initial_sr_component_info_| has proper data only for initial component
     // downloading. After that, it's empty. In test, it's also empty.
     if (initial_sr_component_info_.is_dict()) {
@@ -459,8 +486,7 @@ void NTPBackgroundImagesService::OnGetComponentJsonData(
     local_pref_->SetString(prefs::kNewTabPageCachedSuperReferralComponentData,
                            json_string);
   } else {
-    si_images_data_.reset(new NTPBackgroundImagesData(json_string,
-                                                      si_installed_dir_));
+    si_images_data_ = std::move(parsed.second);
   }
 
   if (is_super_referral && !sr_images_data_->IsValid()) {
@@ -8,6 +8,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/files/file_path.h"
@@ -111,6 +112,12 @@ class NTPBackgroundImagesService {
                         const base::FilePath& installed_dir);
   void OnGetComponentJsonData(bool is_super_referral,
                               const std::string& json_string);
+  // Reply for the thread pool task that reads and parses the component
+  // manifest. Receives the raw json (still cached to prefs on the SR path)
+  // together with the data parsed off the UI thread.
+  void OnGetParsedComponentData(
+      bool is_super_referral,
+      std::pair<std::string, std::unique_ptr<NTPBackgroundImagesData>> parsed);
   void OnMappingTableComponentReady(const base::FilePath& installed_dir);
   void OnPreferenceChanged(const std::string& pref_name);
   void OnGetMappingTableData(const std::string& json_string);
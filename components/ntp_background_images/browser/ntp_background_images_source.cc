@@ -42,9 +42,22 @@ NTPBackgroundImagesSource::NTPBackgroundImagesSource(
     NTPBackgroundImagesService* service)
     : service_(service),
       weak_factory_(this) {
+  service_->AddObserver(this);
 }
 
-NTPBackgroundImagesSource::~NTPBackgroundImagesSource() = default;
+NTPBackgroundImagesSource::~NTPBackgroundImagesSource() {
+  service_->RemoveObserver(this);
+}
+
+void NTPBackgroundImagesSource::OnUpdated(NTPBackgroundImagesData* data) {
+  // Component data changed - cached files may be stale even if the paths
+  // stayed the same.
+  image_cache_.clear();
+}
+
+void NTPBackgroundImagesSource::OnSuperReferralEnded() {
+  image_cache_.clear();
+}
 
 std::string NTPBackgroundImagesSource::GetSource() {
   return kBrandedWallpaperHost;
@@ -99,14 +112,22 @@ void NTPBackgroundImagesSource::StartDataRequest(
 void NTPBackgroundImagesSource::GetImageFile(
     const base::FilePath& image_file_path,
     GotDataCallback callback) {
+  auto cached = image_cache_.find(image_file_path);
+  if (cached != image_cache_.end()) {
+    std::move(callback).Run(cached->second);
+    return;
+  }
+
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
       base::BindOnce(&ReadFileToString, image_file_path),
       base::BindOnce(&NTPBackgroundImagesSource::OnGotImageFile,
-                     weak_factory_.GetWeakPtr(), std::move(callback)));
+                     weak_factory_.GetWeakPtr(), image_file_path,
+                     std::move(callback)));
 }
 
 void NTPBackgroundImagesSource::OnGotImageFile(
+    const base::FilePath& image_file_path,
     GotDataCallback callback,
     absl::optional<std::string> input) {
   if (!input)
@@ -115,6 +136,7 @@ void NTPBackgroundImagesSource::OnGotImageFile(
   scoped_refptr<base::RefCountedMemory> bytes;
   bytes = new base::RefCountedBytes(
        reinterpret_cast<const unsigned char*>(input->c_str()), input->length());
+  image_cache_[image_file_path] = bytes;
   std::move(callback).Run(std::move(bytes));
 }
 
@@ -8,20 +8,20 @@
 
 #include <string>
 
+#include "base/containers/flat_map.h"
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted_memory.h"
 #include "base/memory/weak_ptr.h"
+#include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
 #include "content/public/browser/url_data_source.h"
 #include "third_party/abseil-cpp/absl/types/optional.h"
 
-namespace base {
-class FilePath;
-}  // namespace base
-
 namespace ntp_background_images {
 
-class NTPBackgroundImagesService;
-
 // This serves background image data.
-class NTPBackgroundImagesSource : public content::URLDataSource {
+class NTPBackgroundImagesSource
+    : public content::URLDataSource,
+      public NTPBackgroundImagesService::Observer {
  public:
   explicit NTPBackgroundImagesSource(NTPBackgroundImagesService* service);
 
@@ -44,9 +44,14 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   std::string GetMimeType(const std::string& path) override;
   bool AllowCaching() override;
 
+  // NTPBackgroundImagesService::Observer overrides:
+  void OnUpdated(NTPBackgroundImagesData* data) override;
+  void OnSuperReferralEnded() override;
+
   void GetImageFile(const base::FilePath& image_file_path,
                     GotDataCallback callback);
-  void OnGotImageFile(GotDataCallback callback,
+  void OnGotImageFile(const base::FilePath& image_file_path,
+                      GotDataCallback callback,
                       absl::optional<std::string> input);
   bool IsValidPath(const std::string& path) const;
   bool IsLogoPath(const std::string& path) const;
@@ -58,6 +63,12 @@ class NTPBackgroundImagesSource : public content::URLDataSource {
   base::FilePath GetTopSiteFaviconFilePath(const std::string& path) const;
 
   NTPBackgroundImagesService* service_;  // not owned
+  // Encoded image bytes keyed by source file, shared by all NTP requests.
+  // Rapidly opened NTPs ask for the same multi-MB wallpaper files over and
+  // over; each file is read from disk once and the bytes are reused until
+  // the component updates.
+  base::flat_map<base::FilePath, scoped_refptr<base::RefCountedMemory>>
+      image_cache_;
   base::WeakPtrFactory<NTPBackgroundImagesSource> weak_factory_;
 };
 
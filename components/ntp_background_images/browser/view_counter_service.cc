@@ -14,6 +14,7 @@
 #include "base/files/file_path.h"
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/time/time.h"
 #include "bat/ads/pref_names.h"
 #include "bat/ads/public/interfaces/ads.mojom.h"
 #include "brave/components/brave_referrals/buildflags/buildflags.h"
@@ -33,6 +34,11 @@ constexpr char kNewTabsCreated[] = "brave.new_tab_page.p3a_new_tabs_created";
 constexpr char kSponsoredNewTabsCreated[] =
     "brave.new_tab_page.p3a_sponsored_new_tabs_created";
 
+// How long deferred counter increments wait before being written to prefs.
+// Matches the delay the session service uses for persisting tab state.
+constexpr base::TimeDelta kCountersFlushDelay =
+    base::TimeDelta::FromMilliseconds(2500);
+
 }  // namespace
 
 namespace ntp_background_images {
@@ -103,7 +109,8 @@ void ViewCounterService::BrandedWallpaperWillBeDisplayed(
         ads::mojom::BraveAdsNewTabPageAdEventType::kViewed);
   }
 
-  branded_new_tab_count_state_->AddDelta(1);
+  branded_new_tab_count_state_->AddDeltaDeferred(1);
+  ScheduleCountersFlush();
   UpdateP3AValues();
 }
 
@@ -153,9 +160,24 @@ std::vector<TopSite> ViewCounterService::GetTopSitesVectorData() const {
 }
 
 void ViewCounterService::Shutdown() {
+  counters_flush_timer_.Stop();
+  FlushCounters();
   service_->RemoveObserver(this);
 }
 
+void ViewCounterService::ScheduleCountersFlush() {
+  if (counters_flush_timer_.IsRunning())
+    return;
+
+  counters_flush_timer_.Start(FROM_HERE, kCountersFlushDelay, this,
+                              &ViewCounterService::FlushCounters);
+}
+
+void ViewCounterService::FlushCounters() {
+  new_tab_count_state_->FlushToPrefs();
+  branded_new_tab_count_state_->FlushToPrefs();
+}
+
 void ViewCounterService::OnUpdated(NTPBackgroundImagesData* data) {
   // We can get non effective component update because
   // NTPBackgroundImagesService just notifies whenever any component is updated.
@@ -209,7 +231,8 @@ void ViewCounterService::ResetNotificationState() {
 }
 
 void ViewCounterService::RegisterPageView() {
-  new_tab_count_state_->AddDelta(1);
+  new_tab_count_state_->AddDeltaDeferred(1);
+  ScheduleCountersFlush();
   UpdateP3AValues();
 
   // Don't do any counting if we will never be showing the data
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "base/timer/timer.h"
 #include "base/values.h"
 #include "brave/components/brave_ads/browser/ads_service.h"
 #include "brave/components/ntp_background_images/browser/ntp_background_images_service.h"
@@ -122,6 +123,13 @@ class ViewCounterService : public KeyedService,
 
   void UpdateP3AValues() const;
 
+  // The new tab counters are bumped on every new tab open. Writing them back
+  // to prefs per tab serializes the whole weekly list each time, which is
+  // wasteful during tab bursts, so increments only touch the in-memory state
+  // and a short timer persists them, like the session service does.
+  void ScheduleCountersFlush();
+  void FlushCounters();
+
   NTPBackgroundImagesService* service_ = nullptr;  // not owned
   brave_ads::AdsService* ads_service_ = nullptr;  // not owned
   PrefService* prefs_ = nullptr;  // not owned
@@ -133,6 +141,7 @@ class ViewCounterService : public KeyedService,
   // and the ratio of those which are branded images.
   std::unique_ptr<WeeklyStorage> new_tab_count_state_;
   std::unique_ptr<WeeklyStorage> branded_new_tab_count_state_;
+  base::OneShotTimer counters_flush_timer_;
 };
 
 }  // namespace ntp_background_images
@@ -7,9 +7,6 @@
 
 #include <math.h>
 
-#include <numeric>
-#include <vector>
-
 #include "base/check_op.h"
 #include "base/rand_util.h"
 
@@ -26,24 +23,23 @@ DirectEncodingProtocol::~DirectEncodingProtocol() = default;
 uint64_t DirectEncodingProtocol::Perturb(
     uint16_t bucket_count, uint64_t value) {
   DCHECK_GT(bucket_count, 1);
+  DCHECK_LT(value, bucket_count);
 
-  uint64_t perturbed_value = value;
   double probability = exp(kEpsilon) / (exp(kEpsilon) + bucket_count - 1);
 
   // Return true value with probability
   if (base::RandDouble() < probability) {
-      return perturbed_value;
+      return value;
   }
 
-  // Generate set of non-truthful options by removing the true bucket from the
-  // candidate vector
-  std::vector<uint16_t> buckets(bucket_count);
-  std::iota(buckets.begin(), buckets.end(), 0);
-  buckets.erase(buckets.begin() + value);
-
-  // Now pick non-truthful bucket at uniform random
-  const int rand = base::RandInt(0, bucket_count - 2);
-  perturbed_value = buckets.at(rand);
+  // Pick a non-truthful bucket at uniform random. Drawing an index from the
+  // range with one slot removed and skipping past the true bucket is
+  // equivalent to sampling from an explicit candidate vector, but needs no
+  // per-call allocation no matter how many buckets a question has.
+  uint64_t perturbed_value = base::RandInt(0, bucket_count - 2);
+  if (perturbed_value >= value) {
+    perturbed_value++;
+  }
 
   return perturbed_value;
 }
@@ -5,6 +5,8 @@
 
 #include "brave/components/p3a/brave_p3a_log_store.h"
 
+#include <vector>
+
 #include "base/logging.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/rand_util.h"
@@ -51,6 +53,8 @@ void BraveP3ALogStore::RegisterPrefs(PrefRegistrySimple* registry) {
 
 void BraveP3ALogStore::UpdateValue(const std::string& histogram_name,
                                    uint64_t value) {
+  auto iter = log_.find(histogram_name);
+  const bool value_changed = iter == log_.end() || iter->second.value != value;
   LogEntry& entry = log_[histogram_name];
   entry.value = value;
   if (!entry.sent) {
@@ -58,6 +62,14 @@ void BraveP3ALogStore::UpdateValue(const std::string& histogram_name,
     unsent_entries_.insert(histogram_name);
   }
 
+  // Metrics are re-reported every collection cycle and mostly with the
+  // value already persisted; don't dirty local state (and schedule a full
+  // serialize of it) unless the stored entry actually changes. The sent
+  // flag is only flipped by DiscardStagedLog/ResetUploadStamps, which
+  // persist it themselves.
+  if (!value_changed)
+    return;
+
   // Update the persistent value.
   DictionaryPrefUpdate update(local_state_, kPrefName);
   update->SetPath({histogram_name, kLogValueKey},
@@ -106,6 +118,10 @@ void BraveP3ALogStore::ResetUploadStamps() {
   }
 }
 
+size_t BraveP3ALogStore::unsent_log_count() const {
+  return unsent_entries_.size();
+}
+
 bool BraveP3ALogStore::has_unsent_logs() const {
   return !unsent_entries_.empty();
 }
@@ -193,15 +209,18 @@ void BraveP3ALogStore::LoadPersistedUnsentLogs() {
   DCHECK(log_.empty());
   DCHECK(unsent_entries_.empty());
 
-  DictionaryPrefUpdate update(local_state_, kPrefName);
-  base::DictionaryValue* list = update.Get();
-  for (auto dict_item : list->DictItems()) {
+  // Read without opening a pref update: loading shouldn't schedule a local
+  // state write. Obsolete metrics are collected and dropped in one update
+  // afterwards, and only if there are any.
+  std::vector<std::string> obsolete_metrics;
+  const base::DictionaryValue* list = local_state_->GetDictionary(kPrefName);
+  for (const auto& dict_item : list->DictItems()) {
     LogEntry entry;
     const std::string name = dict_item.first;
     // Check if the metric is obsolete.
     if (!delegate_->IsActualMetric(name)) {
       // Drop it from the local state.
-      list->RemoveKey(name);
+      obsolete_metrics.push_back(name);
       continue;
     }
     const base::Value& dict = dict_item.second;
@@ -240,6 +259,13 @@ void BraveP3ALogStore::LoadPersistedUnsentLogs() {
       unsent_entries_.insert(name);
     }
   }
+
+  if (!obsolete_metrics.empty()) {
+    DictionaryPrefUpdate update(local_state_, kPrefName);
+    for (const auto& name : obsolete_metrics) {
+      update->RemoveKey(name);
+    }
+  }
 }
 
 }  // namespace brave
@@ -49,6 +49,10 @@ class BraveP3ALogStore : public metrics::LogStore {
   // Marks all saved values as unsent.
   void ResetUploadStamps();
 
+  // Number of logs that still await upload. Used by the service to pace
+  // uploads faster while a backlog is draining.
+  size_t unsent_log_count() const;
+
   // metrics::LogStore:
   bool has_unsent_logs() const override;
   bool has_staged_log() const override;
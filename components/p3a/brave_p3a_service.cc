@@ -5,6 +5,7 @@
 
 #include "brave/components/p3a/brave_p3a_service.h"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
@@ -55,6 +56,14 @@ constexpr char kP2AServerUrl[] = "https://p2a.brave.com/";
 
 constexpr uint64_t kDefaultUploadIntervalSeconds = 60;  // 1 minute.
 
+// When more unsent logs than this are pending (e.g. the browser was closed
+// across a rotation or the network was down for a while), uploads are paced
+// at the catch-up interval instead of the average one, so the backlog drains
+// in minutes rather than hours. Failed uploads still go through the
+// scheduler's exponential backoff, so a struggling server is not hammered.
+constexpr size_t kCatchUpThreshold = 10;
+constexpr uint64_t kCatchUpUploadIntervalSeconds = 10;
+
 // TODO(iefremov): Provide moar histograms!
 // Whitelist for histograms that we collect. Will be replaced with something
 // updating on the fly.
@@ -275,11 +284,7 @@ void BraveP3AService::Init(
 
   upload_scheduler_.reset(new BraveP3AScheduler(
       base::BindRepeating(&BraveP3AService::StartScheduledUpload, this),
-      (randomize_upload_interval_
-           ? base::BindRepeating(GetRandomizedUploadInterval,
-                                 average_upload_interval_)
-           : base::BindRepeating([](base::TimeDelta x) { return x; },
-                                 average_upload_interval_))));
+      base::BindRepeating(&BraveP3AService::GetUploadInterval, this)));
 
   upload_scheduler_->Start();
   if (!rotation_timer_.IsRunning()) {
@@ -407,6 +412,18 @@ void BraveP3AService::StartScheduledUpload() {
   }
 }
 
+base::TimeDelta BraveP3AService::GetUploadInterval() {
+  base::TimeDelta interval = average_upload_interval_;
+  if (log_store_->unsent_log_count() > kCatchUpThreshold) {
+    interval = std::min(
+        interval, base::TimeDelta::FromSeconds(kCatchUpUploadIntervalSeconds));
+  }
+  if (randomize_upload_interval_) {
+    return GetRandomizedUploadInterval(interval);
+  }
+  return interval;
+}
+
 void BraveP3AService::OnHistogramChanged(const char* histogram_name,
                                          uint64_t name_hash,
                                          base::HistogramBase::Sample sample) {
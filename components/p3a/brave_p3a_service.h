@@ -71,6 +71,12 @@ class BraveP3AService : public base::RefCountedThreadSafe<BraveP3AService>,
 
   void StartScheduledUpload();
 
+  // Returns the delay before the next upload attempt. Normally this is the
+  // (possibly randomized) average upload interval, but while many unsent
+  // logs are pending (e.g. after an offline period or right after rotation)
+  // a shorter catch-up interval is used so the backlog drains quickly.
+  base::TimeDelta GetUploadInterval();
+
   // Invoked by callbacks registered by our service. Since these callbacks
   // can fire on any thread, this method reposts everything to UI thread.
   void OnHistogramChanged(const char* histogram_name,
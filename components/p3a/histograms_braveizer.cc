@@ -61,8 +61,10 @@ void HistogramsBraveizer::DoHistogramBravetization(
     constexpr int kIntervals[] = {5, 20, 100, 500, 1000, 5000, 10000};
     const int* it = std::lower_bound(kIntervals, std::end(kIntervals), sample);
     const int answer = it - kIntervals;
-    UMA_HISTOGRAM_EXACT_LINEAR("Brave.Core.BookmarksCountOnProfileLoad.2",
-                               answer, base::size(kIntervals));
+    if (UpdateAnswer(name_hash, answer)) {
+      UMA_HISTOGRAM_EXACT_LINEAR("Brave.Core.BookmarksCountOnProfileLoad.2",
+                                 answer, base::size(kIntervals));
+    }
     return;
   }
 
@@ -82,7 +84,9 @@ void HistogramsBraveizer::DoHistogramBravetization(
       default:
         NOTREACHED();
     }
-    UMA_HISTOGRAM_BOOLEAN("Brave.Core.IsDefault", answer);
+    if (UpdateAnswer(name_hash, answer)) {
+      UMA_HISTOGRAM_BOOLEAN("Brave.Core.IsDefault", answer);
+    }
   }
 
   if (strcmp("Extensions.LoadExtension", histogram_name) == 0) {
@@ -94,7 +98,9 @@ void HistogramsBraveizer::DoHistogramBravetization(
     else if (sample >= 5)
       answer = 3;
 
-    UMA_HISTOGRAM_EXACT_LINEAR("Brave.Core.NumberOfExtensions", answer, 3);
+    if (UpdateAnswer(name_hash, answer)) {
+      UMA_HISTOGRAM_EXACT_LINEAR("Brave.Core.NumberOfExtensions", answer, 3);
+    }
     return;
   }
 
@@ -113,7 +119,9 @@ void HistogramsBraveizer::DoHistogramBravetization(
       answer = 4;
     }
 
-    UMA_HISTOGRAM_EXACT_LINEAR("Brave.Core.TabCount", answer, 4);
+    if (UpdateAnswer(name_hash, answer)) {
+      UMA_HISTOGRAM_EXACT_LINEAR("Brave.Core.TabCount", answer, 4);
+    }
     return;
   }
 
@@ -129,9 +137,21 @@ void HistogramsBraveizer::DoHistogramBravetization(
       answer = 3;
     }
 
-    UMA_HISTOGRAM_EXACT_LINEAR("Brave.Core.WindowCount.2", answer, 3);
+    if (UpdateAnswer(name_hash, answer)) {
+      UMA_HISTOGRAM_EXACT_LINEAR("Brave.Core.WindowCount.2", answer, 3);
+    }
     return;
   }
 }
 
+bool HistogramsBraveizer::UpdateAnswer(uint64_t name_hash, int answer) {
+  base::AutoLock auto_lock(lock_);
+  auto iter = last_answers_.find(name_hash);
+  if (iter != last_answers_.end() && iter->second == answer) {
+    return false;
+  }
+  last_answers_[name_hash] = answer;
+  return true;
+}
+
 }  // namespace brave
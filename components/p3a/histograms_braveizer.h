@@ -9,9 +9,11 @@
 #include <memory>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/ref_counted.h"
 #include "base/metrics/histogram_base.h"
 #include "base/metrics/statistics_recorder.h"
+#include "base/synchronization/lock.h"
 
 namespace brave {
 
@@ -37,6 +39,16 @@ class HistogramsBraveizer
                                 uint64_t name_hash,
                                 base::HistogramBase::Sample sample);
 
+  // Remembers |answer| for the source histogram identified by |name_hash|
+  // and returns true if it differs from the previously recorded one.
+  // Samples falling into an already reported bucket don't need to be
+  // reemitted, that would only wake up the P3A machinery for nothing.
+  bool UpdateAnswer(uint64_t name_hash, int answer);
+
+  // Sample callbacks can fire on any thread.
+  base::Lock lock_;
+  base::flat_map<uint64_t, int> last_answers_;
+
   std::vector<
       std::unique_ptr<base::StatisticsRecorder::ScopedHistogramSampleObserver>>
       histogram_sample_callbacks_;
@@ -20,6 +20,7 @@
 #include "components/prefs/pref_service.h"
 #include "services/preferences/public/cpp/dictionary_value_update.h"
 #include "services/preferences/public/cpp/scoped_pref_update.h"
+#include "third_party/abseil-cpp/absl/types/optional.h"
 
 using content_settings::WebsiteSettingsInfo;
 using content_settings::WebsiteSettingsRegistry;
@@ -158,6 +159,14 @@ PermissionExpirations::RemoveExpiredPermissionsImpl(
         const KeyExpirationsMap&)> predicate) {
   ExpiredPermissions expired_permissions;
 
+  // Open a single scoped pref update for the whole batch so that an expiry
+  // pass triggers one pref transaction regardless of how many content types
+  // it touches.
+  absl::optional<ScopedDictionaryPrefUpdate> update;
+  if (prefs_ && !expirations_.empty()) {
+    update.emplace(prefs_, prefs::kPermissionLifetimeExpirations);
+  }
+
   // Enumerate all content types and remove all expired permissions.
   for (auto expirations_it = expirations_.begin();
        expirations_it != expirations_.end();) {
@@ -188,7 +197,10 @@ PermissionExpirations::RemoveExpiredPermissionsImpl(
     }
 
     // Update prefs.
-    UpdateExpirationsPref(content_type, expiration_keys_to_clear_prefs);
+    if (update) {
+      UpdateExpirationsPrefValue(update->Get().get(), content_type,
+                                 expiration_keys_to_clear_prefs);
+    }
   }
   return expired_permissions;
 }
@@ -203,7 +215,14 @@ void PermissionExpirations::UpdateExpirationsPref(
   // Use a scoped pref update to update only changed pref subkeys.
   ScopedDictionaryPrefUpdate update(prefs_,
                                     prefs::kPermissionLifetimeExpirations);
-  std::unique_ptr<DictionaryValueUpdate> key_expirations_val = update.Get();
+  UpdateExpirationsPrefValue(update.Get().get(), content_type,
+                             expiration_keys);
+}
+
+void PermissionExpirations::UpdateExpirationsPrefValue(
+    DictionaryValueUpdate* key_expirations_val,
+    ContentSettingsType content_type,
+    const std::vector<PermissionExpirationKey>& expiration_keys) {
   DCHECK(key_expirations_val);
 
   const std::string& content_type_name =
@@ -17,6 +17,10 @@
 #include "brave/components/permissions/permission_origins.h"
 #include "components/content_settings/core/common/content_settings.h"
 
+namespace prefs {
+class DictionaryValueUpdate;
+}
+
 namespace user_prefs {
 class PrefRegistrySyncable;
 }
@@ -72,6 +76,12 @@ class PermissionExpirations {
   void UpdateExpirationsPref(
       ContentSettingsType content_type,
       const std::vector<PermissionExpirationKey>& expiration_keys);
+  // Same as above, but writes into an already opened pref update so that
+  // several content types can be updated in a single pref transaction.
+  void UpdateExpirationsPrefValue(
+      prefs::DictionaryValueUpdate* key_expirations_val,
+      ContentSettingsType content_type,
+      const std::vector<PermissionExpirationKey>& expiration_keys);
 
   void ReadExpirationsFromPrefs();
   ExpiringPermissions ParseExpiringPermissions(
@@ -38,6 +38,13 @@ void BatLedgerClientMojoBridge::LoadURL(
       base::BindOnce(&OnLoadURL, std::move(callback)));
 }
 
+void BatLedgerClientMojoBridge::PreconnectURL(const std::string& url) {
+  if (!Connected())
+    return;
+
+  bat_ledger_client_->PreconnectURL(url);
+}
+
 void BatLedgerClientMojoBridge::OnReconcileComplete(
     const ledger::type::Result result,
     ledger::type::ContributionInfoPtr contribution) {
@@ -150,75 +157,117 @@ void BatLedgerClientMojoBridge::PublisherListNormalized(
 
 void BatLedgerClientMojoBridge::SetBooleanState(const std::string& name,
                                                bool value) {
+  boolean_state_cache_[name] = value;
   bat_ledger_client_->SetBooleanState(name, value);
 }
 
 bool BatLedgerClientMojoBridge::GetBooleanState(const std::string& name) const {
+  auto cached = boolean_state_cache_.find(name);
+  if (cached != boolean_state_cache_.end()) {
+    return cached->second;
+  }
   bool value;
   bat_ledger_client_->GetBooleanState(name, &value);
+  boolean_state_cache_[name] = value;
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetIntegerState(const std::string& name,
                                                int value) {
+  integer_state_cache_[name] = value;
   bat_ledger_client_->SetIntegerState(name, value);
 }
 
 int BatLedgerClientMojoBridge::GetIntegerState(const std::string& name) const {
+  auto cached = integer_state_cache_.find(name);
+  if (cached != integer_state_cache_.end()) {
+    return cached->second;
+  }
   int value;
   bat_ledger_client_->GetIntegerState(name, &value);
+  integer_state_cache_[name] = value;
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetDoubleState(const std::string& name,
                                               double value) {
+  double_state_cache_[name] = value;
   bat_ledger_client_->SetDoubleState(name, value);
 }
 
 double BatLedgerClientMojoBridge::GetDoubleState(
     const std::string& name) const {
+  auto cached = double_state_cache_.find(name);
+  if (cached != double_state_cache_.end()) {
+    return cached->second;
+  }
   double value;
   bat_ledger_client_->GetDoubleState(name, &value);
+  double_state_cache_[name] = value;
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetStringState(const std::string& name,
                               const std::string& value) {
+  string_state_cache_[name] = value;
   bat_ledger_client_->SetStringState(name, value);
 }
 
 std::string BatLedgerClientMojoBridge::
 GetStringState(const std::string& name) const {
+  auto cached = string_state_cache_.find(name);
+  if (cached != string_state_cache_.end()) {
+    return cached->second;
+  }
   std::string value;
   bat_ledger_client_->GetStringState(name, &value);
+  string_state_cache_[name] = value;
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetInt64State(const std::string& name,
                                              int64_t value) {
+  int64_state_cache_[name] = value;
   bat_ledger_client_->SetInt64State(name, value);
 }
 
 int64_t BatLedgerClientMojoBridge::GetInt64State(
     const std::string& name) const {
+  auto cached = int64_state_cache_.find(name);
+  if (cached != int64_state_cache_.end()) {
+    return cached->second;
+  }
   int64_t value;
   bat_ledger_client_->GetInt64State(name, &value);
+  int64_state_cache_[name] = value;
   return value;
 }
 
 void BatLedgerClientMojoBridge::SetUint64State(const std::string& name,
                                               uint64_t value) {
+  uint64_state_cache_[name] = value;
   bat_ledger_client_->SetUint64State(name, value);
 }
 
 uint64_t BatLedgerClientMojoBridge::GetUint64State(
     const std::string& name) const {
+  auto cached = uint64_state_cache_.find(name);
+  if (cached != uint64_state_cache_.end()) {
+    return cached->second;
+  }
   uint64_t value;
   bat_ledger_client_->GetUint64State(name, &value);
+  uint64_state_cache_[name] = value;
   return value;
 }
 
 void BatLedgerClientMojoBridge::ClearState(const std::string& name) {
+  boolean_state_cache_.erase(name);
+  integer_state_cache_.erase(name);
+  double_state_cache_.erase(name);
+  string_state_cache_.erase(name);
+  int64_state_cache_.erase(name);
+  uint64_state_cache_.erase(name);
   bat_ledger_client_->ClearState(name);
 }
 
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "base/containers/flat_map.h"
 #include "base/memory/weak_ptr.h"
 #include "bat/ledger/ledger_client.h"
 #include "brave/components/services/bat_ledger/public/interfaces/bat_ledger.mojom.h"
@@ -41,6 +42,8 @@ class BatLedgerClientMojoBridge :
       ledger::type::UrlRequestPtr request,
       ledger::client::LoadURLCallback callback) override;
 
+  void PreconnectURL(const std::string& url) override;
+
   void OnPanelPublisherInfo(ledger::type::Result result,
                             ledger::type::PublisherInfoPtr info,
                             uint64_t windowId) override;
@@ -128,6 +131,19 @@ class BatLedgerClientMojoBridge :
   bool Connected() const;
 
   mojo::AssociatedRemote<mojom::BatLedgerClient> bat_ledger_client_;
+
+  // Write-through caches for the per-key state accessors. Every state read
+  // is a synchronous mojo call into the browser process, and the ledger
+  // re-reads the same hot keys (reconcile stamp, wallet fields, flags)
+  // constantly; with these caches each key pays for at most one crossing.
+  // State keys are only ever written through this client, so the caches
+  // cannot go stale while the ledger process is alive.
+  mutable base::flat_map<std::string, bool> boolean_state_cache_;
+  mutable base::flat_map<std::string, int> integer_state_cache_;
+  mutable base::flat_map<std::string, double> double_state_cache_;
+  mutable base::flat_map<std::string, std::string> string_state_cache_;
+  mutable base::flat_map<std::string, int64_t> int64_state_cache_;
+  mutable base::flat_map<std::string, uint64_t> uint64_state_cache_;
 };
 
 }  // namespace bat_ledger
@@ -126,6 +126,10 @@ void LedgerClientMojoBridge::LoadURL(
       std::bind(LedgerClientMojoBridge::OnLoadURL, holder, _1));
 }
 
+void LedgerClientMojoBridge::PreconnectURL(const std::string& url) {
+  ledger_client_->PreconnectURL(url);
+}
+
 void LedgerClientMojoBridge::PublisherListNormalized(
     ledger::type::PublisherInfoList list) {
   ledger_client_->PublisherListNormalized(std::move(list));
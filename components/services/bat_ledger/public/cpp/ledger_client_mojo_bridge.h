@@ -51,6 +51,8 @@ class LedgerClientMojoBridge :
       ledger::type::UrlRequestPtr request,
       LoadURLCallback callback) override;
 
+  void PreconnectURL(const std::string& url) override;
+
   void PublisherListNormalized(ledger::type::PublisherInfoList list) override;
 
   void SetBooleanState(const std::string& name, bool value) override;
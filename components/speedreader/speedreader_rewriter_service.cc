@@ -77,7 +77,8 @@ void SpeedreaderRewriterService::OnWhitelistReady(const base::FilePath& path) {
   base::ThreadPool::PostTaskAndReplyWithResult(
       FROM_HERE, {base::MayBlock()},
       base::BindOnce(
-          &brave_component_updater::LoadDATFileData<speedreader::SpeedReader>,
+          &brave_component_updater::LoadMappedDATFileData<
+              speedreader::SpeedReader>,
           path),
       base::BindOnce(&SpeedreaderRewriterService::OnLoadDATFileData,
                      weak_factory_.GetWeakPtr()));
@@ -128,8 +129,10 @@ void SpeedreaderRewriterService::OnLoadStylesheet(std::string stylesheet) {
 void SpeedreaderRewriterService::OnLoadDATFileData(
     GetDATFileDataResult result) {
   VLOG(2) << "Speedreader loaded from DAT file";
-  if (result.first)
-    speedreader_ = std::move(result.first);
+  if (result.client) {
+    speedreader_ = std::move(result.client);
+    mapped_dat_file_ = std::move(result.mapped_file);
+  }
 }
 
 }  // namespace speedreader
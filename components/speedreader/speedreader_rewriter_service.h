@@ -9,6 +9,7 @@
 #include <memory>
 #include <string>
 
+#include "base/files/memory_mapped_file.h"
 #include "base/memory/weak_ptr.h"
 #include "brave/components/brave_component_updater/browser/brave_component.h"
 #include "brave/components/brave_component_updater/browser/dat_file_util.h"
@@ -49,7 +50,8 @@ class SpeedreaderRewriterService : public SpeedreaderComponent::Observer {
 
  private:
   using GetDATFileDataResult =
-      brave_component_updater::LoadDATFileDataResult<speedreader::SpeedReader>;
+      brave_component_updater::LoadMappedDATFileDataResult<
+          speedreader::SpeedReader>;
 
   void OnLoadDATFileData(GetDATFileDataResult result);
   void OnLoadStylesheet(std::string stylesheet);
@@ -60,6 +62,7 @@ class SpeedreaderRewriterService : public SpeedreaderComponent::Observer {
   std::string content_stylesheet_;
   std::unique_ptr<speedreader::SpeedreaderComponent> component_;
   std::unique_ptr<speedreader::SpeedReader> speedreader_;
+  std::unique_ptr<base::MemoryMappedFile> mapped_dat_file_;
   base::WeakPtrFactory<SpeedreaderRewriterService> weak_factory_{this};
 };
 
@@ -34,7 +34,7 @@ void BraveSyncAuthManager::DeriveSigningKeys(const std::string& seed) {
   VLOG(1) << __func__;
   if (seed.empty())
     return;
-  const std::vector<uint8_t> HKDF_SALT = {
+  static const std::vector<uint8_t> HKDF_SALT = {
       72,  203, 156, 43,  64,  229, 225, 127, 214, 158, 50,  29,  130,
       186, 182, 207, 6,   108, 47,  254, 245, 71,  198, 109, 44,  108,
       32,  193, 221, 126, 119, 143, 112, 113, 87,  184, 239, 231, 230,
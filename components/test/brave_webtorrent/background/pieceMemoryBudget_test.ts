@@ -0,0 +1,78 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+import { Torrent } from 'webtorrent'
+import {
+  enforceBudget,
+  forgetTorrent,
+  isThrottled,
+  recordActivity
+} from '../../../brave_webtorrent/extension/background/pieceMemoryBudget'
+
+const makeTorrent = (infoHash: string, downloaded: number) => {
+  const torrent = {
+    infoHash,
+    downloaded,
+    done: false,
+    pieces: new Array(8),
+    pause: jest.fn(),
+    resume: jest.fn(),
+    select: jest.fn(),
+    deselect: jest.fn()
+  }
+  return torrent as {} as Torrent
+}
+
+describe('pieceMemoryBudget test', () => {
+  const budget = 100
+
+  afterEach(() => {
+    ['a', 'b', 'c'].forEach(forgetTorrent)
+  })
+
+  it('does nothing while under budget', () => {
+    const torrents = [makeTorrent('a', 40), makeTorrent('b', 40)]
+    enforceBudget(torrents, budget)
+    expect(isThrottled('a')).toBe(false)
+    expect(isThrottled('b')).toBe(false)
+  })
+
+  it('throttles the least recently active torrent when over budget', () => {
+    const torrents = [makeTorrent('a', 80), makeTorrent('b', 80)]
+    recordActivity(torrents[0])
+    enforceBudget(torrents, budget)
+    expect(isThrottled('a')).toBe(false)
+    expect(isThrottled('b')).toBe(true)
+    expect(torrents[1].pause).toHaveBeenCalled()
+    expect(torrents[1].deselect).toHaveBeenCalledWith(0, 7, 0)
+  })
+
+  it('never throttles the last active torrent', () => {
+    const torrents = [makeTorrent('a', 200)]
+    enforceBudget(torrents, budget)
+    expect(isThrottled('a')).toBe(false)
+  })
+
+  it('resumes a throttled torrent once back under the resume mark', () => {
+    const torrents = [makeTorrent('a', 80), makeTorrent('b', 80)]
+    recordActivity(torrents[0])
+    enforceBudget(torrents, budget)
+    expect(isThrottled('b')).toBe(true)
+
+    const [torrentA, torrentB] = torrents as any[]
+    torrentA.downloaded = 10
+    torrentB.downloaded = 10
+    enforceBudget(torrents, budget)
+    expect(isThrottled('b')).toBe(false)
+    expect(torrents[1].resume).toHaveBeenCalled()
+    expect(torrents[1].select).toHaveBeenCalledWith(0, 7, 0)
+  })
+
+  it('drops bookkeeping for removed torrents', () => {
+    const torrents = [makeTorrent('a', 80), makeTorrent('b', 80)]
+    enforceBudget(torrents, budget)
+    forgetTorrent('b')
+    expect(isThrottled('b')).toBe(false)
+  })
+})
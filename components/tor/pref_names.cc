@@ -12,5 +12,7 @@ const char kTorDisabled[] = "tor.tor_disabled";
 
 const char kAutoOnionRedirect[] = "tor.auto_onion_location";
 
+const char kPrewarmTorOnStartup[] = "tor.prewarm_tor_on_startup";
+
 }  // namespace prefs
 }  // namespace tor
@@ -14,6 +14,10 @@ extern const char kTorDisabled[];
 // Automatically open onion available site or .onion domain in Tor window
 extern const char kAutoOnionRedirect[];
 
+// Launch the tor process at browser startup instead of waiting for the
+// first Tor window, so circuits are already established when it opens
+extern const char kPrewarmTorOnStartup[];
+
 }  // namespace prefs
 }  // namespace tor
 
@@ -521,7 +521,8 @@ void TorControl::GetCircuitEstablishedDone(
 
 // StartWrite()
 //
-//      Pick a write off the queue and start an I/O buffer for it.
+//      Pick all pending writes off the queue and start an I/O buffer
+//      for them.
 //
 //      Caller must ensure writing_ is true.
 //
@@ -530,9 +531,19 @@ void TorControl::StartWrite() {
   DCHECK(writing_);
   DCHECK(!writeq_.empty());
   DCHECK(!cmdq_.empty());
-  auto buf = base::MakeRefCounted<net::StringIOBuffer>(writeq_.front());
+  // Coalesce everything queued into a single buffer, so that a batch
+  // of commands issued together -- e.g., a circuit-status poll
+  // alongside a SOCKS readiness check -- goes out in one write rather
+  // than one write per command.  Replies are matched to callbacks in
+  // order via cmdq_, so batching the writes does not change how
+  // responses are demultiplexed.
+  std::string cmds;
+  do {
+    cmds += writeq_.front();
+    writeq_.pop();
+  } while (!writeq_.empty());
+  auto buf = base::MakeRefCounted<net::StringIOBuffer>(std::move(cmds));
   writeiobuf_ = base::MakeRefCounted<net::DrainableIOBuffer>(buf, buf->size());
-  writeq_.pop();
 }
 
 // DoWrites()
@@ -115,6 +115,10 @@ void TorLauncherFactory::KillTorProcess() {
   tor_pid_ = -1;
   is_starting_ = false;
   is_connected_ = false;
+  // The SOCKS listener died with the process; a window opened now must not
+  // be handed the stale proxy endpoint.
+  tor_proxy_uri_.clear();
+  tor_version_.clear();
   tor_log_.clear();
 }
 
@@ -146,6 +150,11 @@ void TorLauncherFactory::GetTorLog(GetLogCallback callback) {
 void TorLauncherFactory::AddObserver(TorLauncherObserver* observer) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   observers_.AddObserver(observer);
+  // Replay the cached readiness so observers registered after the circuit
+  // came up (second and later Tor windows) sync from here instead of
+  // waiting for the next control-port event.
+  if (is_connected_)
+    observer->OnTorCircuitEstablished(true);
 }
 
 void TorLauncherFactory::RemoveObserver(TorLauncherObserver* observer) {
@@ -273,6 +282,13 @@ void TorLauncherFactory::GotCircuitEstablished(bool error, bool established) {
 void TorLauncherFactory::OnTorControlClosed(bool was_running) {
   DCHECK_CALLED_ON_VALID_SEQUENCE(sequence_checker_);
   VLOG(2) << "TOR CONTROL: Closed!";
+  // Without the control channel the circuit state can no longer be tracked,
+  // so the cached readiness must not keep advertising a connection.
+  if (is_connected_) {
+    is_connected_ = false;
+    for (auto& observer : observers_)
+      observer.OnTorCircuitEstablished(false);
+  }
   // If we're still running, try watching again to start over.
   // TODO(riastradh-brave): Rate limit in case of flapping?
   if (was_running) {
@@ -348,6 +364,7 @@ void TorLauncherFactory::OnTorEvent(
       is_connected_ = true;
     } else if (initial.find(kStatusClientCircuitNotEstablished) !=
                std::string::npos) {
+      is_connected_ = false;
       for (auto& observer : observers_)
         observer.OnTorCircuitEstablished(false);
     }
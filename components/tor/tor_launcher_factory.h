@@ -38,6 +38,8 @@ class TorLauncherFactory : public tor::TorControl::Delegate {
   virtual void LaunchTorProcess(const tor::mojom::TorConfig& config);
   virtual void KillTorProcess();
   virtual int64_t GetTorPid() const;
+  // Cached readiness, push-updated from TorControl's async events; reading
+  // these costs no control-port traffic.
   virtual bool IsTorConnected() const;
   virtual std::string GetTorProxyURI() const;
   virtual std::string GetTorVersion() const;
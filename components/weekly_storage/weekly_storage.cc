@@ -45,6 +45,18 @@ void WeeklyStorage::AddDelta(uint64_t delta) {
   Save();
 }
 
+void WeeklyStorage::AddDeltaDeferred(uint64_t delta) {
+  FilterToWeek();
+  daily_values_.front().value += delta;
+}
+
+void WeeklyStorage::FlushToPrefs() {
+  if (daily_values_.empty()) {
+    return;
+  }
+  Save();
+}
+
 void WeeklyStorage::ReplaceTodaysValueIfGreater(uint64_t value) {
   FilterToWeek();
   DailyValue& today = daily_values_.front();
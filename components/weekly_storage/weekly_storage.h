@@ -36,6 +36,12 @@ class WeeklyStorage {
   WeeklyStorage& operator=(const WeeklyStorage&) = delete;
 
   void AddDelta(uint64_t delta);
+  // Same as |AddDelta| but without writing the list back to prefs. Callers
+  // on hot paths can batch several increments and persist them later with
+  // |FlushToPrefs|. Getters always reflect deferred deltas as they read the
+  // in-memory state.
+  void AddDeltaDeferred(uint64_t delta);
+  void FlushToPrefs();
   void ReplaceTodaysValueIfGreater(uint64_t value);
   uint64_t GetWeeklySum() const;
   uint64_t GetHighestValueInWeek() const;
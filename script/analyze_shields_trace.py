@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+
+"""Summarizes brave.shields events from a chrome://tracing JSON export.
+
+Record a trace with the "brave.shields" category enabled, export it as JSON
+and run:
+
+    script/analyze_shields_trace.py trace.json
+
+Prints per-event duration statistics (count, mean, p50, p99) and verdict
+counts, so request-latency regressions can be attributed to a specific
+shields helper without a custom build.
+"""
+
+# Copyright (c) 2021 The Brave Authors. All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this file,
+# You can obtain one at https://mozilla.org/MPL/2.0/.
+
+import argparse
+import collections
+import json
+import sys
+
+SHIELDS_CATEGORY = 'brave.shields'
+
+
+def percentile(sorted_values, fraction):
+    if not sorted_values:
+        return 0.0
+    index = min(int(len(sorted_values) * fraction), len(sorted_values) - 1)
+    return sorted_values[index]
+
+
+def load_events(path):
+    with open(path) as trace_file:
+        trace = json.load(trace_file)
+    events = trace['traceEvents'] if isinstance(trace, dict) else trace
+    return [event for event in events
+            if SHIELDS_CATEGORY in event.get('cat', '')]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument('trace', help='trace JSON file exported from '
+                        'chrome://tracing')
+    args = parser.parse_args()
+
+    events = load_events(args.trace)
+    if not events:
+        print('No %s events found in trace' % SHIELDS_CATEGORY)
+        return 1
+
+    # Complete events ('X') carry their duration; async begin/end pairs
+    # ('b'/'e') are matched by id.
+    durations_us = collections.defaultdict(list)
+    async_begins = {}
+    verdict_counts = collections.Counter()
+
+    for event in events:
+        name = event.get('name', '')
+        phase = event.get('ph')
+        if phase == 'X':
+            durations_us[name].append(event.get('dur', 0))
+        elif phase == 'b':
+            async_begins[(name, event.get('id2', event.get('id')))] = \
+                event.get('ts', 0)
+        elif phase == 'e':
+            begin_ts = async_begins.pop(
+                (name, event.get('id2', event.get('id'))), None)
+            if begin_ts is not None:
+                durations_us[name].append(event.get('ts', 0) - begin_ts)
+            blocked_by = event.get('args', {}).get('blocked_by')
+            if blocked_by is not None:
+                verdict_counts['blocked_by=%s' % blocked_by] += 1
+        elif phase in ('i', 'I'):
+            verdict_counts[name] += 1
+
+    print('%-55s %8s %10s %10s %10s' %
+          ('event', 'count', 'mean_us', 'p50_us', 'p99_us'))
+    for name in sorted(durations_us):
+        values = sorted(durations_us[name])
+        print('%-55s %8d %10.1f %10.1f %10.1f' %
+              (name, len(values), sum(values) / len(values),
+               percentile(values, 0.5), percentile(values, 0.99)))
+
+    print()
+    print('verdicts:')
+    for verdict, count in verdict_counts.most_common():
+        print('  %-30s %8d' % (verdict, count))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,57 @@
+/* Copyright (c) 2021 The Brave Software Team. Distributed under the MPL2
+ * license. This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_TEST_BASE_TESTING_BRAVE_COMPONENT_UPDATER_DELEGATE_H_
+#define BRAVE_TEST_BASE_TESTING_BRAVE_COMPONENT_UPDATER_DELEGATE_H_
+
+#include <string>
+
+#include "base/notreached.h"
+#include "base/threading/thread_task_runner_handle.h"
+#include "brave/components/brave_component_updater/browser/brave_component.h"
+
+// Provides a task runner to services under test that are driven through a
+// BraveComponent::Delegate; all component updater operations are no-ops.
+//
+// TODO(iefremov): This is only needed to provide a task runner to the adblock
+// service. We can drop this stub once the service doesn't need an
+// "external" runner.
+class TestingBraveComponentUpdaterDelegate
+    : public brave_component_updater::BraveComponent::Delegate {
+ public:
+  TestingBraveComponentUpdaterDelegate() = default;
+  ~TestingBraveComponentUpdaterDelegate() override = default;
+
+  TestingBraveComponentUpdaterDelegate(TestingBraveComponentUpdaterDelegate&) =
+      delete;
+  TestingBraveComponentUpdaterDelegate& operator=(
+      TestingBraveComponentUpdaterDelegate&) = delete;
+
+  using BraveComponent = brave_component_updater::BraveComponent;
+  using ComponentObserver = update_client::UpdateClient::Observer;
+
+  // brave_component_updater::BraveComponent::Delegate implementation
+  void Register(const std::string& component_name,
+                const std::string& component_base64_public_key,
+                base::OnceClosure registered_callback,
+                BraveComponent::ReadyCallback ready_callback) override {}
+  bool Unregister(const std::string& component_id) override { return true; }
+  void OnDemandUpdate(const std::string& component_id) override {}
+
+  void AddObserver(ComponentObserver* observer) override {}
+  void RemoveObserver(ComponentObserver* observer) override {}
+
+  scoped_refptr<base::SequencedTaskRunner> GetTaskRunner() override {
+    return base::ThreadTaskRunnerHandle::Get();
+  }
+
+  const std::string locale() const override { return "en"; }
+  PrefService* local_state() override {
+    NOTREACHED();
+    return nullptr;
+  }
+};
+
+#endif  // BRAVE_TEST_BASE_TESTING_BRAVE_COMPONENT_UPDATER_DELEGATE_H_
@@ -0,0 +1,74 @@
+/* Copyright (c) 2021 The Brave Authors. All rights reserved.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BRAVE_THIRD_PARTY_BLINK_RENDERER_BRAVE_AUDIO_FARBLING_HELPER_H_
+#define BRAVE_THIRD_PARTY_BLINK_RENDERER_BRAVE_AUDIO_FARBLING_HELPER_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace brave {
+
+// Farbles analyser output one sample at a time. This is a plain value class
+// so that Farble() inlines into the conversion loops in RealtimeAnalyser;
+// dispatching a bound callback per sample costs about as much as the
+// analysis it decorates on pages that poll an analyser every frame.
+class AudioFarblingHelper {
+ public:
+  AudioFarblingHelper() = default;
+
+  static AudioFarblingHelper MakeConstantMultiplier(double fudge_factor) {
+    AudioFarblingHelper helper;
+    helper.mode_ = Mode::kConstantMultiplier;
+    helper.fudge_factor_ = fudge_factor;
+    return helper;
+  }
+
+  static AudioFarblingHelper MakePseudoRandomSequence(uint64_t seed) {
+    AudioFarblingHelper helper;
+    helper.mode_ = Mode::kPseudoRandomSequence;
+    helper.seed_ = seed;
+    return helper;
+  }
+
+  float Farble(float value, size_t index) const {
+    switch (mode_) {
+      case Mode::kNone:
+        break;
+      case Mode::kConstantMultiplier:
+        return value * fudge_factor_;
+      case Mode::kPseudoRandomSequence: {
+        if (index == 0) {
+          // start of loop, reset to the initial seed, which is based on the
+          // domain key
+          lfsr_ = seed_;
+        }
+        // get next value in PRNG sequence
+        lfsr_ = ((lfsr_ >> 1) | (((lfsr_ << 62) ^ (lfsr_ << 61)) &
+                                 (~(~UINT64_C(0) << 63) << 62)));
+        // return pseudo-random float between 0 and 0.1
+        return (lfsr_ / static_cast<double>(UINT64_MAX)) / 10;
+      }
+    }
+    return value;
+  }
+
+ private:
+  enum class Mode {
+    kNone,
+    kConstantMultiplier,
+    kPseudoRandomSequence,
+  };
+
+  Mode mode_ = Mode::kNone;
+  double fudge_factor_ = 1.0;
+  uint64_t seed_ = 0;
+  // The LFSR advances inside const conversion methods of RealtimeAnalyser.
+  mutable uint64_t lfsr_ = 0;
+};
+
+}  // namespace brave
+
+#endif  // BRAVE_THIRD_PARTY_BLINK_RENDERER_BRAVE_AUDIO_FARBLING_HELPER_H_